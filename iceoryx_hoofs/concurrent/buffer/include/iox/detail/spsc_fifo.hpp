@@ -30,6 +30,9 @@ namespace concurrent
 /// @brief single producer single consumer thread safe fifo
 /// @note there is only one push and one pop thread that can work on the FIFO without additional synchronization
 /// mechanisms like transferring the authorization to push to a third thread
+/// @note the positions of the producer and the consumer reside on separate cache lines and each side caches the last
+/// seen position of the other side, which is only refreshed when the fifo looks full or empty; hence in the steady
+/// state a push or pop does not touch the cache line which is written by the other thread
 template <typename ValueType, uint64_t Capacity>
 class SpscFifo
 {
@@ -62,13 +65,30 @@ class SpscFifo
     static constexpr uint64_t capacity() noexcept;
 
   private:
+    static constexpr uint64_t CACHE_LINE_SIZE{64U};
+
+    /// @brief the write position and the last read position seen by the producer; only the producer writes here
+    struct alignas(CACHE_LINE_SIZE) ProducerSide
+    {
+        std::atomic<uint64_t> writePos{0};
+        uint64_t cachedReadPos{0};
+    };
+
+    /// @brief the read position and the last write position seen by the consumer; only the consumer writes here
+    struct alignas(CACHE_LINE_SIZE) ConsumerSide
+    {
+        std::atomic<uint64_t> readPos{0};
+        uint64_t cachedWritePos{0};
+    };
+
     bool is_full(uint64_t currentReadPos, uint64_t currentWritePos) const noexcept;
 
+    static constexpr uint64_t toIndex(const uint64_t position) noexcept;
 
   private:
     UninitializedArray<ValueType, Capacity> m_data;
-    std::atomic<uint64_t> m_writePos{0};
-    std::atomic<uint64_t> m_readPos{0};
+    ProducerSide m_producer;
+    ConsumerSide m_consumer;
 };
 
 } // namespace concurrent
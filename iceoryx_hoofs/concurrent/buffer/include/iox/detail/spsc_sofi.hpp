@@ -41,6 +41,8 @@ namespace concurrent
 /// newly inserted elements will cause elements either at the beginning
 /// to be overwritten.The SpscSofi only allocates memory when
 /// created , capacity can be is adjusted explicitly.
+/// The positions of the producer and the consumer reside on separate cache lines and each side caches the last seen
+/// position of the other side, which is only refreshed when the SpscSofi looks full or empty.
 ///
 /// @param[in] ValueType        DataType to be stored, must be trivially copyable
 /// @param[in] CapacityValue    Capacity of the SpscSofi
@@ -153,14 +155,37 @@ class SpscSofi
     /// @concurrent unrestricted thread safe
     uint64_t size() const noexcept;
 
+  private:
+    static constexpr uint64_t CACHE_LINE_SIZE{64U};
+
+    /// @brief the write position and the last read position seen by the producer; the read position is also written
+    /// by the producer in case of an overflow
+    struct alignas(CACHE_LINE_SIZE) ProducerSide
+    {
+        std::atomic<uint64_t> writePosition{0};
+        uint64_t cachedReadPosition{0};
+    };
+
+    /// @brief the read position and the last write position seen by the consumer
+    struct alignas(CACHE_LINE_SIZE) ConsumerSide
+    {
+        std::atomic<uint64_t> readPosition{0};
+        uint64_t cachedWritePosition{0};
+    };
+
+    /// @brief The positions are mapped to the storage with the compile time size of the storage instead of the
+    /// runtime capacity, which is never larger; therefore the compiler replaces the modulo with a mask or a
+    /// multiplication instead of a division
+    static constexpr uint64_t toIndex(const uint64_t position) noexcept;
+
   private:
     UninitializedArray<ValueType, INTERNAL_SPSC_SOFI_SIZE> m_data;
     uint64_t m_size = INTERNAL_SPSC_SOFI_SIZE;
 
     /// @brief the write/read pointers are "atomic pointers" so that they are not
     /// reordered (read or written too late)
-    std::atomic<uint64_t> m_readPosition{0};
-    std::atomic<uint64_t> m_writePosition{0};
+    ProducerSide m_producer;
+    ConsumerSide m_consumer;
 };
 
 } // namespace concurrent
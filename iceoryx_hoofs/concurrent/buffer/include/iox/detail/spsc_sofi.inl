@@ -24,6 +24,12 @@ namespace iox
 {
 namespace concurrent
 {
+template <class ValueType, uint64_t CapacityValue>
+inline constexpr uint64_t SpscSofi<ValueType, CapacityValue>::toIndex(const uint64_t position) noexcept
+{
+    return position % INTERNAL_SPSC_SOFI_SIZE;
+}
+
 template <class ValueType, uint64_t CapacityValue>
 inline uint64_t SpscSofi<ValueType, CapacityValue>::capacity() const noexcept
 {
@@ -37,10 +43,10 @@ inline uint64_t SpscSofi<ValueType, CapacityValue>::size() const noexcept
     uint64_t writePosition{0};
     do
     {
-        readPosition = m_readPosition.load(std::memory_order_relaxed);
-        writePosition = m_writePosition.load(std::memory_order_relaxed);
-    } while (m_writePosition.load(std::memory_order_relaxed) != writePosition
-             || m_readPosition.load(std::memory_order_relaxed) != readPosition);
+        readPosition = m_consumer.readPosition.load(std::memory_order_relaxed);
+        writePosition = m_producer.writePosition.load(std::memory_order_relaxed);
+    } while (m_producer.writePosition.load(std::memory_order_relaxed) != writePosition
+             || m_consumer.readPosition.load(std::memory_order_relaxed) != readPosition);
 
     return writePosition - readPosition;
 }
@@ -53,8 +59,10 @@ inline bool SpscSofi<ValueType, CapacityValue>::setCapacity(const uint64_t newSi
     {
         m_size = newInternalSize;
 
-        m_readPosition.store(0, std::memory_order_release);
-        m_writePosition.store(0, std::memory_order_release);
+        m_consumer.readPosition.store(0, std::memory_order_release);
+        m_consumer.cachedWritePosition = 0U;
+        m_producer.writePosition.store(0, std::memory_order_release);
+        m_producer.cachedReadPosition = 0U;
 
         return true;
     }
@@ -72,12 +80,12 @@ inline bool SpscSofi<ValueType, CapacityValue>::empty() const noexcept
     {
         /// @todo iox-#1695 read before write since the writer increments the aba counter!!!
         /// @todo iox-#1695 write doc with example!!!
-        currentReadPosition = m_readPosition.load(std::memory_order_acquire);
-        uint64_t currentWritePosition = m_writePosition.load(std::memory_order_acquire);
+        currentReadPosition = m_consumer.readPosition.load(std::memory_order_acquire);
+        uint64_t currentWritePosition = m_producer.writePosition.load(std::memory_order_acquire);
 
         isEmpty = (currentWritePosition == currentReadPosition);
         // we need compare without exchange
-    } while (!(currentReadPosition == m_readPosition.load(std::memory_order_acquire)));
+    } while (!(currentReadPosition == m_consumer.readPosition.load(std::memory_order_acquire)));
 
     return isEmpty;
 }
@@ -92,13 +100,21 @@ template <class ValueType, uint64_t CapacityValue>
 template <typename Verificator_T>
 inline bool SpscSofi<ValueType, CapacityValue>::popIf(ValueType& valueOut, const Verificator_T& verificator) noexcept
 {
-    uint64_t currentReadPosition = m_readPosition.load(std::memory_order_acquire);
+    uint64_t currentReadPosition = m_consumer.readPosition.load(std::memory_order_acquire);
     uint64_t nextReadPosition{0};
 
     bool popWasSuccessful{true};
     do
     {
-        if (currentReadPosition == m_writePosition.load(std::memory_order_acquire))
+        // the write position only grows and the read position never overtakes it, therefore the SpscSofi is not
+        // empty when the read position is below the cached write position; the acquire load which provided the
+        // cached write position also synchronizes the data of all positions below it
+        if (currentReadPosition >= m_consumer.cachedWritePosition)
+        {
+            m_consumer.cachedWritePosition = m_producer.writePosition.load(std::memory_order_acquire);
+        }
+
+        if (currentReadPosition == m_consumer.cachedWritePosition)
         {
             nextReadPosition = currentReadPosition;
             popWasSuccessful = false;
@@ -110,12 +126,13 @@ inline bool SpscSofi<ValueType, CapacityValue>::popIf(ValueType& valueOut, const
             // invalid object); memcpy is also not thread safe, but we discard the object anyway and read it
             // again if its overwritten in between; this is only relevant for types larger than pointer size
             // assign the user data
-            std::memcpy(&valueOut, &m_data[currentReadPosition % m_size], sizeof(ValueType));
+            std::memcpy(&valueOut, &m_data[toIndex(currentReadPosition)], sizeof(ValueType));
 
             /// @brief first we need to peak valueOut if it is fitting the condition and then we have to verify
             ///        if valueOut is not am invalid object, this could be the case if the read position has
             ///        changed
-            if (m_readPosition.load(std::memory_order_relaxed) == currentReadPosition && !verificator(valueOut))
+            if (m_consumer.readPosition.load(std::memory_order_relaxed) == currentReadPosition
+                && !verificator(valueOut))
             {
                 popWasSuccessful = false;
                 nextReadPosition = currentReadPosition;
@@ -128,12 +145,12 @@ inline bool SpscSofi<ValueType, CapacityValue>::popIf(ValueType& valueOut, const
         }
 
         // compare and swap
-        // if(m_readPosition == currentReadPosition)
-        //     m_readPosition = l_next_aba_read_pos
+        // if(readPosition == currentReadPosition)
+        //     readPosition = l_next_aba_read_pos
         // else
-        //     currentReadPosition = m_readPosition
+        //     currentReadPosition = readPosition
         // Assign m_aba_read_p to next readable location
-    } while (!m_readPosition.compare_exchange_weak(
+    } while (!m_consumer.readPosition.compare_exchange_weak(
         currentReadPosition, nextReadPosition, std::memory_order_acq_rel, std::memory_order_acquire));
 
     return popWasSuccessful;
@@ -144,13 +161,21 @@ inline bool SpscSofi<ValueType, CapacityValue>::push(const ValueType& valueIn, V
 {
     constexpr bool SOFI_OVERFLOW{false};
 
-    uint64_t currentWritePosition = m_writePosition.load(std::memory_order_relaxed);
+    uint64_t currentWritePosition = m_producer.writePosition.load(std::memory_order_relaxed);
     uint64_t nextWritePosition = currentWritePosition + 1U;
 
-    m_data[currentWritePosition % m_size] = valueIn;
-    m_writePosition.store(nextWritePosition, std::memory_order_release);
+    m_data[toIndex(currentWritePosition)] = valueIn;
+    m_producer.writePosition.store(nextWritePosition, std::memory_order_release);
+
+    // the read position only grows, therefore there is a free position for the next push when there is one according
+    // to the cached read position and the cache line of the consumer does not need to be touched
+    if (nextWritePosition < m_producer.cachedReadPosition + m_size)
+    {
+        return !SOFI_OVERFLOW;
+    }
 
-    uint64_t currentReadPosition = m_readPosition.load(std::memory_order_acquire);
+    uint64_t currentReadPosition = m_consumer.readPosition.load(std::memory_order_acquire);
+    m_producer.cachedReadPosition = currentReadPosition;
 
     // check if there is a free position for the next push
     if (nextWritePosition < currentReadPosition + m_size)
@@ -168,7 +193,7 @@ inline bool SpscSofi<ValueType, CapacityValue>::push(const ValueType& valueIn, V
     // b) it doesn't work, which means that the pop thread already took the value in the meantime an no further action
     // is required
     // memory order success is memory_order_acq_rel
-    //   - this is to prevent the reordering of m_writePosition.store(...) after the increment of the m_readPosition
+    //   - this is to prevent the reordering of writePosition.store(...) after the increment of the readPosition
     //     - in case of an overflow, this might result in the pop thread getting one element less than the capacity of
     //       the SoFi if the push thread is suspended in between this two statements
     //     - it's still possible to get more elements than the capacity, but this is an inherent issue with concurrent
@@ -177,10 +202,11 @@ inline bool SpscSofi<ValueType, CapacityValue>::push(const ValueType& valueIn, V
     //     synchronization, then the memory also needs to be synchronized for the overflow case
     // memory order failure is memory_order_relaxed since there is no further synchronization needed if there is no
     // overflow
-    if (m_readPosition.compare_exchange_strong(
+    if (m_consumer.readPosition.compare_exchange_strong(
             currentReadPosition, nextReadPosition, std::memory_order_acq_rel, std::memory_order_relaxed))
     {
-        std::memcpy(&valueOut, &m_data[currentReadPosition % m_size], sizeof(ValueType));
+        m_producer.cachedReadPosition = nextReadPosition;
+        std::memcpy(&valueOut, &m_data[toIndex(currentReadPosition)], sizeof(ValueType));
         return SOFI_OVERFLOW;
     }
 
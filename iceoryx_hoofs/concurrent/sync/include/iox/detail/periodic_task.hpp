@@ -19,8 +19,10 @@
 
 #include "iox/detail/deprecation_marker.hpp"
 #include "iox/duration.hpp"
+#include "iox/logging.hpp"
 #include "iox/string.hpp"
 #include "iox/thread.hpp"
+#include "iox/timer_service.hpp"
 #include "iox/unnamed_semaphore.hpp"
 
 #include <thread>
@@ -62,6 +64,9 @@ static constexpr PeriodicTaskManualStart_t PeriodicTaskManualStart;
 /// }
 /// @endcode
 /// @note Currently execution time of the callable is added to the interval.
+/// @note A PeriodicTask which is created with a TimerService does not spawn a thread but is executed by the thread of
+/// the TimerService, which is shared with other tasks. Without a TimerService the task gets a dedicated thread, which
+/// should be used for tasks with real time requirements.
 /// @tparam T is a callable type without function parameters
 template <typename T>
 class PeriodicTask
@@ -79,6 +84,23 @@ class PeriodicTask
     // NOLINTNEXTLINE(hicpp-named-parameter, readability-named-parameter)
     PeriodicTask(const PeriodicTaskManualStart_t, const ThreadName_t& taskName, Args&&... args) noexcept;
 
+    /// @brief Creates a periodic task which is executed by a TimerService. The specified callable is stored but not
+    /// executed. To run the task, 'void start(const units::Duration interval)' must be called.
+    /// @tparam Args are variadic template parameter for which are forwarded to the underlying callable object
+    /// @param[in] PeriodicTaskManualStart_t indicates that this ctor doesn't start the task; just pass
+    /// 'PeriodicTaskManualStart' as argument
+    /// @param[in] timerService executes the task; it must outlive the PeriodicTask
+    /// @param[in] taskName will be set as thread name if the TimerService has no capacity left and the task falls back
+    /// to a dedicated thread
+    /// @param[in] args are forwarded to the underlying callable object
+    template <typename... Args>
+    // PeriodicTaskManualStart_t is a compile time constant to indicate that this constructor does not start the task
+    // NOLINTNEXTLINE(hicpp-named-parameter, readability-named-parameter)
+    PeriodicTask(const PeriodicTaskManualStart_t,
+                 TimerService& timerService,
+                 const ThreadName_t& taskName,
+                 Args&&... args) noexcept;
+
     /// @brief Creates a periodic task by spawning a thread. The specified callable is executed immediately on creation
     /// and then periodically after the interval duration.
     /// @tparam Args are variadic template parameter for which are forwarded to the underlying callable object
@@ -95,7 +117,26 @@ class PeriodicTask
                  const ThreadName_t& taskName,
                  Args&&... args) noexcept;
 
-    /// @brief Stops and joins the thread spawned by the constructor.
+    /// @brief Creates a periodic task which is executed by a TimerService. The specified callable is executed
+    /// immediately on creation and then periodically after the interval duration.
+    /// @tparam Args are variadic template parameter for which are forwarded to the underlying callable object
+    /// @param[in] PeriodicTaskAutoStart_t indicates that this ctor starts the task; just pass
+    /// 'PeriodicTaskAutoStart' as argument
+    /// @param[in] interval is the time between two invocations of the callable
+    /// @param[in] timerService executes the task; it must outlive the PeriodicTask
+    /// @param[in] taskName will be set as thread name if the TimerService has no capacity left and the task falls back
+    /// to a dedicated thread
+    /// @param[in] args are forwarded to the underlying callable object
+    template <typename... Args>
+    // PeriodicTaskAutoStart_t is a compile time constant to indicate that this constructor starts the task
+    // NOLINTNEXTLINE(hicpp-named-parameter, readability-named-parameter)
+    PeriodicTask(const PeriodicTaskAutoStart_t,
+                 const units::Duration interval,
+                 TimerService& timerService,
+                 const ThreadName_t& taskName,
+                 Args&&... args) noexcept;
+
+    /// @brief Stops and joins the thread spawned by the constructor or removes the task from the TimerService.
     /// @note This is blocking and the blocking time depends on the callable.
     ~PeriodicTask() noexcept;
 
@@ -117,8 +158,9 @@ class PeriodicTask
     /// @attention This might take some time if a slow task is executing during this call.
     void stop() noexcept;
 
-    /// @brief This method check if a thread is spawned and running, potentially executing a task.
-    /// @return true if the thread is running, false otherwise.
+    /// @brief This method check if a thread is spawned and running or if the task is registered at the TimerService,
+    /// potentially executing a task.
+    /// @return true if the task is running, false otherwise.
     bool is_active() const noexcept;
 
     IOX_DEPRECATED_SINCE(3, "Please use 'is_active' instead.")
@@ -133,6 +175,8 @@ class PeriodicTask
     units::Duration m_interval{units::Duration::fromMilliseconds(0U)};
     optional<UnnamedSemaphore> m_stop;
     std::thread m_taskExecutor;
+    TimerService* m_timerService{nullptr};
+    optional<TimerService::TimerId> m_timer;
 };
 
 } // namespace detail
@@ -50,6 +50,31 @@ inline PeriodicTask<T>::PeriodicTask(const PeriodicTaskAutoStart_t,
     start(interval);
 }
 
+template <typename T>
+template <typename... Args>
+// NOLINTNEXTLINE(hicpp-named-parameter, readability-named-parameter) justification in header
+inline PeriodicTask<T>::PeriodicTask(const PeriodicTaskManualStart_t,
+                                     TimerService& timerService,
+                                     const ThreadName_t& taskName,
+                                     Args&&... args) noexcept
+    : PeriodicTask(PeriodicTaskManualStart, taskName, std::forward<Args>(args)...)
+{
+    m_timerService = &timerService;
+}
+
+template <typename T>
+template <typename... Args>
+// NOLINTNEXTLINE(hicpp-named-parameter, readability-named-parameter) justification in header
+inline PeriodicTask<T>::PeriodicTask(const PeriodicTaskAutoStart_t,
+                                     const units::Duration interval,
+                                     TimerService& timerService,
+                                     const ThreadName_t& taskName,
+                                     Args&&... args) noexcept
+    : PeriodicTask(PeriodicTaskManualStart, timerService, taskName, std::forward<Args>(args)...)
+{
+    start(interval);
+}
+
 template <typename T>
 inline PeriodicTask<T>::~PeriodicTask() noexcept
 {
@@ -61,12 +86,31 @@ inline void PeriodicTask<T>::start(const units::Duration interval) noexcept
 {
     stop();
     m_interval = interval;
+
+    if (m_timerService != nullptr)
+    {
+        m_timer = m_timerService->addPeriodicTimer(interval, m_callable);
+        if (m_timer.has_value())
+        {
+            return;
+        }
+        IOX_LOG(WARN,
+                "The timer service has no capacity left! The periodic task '" << m_taskName
+                                                                              << "' uses a dedicated thread.");
+    }
+
     m_taskExecutor = std::thread(&PeriodicTask::run, this);
 }
 
 template <typename T>
 inline void PeriodicTask<T>::stop() noexcept
 {
+    if (m_timer.has_value())
+    {
+        m_timerService->removeTimer(m_timer.value());
+        m_timer.reset();
+    }
+
     if (m_taskExecutor.joinable())
     {
         m_stop->post().expect("'post' on a semaphore should always be successful");
@@ -77,7 +121,7 @@ inline void PeriodicTask<T>::stop() noexcept
 template <typename T>
 inline bool PeriodicTask<T>::is_active() const noexcept
 {
-    return m_taskExecutor.joinable();
+    return m_timer.has_value() || m_taskExecutor.joinable();
 }
 
 template <typename T>
@@ -148,6 +148,12 @@ inline void FixedPositionContainer<T, CAPACITY>::copy_and_move_impl(RhsType&& rh
         m_next[rhs.m_size - 1] = Index::INVALID;
     }
 
+    m_occupancy.clear();
+    for (IndexType j = 0; j < rhs.m_size; ++j)
+    {
+        m_occupancy.occupy(j);
+    }
+
     m_begin_free = static_cast<IndexType>(rhs.m_size);
     m_begin_used = rhs.empty() ? Index::INVALID : Index::FIRST;
     m_size = rhs.m_size;
@@ -176,6 +182,7 @@ inline void FixedPositionContainer<T, CAPACITY>::clear() noexcept
         i = next;
     }
     m_next[Index::LAST] = Index::INVALID;
+    m_occupancy.clear();
 
     m_size = 0;
     m_begin_free = Index::FIRST;
@@ -277,6 +284,7 @@ FixedPositionContainer<T, CAPACITY>::emplace(Targs&&... args) noexcept
 
     new (&m_data[index]) T(std::forward<Targs>(args)...);
     m_status[index] = SlotStatus::USED;
+    m_occupancy.occupy(index);
     ++m_size;
 
     if (index < m_begin_used)
@@ -286,17 +294,11 @@ FixedPositionContainer<T, CAPACITY>::emplace(Targs&&... args) noexcept
     }
     else
     {
-        IOX_ENFORCE(index != 0, "Corruption detected!");
-        for (auto i = static_cast<IndexType>(index - 1U);; --i)
-        {
-            if (m_status[i] == SlotStatus::USED)
-            {
-                m_next[index] = m_next[i];
-                m_next[i] = index;
-                break;
-            }
-            IOX_ENFORCE(i != 0, "Corruption detected!");
-        }
+        const auto previous_used = m_occupancy.findPreviousOccupied(index);
+        IOX_ENFORCE(previous_used != decltype(m_occupancy)::INVALID_INDEX, "Corruption detected!");
+        const auto i = static_cast<IndexType>(previous_used);
+        m_next[index] = m_next[i];
+        m_next[i] = index;
     }
 
     return Iterator{index, *this};
@@ -418,6 +420,7 @@ FixedPositionContainer<T, CAPACITY>::erase(const IndexType index) noexcept
 
     m_data[index].~T();
     m_status[index] = SlotStatus::FREE;
+    m_occupancy.release(index);
     --m_size;
 
     auto next_used = m_next[index];
@@ -443,25 +446,25 @@ FixedPositionContainer<T, CAPACITY>::erase(const IndexType index) noexcept
     }
 
     IOX_ENFORCE(index != 0, "Corruption detected! Index cannot be 0 at this location!");
-    for (auto i = static_cast<IndexType>(index - 1U); !is_removed_from_used_list || !is_added_to_free_list; --i)
+    if (!is_removed_from_used_list)
     {
-        if (!is_removed_from_used_list && m_status[i] == SlotStatus::USED)
+        const auto previous_used = m_occupancy.findPreviousOccupied(index);
+        if (previous_used != decltype(m_occupancy)::INVALID_INDEX)
         {
-            m_next[i] = next_used;
+            m_next[previous_used] = next_used;
             is_removed_from_used_list = true;
         }
+    }
 
-        if (!is_added_to_free_list && m_status[i] == SlotStatus::FREE)
+    if (!is_added_to_free_list)
+    {
+        const auto previous_free = m_occupancy.findPreviousFree(index);
+        if (previous_free != decltype(m_occupancy)::INVALID_INDEX)
         {
-            m_next[index] = m_next[i];
-            m_next[i] = index;
+            m_next[index] = m_next[previous_free];
+            m_next[previous_free] = index;
             is_added_to_free_list = true;
         }
-
-        if (i == 0)
-        {
-            break;
-        }
     }
     IOX_ENFORCE(is_removed_from_used_list && is_added_to_free_list,
                 "Corruption detected! The container is in a corrupt state!");
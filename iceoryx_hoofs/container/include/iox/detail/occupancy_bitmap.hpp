@@ -0,0 +1,108 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_CONTAINER_DETAIL_OCCUPANCY_BITMAP_HPP
+#define IOX_HOOFS_CONTAINER_DETAIL_OCCUPANCY_BITMAP_HPP
+
+#include <cstdint>
+
+namespace iox
+{
+namespace detail
+{
+/// @brief Returns the position of the most significant set bit of a value
+/// @param[in] value must not be zero
+/// @return the position of the most significant set bit, starting with 0 for the least significant bit
+uint64_t mostSignificantSetBit(const uint64_t value) noexcept;
+
+/// @brief A two level bitmap which tracks the occupancy of the slots of a container. It finds the closest occupied or
+/// free slot preceding a given slot with a few count-leading-zeros operations instead of a slot by slot search. The
+/// first level has one bit per slot; the second level has one bit per first level word in two summaries, one which
+/// marks words with at least one occupied slot and one which marks words with at least one free slot.
+/// @tparam CAPACITY is the number of slots
+template <uint64_t CAPACITY>
+class OccupancyBitmap
+{
+  public:
+    static constexpr uint64_t INVALID_INDEX{CAPACITY};
+
+    /// @brief Creates a bitmap with all slots being free
+    OccupancyBitmap() noexcept;
+
+    /// @brief Marks all slots as free
+    void clear() noexcept;
+
+    /// @brief Marks a slot as occupied
+    /// @param[in] index of the slot; must be less than CAPACITY
+    void occupy(const uint64_t index) noexcept;
+
+    /// @brief Marks a slot as free
+    /// @param[in] index of the slot; must be less than CAPACITY
+    void release(const uint64_t index) noexcept;
+
+    /// @brief Checks whether a slot is occupied
+    /// @param[in] index of the slot; must be less than CAPACITY
+    /// @return true if the slot is occupied, false otherwise
+    bool isOccupied(const uint64_t index) const noexcept;
+
+    /// @brief Finds the closest occupied slot before a slot
+    /// @param[in] index of the slot to start the search from; must not be greater than CAPACITY
+    /// @return the index of the closest occupied slot with a lower index or INVALID_INDEX if there is none
+    uint64_t findPreviousOccupied(const uint64_t index) const noexcept;
+
+    /// @brief Finds the closest free slot before a slot
+    /// @param[in] index of the slot to start the search from; must not be greater than CAPACITY
+    /// @return the index of the closest free slot with a lower index or INVALID_INDEX if there is none
+    uint64_t findPreviousFree(const uint64_t index) const noexcept;
+
+  private:
+    static constexpr uint64_t BITS_PER_WORD{64U};
+    static constexpr uint64_t NUMBER_OF_WORDS{(CAPACITY + BITS_PER_WORD - 1U) / BITS_PER_WORD};
+    static constexpr uint64_t NUMBER_OF_SUMMARY_WORDS{(NUMBER_OF_WORDS + BITS_PER_WORD - 1U) / BITS_PER_WORD};
+    static constexpr uint64_t ALL_BITS_SET{~static_cast<uint64_t>(0U)};
+
+    static_assert(CAPACITY > 0U, "The capacity must be greater than zero");
+
+    /// @brief Returns a mask with the bits from 0 up to and including 'bit' set
+    static uint64_t maskUpTo(const uint64_t bit) noexcept;
+
+    static void setBit(uint64_t* const words, const uint64_t index) noexcept;
+    static void clearBit(uint64_t* const words, const uint64_t index) noexcept;
+
+    /// @brief Finds the closest set bit before 'index' in the first level words with the help of the summary; with
+    /// 'Invert' the closest unset bit is searched instead
+    /// @note the unused bits of the last word are never found since only bits before an index which is not greater
+    /// than CAPACITY are considered; therefore the summary bit of the last word is also never relevant
+    template <bool Invert>
+    static uint64_t findPreviousSetBit(const uint64_t* const words,
+                                       const uint64_t* const summary,
+                                       const uint64_t index) noexcept;
+
+  private:
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays)
+    uint64_t m_occupied[NUMBER_OF_WORDS]{};
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays)
+    uint64_t m_wordsWithOccupiedSlots[NUMBER_OF_SUMMARY_WORDS]{};
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays)
+    uint64_t m_wordsWithFreeSlots[NUMBER_OF_SUMMARY_WORDS]{};
+};
+
+} // namespace detail
+} // namespace iox
+
+#include "iox/detail/occupancy_bitmap.inl"
+
+#endif // IOX_HOOFS_CONTAINER_DETAIL_OCCUPANCY_BITMAP_HPP
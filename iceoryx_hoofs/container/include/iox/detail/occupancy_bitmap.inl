@@ -0,0 +1,187 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_CONTAINER_DETAIL_OCCUPANCY_BITMAP_INL
+#define IOX_HOOFS_CONTAINER_DETAIL_OCCUPANCY_BITMAP_INL
+
+#include "iox/detail/occupancy_bitmap.hpp"
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace iox
+{
+namespace detail
+{
+inline uint64_t mostSignificantSetBit(const uint64_t value) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    constexpr uint64_t HIGHEST_BIT{63U};
+    return HIGHEST_BIT - static_cast<uint64_t>(__builtin_clzll(value));
+#elif defined(_MSC_VER)
+    unsigned long position{0U};
+    _BitScanReverse64(&position, value);
+    return static_cast<uint64_t>(position);
+#else
+    uint64_t position{0U};
+    for (uint64_t remaining = value >> 1U; remaining != 0U; remaining >>= 1U)
+    {
+        ++position;
+    }
+    return position;
+#endif
+}
+
+template <uint64_t CAPACITY>
+inline OccupancyBitmap<CAPACITY>::OccupancyBitmap() noexcept
+{
+    clear();
+}
+
+template <uint64_t CAPACITY>
+inline void OccupancyBitmap<CAPACITY>::clear() noexcept
+{
+    for (auto& word : m_occupied)
+    {
+        word = 0U;
+    }
+    for (auto& word : m_wordsWithOccupiedSlots)
+    {
+        word = 0U;
+    }
+    for (auto& word : m_wordsWithFreeSlots)
+    {
+        word = 0U;
+    }
+    for (uint64_t word = 0U; word < NUMBER_OF_WORDS; ++word)
+    {
+        setBit(&m_wordsWithFreeSlots[0], word);
+    }
+}
+
+template <uint64_t CAPACITY>
+inline void OccupancyBitmap<CAPACITY>::occupy(const uint64_t index) noexcept
+{
+    const auto word = index / BITS_PER_WORD;
+    setBit(&m_occupied[0], index);
+    setBit(&m_wordsWithOccupiedSlots[0], word);
+    if (m_occupied[word] == ALL_BITS_SET)
+    {
+        clearBit(&m_wordsWithFreeSlots[0], word);
+    }
+}
+
+template <uint64_t CAPACITY>
+inline void OccupancyBitmap<CAPACITY>::release(const uint64_t index) noexcept
+{
+    const auto word = index / BITS_PER_WORD;
+    clearBit(&m_occupied[0], index);
+    setBit(&m_wordsWithFreeSlots[0], word);
+    if (m_occupied[word] == 0U)
+    {
+        clearBit(&m_wordsWithOccupiedSlots[0], word);
+    }
+}
+
+template <uint64_t CAPACITY>
+inline bool OccupancyBitmap<CAPACITY>::isOccupied(const uint64_t index) const noexcept
+{
+    return (m_occupied[index / BITS_PER_WORD] & (static_cast<uint64_t>(1U) << (index % BITS_PER_WORD))) != 0U;
+}
+
+template <uint64_t CAPACITY>
+inline uint64_t OccupancyBitmap<CAPACITY>::findPreviousOccupied(const uint64_t index) const noexcept
+{
+    return findPreviousSetBit<false>(&m_occupied[0], &m_wordsWithOccupiedSlots[0], index);
+}
+
+template <uint64_t CAPACITY>
+inline uint64_t OccupancyBitmap<CAPACITY>::findPreviousFree(const uint64_t index) const noexcept
+{
+    return findPreviousSetBit<true>(&m_occupied[0], &m_wordsWithFreeSlots[0], index);
+}
+
+template <uint64_t CAPACITY>
+inline uint64_t OccupancyBitmap<CAPACITY>::maskUpTo(const uint64_t bit) noexcept
+{
+    return (bit == BITS_PER_WORD - 1U) ? ALL_BITS_SET : ((static_cast<uint64_t>(1U) << (bit + 1U)) - 1U);
+}
+
+template <uint64_t CAPACITY>
+inline void OccupancyBitmap<CAPACITY>::setBit(uint64_t* const words, const uint64_t index) noexcept
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) the index is checked by the caller
+    words[index / BITS_PER_WORD] |= static_cast<uint64_t>(1U) << (index % BITS_PER_WORD);
+}
+
+template <uint64_t CAPACITY>
+inline void OccupancyBitmap<CAPACITY>::clearBit(uint64_t* const words, const uint64_t index) noexcept
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) the index is checked by the caller
+    words[index / BITS_PER_WORD] &= ~(static_cast<uint64_t>(1U) << (index % BITS_PER_WORD));
+}
+
+template <uint64_t CAPACITY>
+template <bool Invert>
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic) the indices are derived from an index below CAPACITY
+inline uint64_t OccupancyBitmap<CAPACITY>::findPreviousSetBit(const uint64_t* const words,
+                                                              const uint64_t* const summary,
+                                                              const uint64_t index) noexcept
+{
+    if (index == 0U)
+    {
+        return INVALID_INDEX;
+    }
+
+    // search the word of the preceding slot first
+    const auto position = index - 1U;
+    auto word = position / BITS_PER_WORD;
+    auto bits = (Invert ? ~words[word] : words[word]) & maskUpTo(position % BITS_PER_WORD);
+    if (bits != 0U)
+    {
+        return word * BITS_PER_WORD + mostSignificantSetBit(bits);
+    }
+
+    if (word == 0U)
+    {
+        return INVALID_INDEX;
+    }
+
+    // the summary tells which of the preceding words contains a candidate
+    const auto summaryPosition = word - 1U;
+    auto summaryWord = summaryPosition / BITS_PER_WORD;
+    auto summaryBits = summary[summaryWord] & maskUpTo(summaryPosition % BITS_PER_WORD);
+    while (summaryBits == 0U)
+    {
+        if (summaryWord == 0U)
+        {
+            return INVALID_INDEX;
+        }
+        --summaryWord;
+        summaryBits = summary[summaryWord];
+    }
+
+    word = summaryWord * BITS_PER_WORD + mostSignificantSetBit(summaryBits);
+    bits = Invert ? ~words[word] : words[word];
+    return word * BITS_PER_WORD + mostSignificantSetBit(bits);
+}
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+} // namespace detail
+} // namespace iox
+
+#endif // IOX_HOOFS_CONTAINER_DETAIL_OCCUPANCY_BITMAP_INL
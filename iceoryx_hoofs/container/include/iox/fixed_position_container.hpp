@@ -19,6 +19,7 @@
 
 #include "iox/algorithm.hpp"
 #include "iox/assertions.hpp"
+#include "iox/detail/occupancy_bitmap.hpp"
 #include "iox/move_and_copy_helper.hpp"
 #include "iox/uninitialized_array.hpp"
 
@@ -320,6 +321,8 @@ class FixedPositionContainer final
     UninitializedArray<T, CAPACITY> m_data;
     UninitializedArray<SlotStatus, CAPACITY> m_status;
     UninitializedArray<IndexType, CAPACITY> m_next;
+    // mirrors 'm_status' to find the preceding used and free slots without a slot by slot search
+    detail::OccupancyBitmap<CAPACITY> m_occupancy;
     IndexType m_size{0};
     IndexType m_begin_free{Index::FIRST};
     IndexType m_begin_used{Index::INVALID};
@@ -0,0 +1,85 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_POSIX_SYNC_FUTEX_SEMAPHORE_HPP
+#define IOX_HOOFS_POSIX_SYNC_FUTEX_SEMAPHORE_HPP
+
+#if defined(__linux__)
+#define IOX_FUTEX_SEMAPHORE_AVAILABLE
+#endif
+
+#if defined(IOX_FUTEX_SEMAPHORE_AVAILABLE)
+
+#include "iox/detail/semaphore_interface.hpp"
+#include "iox/duration.hpp"
+#include "iox/expected.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+struct timespec;
+
+namespace iox
+{
+/// @brief A binary semaphore which is built directly on a futex word and can be placed in the shared memory for inter
+/// process usage. In contrast to the posix semaphore, 'post' does not perform a syscall when no thread is sleeping
+/// in 'wait' or 'timedWait', since the sleeping threads announce themselves with a flag in the futex word.
+/// @note The semaphore is binary, i.e. posting an already posted semaphore has no effect. It is therefore only a
+/// replacement for the posix semaphore when the user does not rely on the count, like the condition listener which
+/// resets the semaphore before each wait anyway.
+/// @note Only available on Linux, see IOX_FUTEX_SEMAPHORE_AVAILABLE.
+class FutexSemaphore
+{
+  public:
+    FutexSemaphore() noexcept = default;
+    ~FutexSemaphore() noexcept = default;
+
+    FutexSemaphore(const FutexSemaphore&) noexcept = delete;
+    FutexSemaphore(FutexSemaphore&&) noexcept = delete;
+    FutexSemaphore& operator=(const FutexSemaphore&) noexcept = delete;
+    FutexSemaphore& operator=(FutexSemaphore&&) noexcept = delete;
+
+    /// @brief Sets the semaphore and wakes up the threads which are sleeping in 'wait' or 'timedWait'
+    /// @return Fails when the futex syscall is not supported by the kernel
+    expected<void, SemaphoreError> post() noexcept;
+
+    /// @brief Resets the semaphore. When the semaphore is not set it blocks until it is set
+    /// @return Fails when the futex syscall is not supported by the kernel
+    expected<void, SemaphoreError> wait() noexcept;
+
+    /// @brief Resets the semaphore when it is set
+    /// @return true when the semaphore was set, otherwise false
+    expected<bool, SemaphoreError> tryWait() noexcept;
+
+    /// @brief Resets the semaphore. When the semaphore is not set it blocks until it is set or the timeout has
+    /// passed. The timeout is converted into an absolute point in time of the monotonic clock, therefore spurious
+    /// wake ups and signals do not prolong the wait.
+    /// @return SemaphoreWaitState::NO_TIMEOUT when the semaphore was set, otherwise SemaphoreWaitState::TIMEOUT
+    expected<SemaphoreWaitState, SemaphoreError> timedWait(const units::Duration& timeout) noexcept;
+
+  private:
+    expected<SemaphoreWaitState, SemaphoreError> waitUntil(const struct timespec* deadline) noexcept;
+
+    bool tryReset() noexcept;
+
+  private:
+    std::atomic<uint32_t> m_futexWord{0U};
+};
+} // namespace iox
+
+#endif // IOX_FUTEX_SEMAPHORE_AVAILABLE
+
+#endif // IOX_HOOFS_POSIX_SYNC_FUTEX_SEMAPHORE_HPP
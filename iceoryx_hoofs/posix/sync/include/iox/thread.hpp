@@ -19,10 +19,12 @@
 
 #include "iceoryx_platform/pthread.hpp"
 #include "iox/builder.hpp"
+#include "iox/detail/posix_scheduler.hpp"
 #include "iox/expected.hpp"
 #include "iox/function.hpp"
 #include "iox/posix_call.hpp"
 #include "iox/string.hpp"
+#include "iox/unnamed_semaphore.hpp"
 
 #include <atomic>
 #include <thread>
@@ -43,9 +45,37 @@ enum class ThreadError
     INSUFFICIENT_PERMISSIONS,
     INSUFFICIENT_RESOURCES,
     INVALID_ATTRIBUTES,
+    UNSUPPORTED_BY_PLATFORM,
     UNDEFINED
 };
 
+/// @brief The scheduling parameters of a thread
+struct ThreadSchedulingParameters
+{
+    /// @brief Pins the thread to the CPU cores whose bits are set in the mask, bit n represents CPU core n. The
+    ///        default of 0 keeps the affinity which is inherited from the creating thread.
+    uint64_t cpuAffinityMask{0U};
+    /// @brief The scheduling policy of the thread, e.g. Scheduler::FIFO for real-time threads. When no scheduler is
+    ///        set the scheduling of the creating thread is inherited.
+    optional<detail::Scheduler> scheduler{nullopt};
+    /// @brief The priority of the thread. It is only applied when a scheduler is set and must be in the range of
+    ///        detail::getSchedulerPriorityMinimum and detail::getSchedulerPriorityMaximum of that scheduler.
+    int32_t priority{0};
+};
+
+/// @brief Applies the scheduling parameters to the calling thread. This is intended for threads which are not
+///        created with the ThreadBuilder.
+/// @param[in] parameters the CPU affinity and the scheduling of the thread
+/// @return an error describing the failure or success; the parameters which were applied before the failure remain
+expected<void, ThreadError> setThreadSchedulingParameters(const ThreadSchedulingParameters& parameters) noexcept;
+
+namespace detail
+{
+expected<void, ThreadError> applyThreadSchedulingParameters(iox_pthread_t threadHandle,
+                                                            const ThreadSchedulingParameters& parameters,
+                                                            const ThreadName_t& name) noexcept;
+} // namespace detail
+
 /// @brief POSIX thread wrapper class. Following RAII, the thread is joined on destruction.
 /// @code
 /// #include "iox/thread.hpp"
@@ -75,6 +105,8 @@ class Thread
 
     friend class ThreadBuilder;
     friend class optional<Thread>;
+    friend expected<void, ThreadError> detail::applyThreadSchedulingParameters(
+        iox_pthread_t threadHandle, const ThreadSchedulingParameters& parameters, const ThreadName_t& name) noexcept;
 
   private:
     Thread(const ThreadName_t& name, const callable_t& callable) noexcept;
@@ -87,6 +119,9 @@ class Thread
     callable_t m_callable;
     bool m_isThreadConstructed{false};
     ThreadName_t m_threadName;
+    /// @note only present when the scheduling of the thread has to be adjusted before the callable is invoked
+    optional<UnnamedSemaphore> m_startSemaphore;
+    bool m_isStartPermitted{true};
 };
 
 class ThreadBuilder
@@ -94,13 +129,31 @@ class ThreadBuilder
     /// @brief Set the name of the thread
     IOX_BUILDER_PARAMETER(ThreadName_t, name, "")
 
+    /// @brief Pins the thread to the CPU cores whose bits are set in the mask, bit n represents CPU core n. The default
+    ///        of 0 keeps the affinity which is inherited from the creating thread.
+    IOX_BUILDER_PARAMETER(uint64_t, cpuAffinityMask, 0U)
+
+    /// @brief Set the scheduling policy of the thread, e.g. Scheduler::FIFO for real-time threads. When no scheduler is
+    ///        set the scheduling of the creating thread is inherited.
+    IOX_BUILDER_PARAMETER(optional<detail::Scheduler>, scheduler, nullopt)
+
+    /// @brief Set the priority of the thread. It is only applied when a scheduler is set and must be in the range of
+    ///        detail::getSchedulerPriorityMinimum and detail::getSchedulerPriorityMaximum of that scheduler.
+    IOX_BUILDER_PARAMETER(int32_t, priority, 0)
+
   public:
     /// @brief Creates a thread
     /// @param[in] uninitializedThread is an iox::optional where the thread is stored
     /// @param[in] callable is the callable that is invoked by the thread
     /// @return an error describing the failure or success
+    /// @note The CPU affinity and the scheduling parameters are applied before the callable is invoked. If they cannot
+    ///       be applied, the callable is never invoked and the error is returned.
     expected<void, ThreadError> create(optional<Thread>& uninitializedThread,
                                        const Thread::callable_t& callable) noexcept;
+
+  private:
+    bool hasSchedulingParameters() const noexcept;
+    expected<void, ThreadError> applySchedulingParameters(iox_pthread_t threadHandle) const noexcept;
 };
 
 } // namespace iox
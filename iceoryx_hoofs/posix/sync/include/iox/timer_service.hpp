@@ -0,0 +1,145 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_POSIX_SYNC_TIMER_SERVICE_HPP
+#define IOX_HOOFS_POSIX_SYNC_TIMER_SERVICE_HPP
+
+#include "iox/duration.hpp"
+#include "iox/function_ref.hpp"
+#include "iox/optional.hpp"
+#include "iox/thread.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace iox
+{
+namespace concurrent
+{
+/// @brief The TimerService executes many periodic and one-shot timers on a single thread instead of spawning one
+/// thread per timer. The thread is started with the first timer and runs until the TimerService is destroyed.
+/// @code
+/// #include <iox/timer_service.hpp>
+///
+/// void sendHeartbeat();
+///
+/// int main()
+/// {
+///     using namespace iox::units::duration_literals;
+///     auto& timerService = iox::concurrent::TimerService::getInstance();
+///     auto heartbeatTimer = timerService.addPeriodicTimer(100_ms, sendHeartbeat);
+///
+///     // ...
+///
+///     heartbeatTimer.and_then([&](auto& id) { timerService.removeTimer(id); });
+///     return 0;
+/// }
+/// @endcode
+/// @note All callables share one thread; a slow callable delays all other timers of the TimerService. Tasks with real
+/// time requirements should therefore use a dedicated thread, e.g. a 'PeriodicTask' without a TimerService.
+class TimerService
+{
+  public:
+    using TimerId = uint64_t;
+
+    static constexpr uint64_t MAX_NUMBER_OF_TIMERS{128U};
+
+    /// @brief Creates a TimerService without timers; no thread is spawned until the first timer is added
+    TimerService() noexcept = default;
+
+    /// @brief Stops and joins the thread of the TimerService; timers which are still registered are discarded
+    /// @note This is blocking and the blocking time depends on the currently executed callable.
+    ~TimerService() noexcept;
+
+    TimerService(const TimerService&) = delete;
+    TimerService(TimerService&&) = delete;
+
+    TimerService& operator=(const TimerService&) = delete;
+    TimerService& operator=(TimerService&&) = delete;
+
+    /// @brief Returns the process wide TimerService which is shared by all periodic tasks
+    static TimerService& getInstance() noexcept;
+
+    /// @brief Adds a timer which executes the callable immediately and then periodically after the interval.
+    /// If the execution of the callable takes longer than the interval, the missed executions are skipped.
+    /// @param[in] interval is the time between the start of two executions of the callable
+    /// @param[in] callable is executed by the thread of the TimerService; it must outlive the timer
+    /// @return the id of the timer or an empty optional if the maximum number of timers is reached
+    optional<TimerId> addPeriodicTimer(const units::Duration interval, const function_ref<void()> callable) noexcept;
+
+    /// @brief Adds a timer which executes the callable once after the delay. The timer is removed automatically
+    /// after the execution.
+    /// @param[in] delay is the time until the callable is executed
+    /// @param[in] callable is executed by the thread of the TimerService; it must outlive the timer
+    /// @return the id of the timer or an empty optional if the maximum number of timers is reached
+    optional<TimerId> addOneShotTimer(const units::Duration delay, const function_ref<void()> callable) noexcept;
+
+    /// @brief Removes a timer. When this method returns, the callable of the timer is not executed anymore.
+    /// @param[in] id of the timer; removing an already removed or expired one-shot timer does nothing
+    /// @attention This blocks until the currently running execution of the callable is finished unless it is called
+    /// from within the callable itself.
+    void removeTimer(const TimerId id) noexcept;
+
+    /// @brief Returns the number of registered timers
+    uint64_t numberOfTimers() const noexcept;
+
+    /// @brief Sets the CPU affinity and the scheduling of the thread of the TimerService, e.g. to keep the periodic
+    /// tasks of iceoryx away from the CPU cores of latency critical threads. The parameters are applied by the thread
+    /// itself, i.e. immediately when it is running or when it is started with the first timer.
+    /// @param[in] parameters the scheduling parameters of the thread
+    void setThreadSchedulingParameters(const ThreadSchedulingParameters& parameters) noexcept;
+
+  private:
+    struct Timer
+    {
+        optional<function_ref<void()>> callable;
+        units::Duration interval{units::Duration::fromNanoseconds(0U)};
+        std::chrono::steady_clock::time_point deadline;
+        bool isPeriodic{false};
+        uint32_t generation{0U};
+    };
+
+    optional<TimerId> addTimer(const units::Duration firstExecution,
+                               const units::Duration interval,
+                               const bool isPeriodic,
+                               const function_ref<void()> callable) noexcept;
+
+    void run() noexcept;
+
+    static TimerId toTimerId(const uint64_t index, const uint32_t generation) noexcept;
+
+  private:
+    static constexpr uint64_t NO_TIMER{MAX_NUMBER_OF_TIMERS};
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_timersChanged;
+    std::condition_variable m_executionFinished;
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays)
+    Timer m_timers[MAX_NUMBER_OF_TIMERS];
+    uint64_t m_numberOfTimers{0U};
+    uint64_t m_executingTimer{NO_TIMER};
+    bool m_keepRunning{true};
+    optional<ThreadSchedulingParameters> m_pendingSchedulingParameters;
+    std::thread m_thread;
+};
+
+} // namespace concurrent
+} // namespace iox
+
+#endif // IOX_HOOFS_POSIX_SYNC_TIMER_SERVICE_HPP
@@ -0,0 +1,149 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/futex_semaphore.hpp"
+
+#if defined(IOX_FUTEX_SEMAPHORE_AVAILABLE)
+
+#include "iceoryx_platform/errno.hpp"
+#include "iceoryx_platform/time.hpp"
+#include "iox/logging.hpp"
+
+#include <climits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace iox
+{
+namespace
+{
+constexpr uint32_t IS_SET{1U};
+constexpr uint32_t HAS_SLEEPING_THREADS{2U};
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "The futex word must be a plain 32 bit integer");
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "The futex word must be lock free");
+
+// the futex is not private since it is shared between processes; without FUTEX_CLOCK_REALTIME the absolute timeout
+// of FUTEX_WAIT_BITSET is measured against CLOCK_MONOTONIC
+long futex(std::atomic<uint32_t>& futexWord,
+           const int operation,
+           const uint32_t value,
+           const struct timespec* timeout,
+           const uint32_t bitset) noexcept
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) the kernel operates on the underlying integer
+    auto* word = reinterpret_cast<uint32_t*>(&futexWord);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg) the syscall interface is variadic
+    return syscall(SYS_futex, word, operation, value, timeout, nullptr, bitset);
+}
+
+SemaphoreError logFutexError(const char* operation, const int errnum) noexcept
+{
+    IOX_LOG(ERROR, "The futex operation '" << operation << "' failed with errno " << errnum);
+    return (errnum == ENOSYS) ? SemaphoreError::UNDEFINED : SemaphoreError::INVALID_SEMAPHORE_HANDLE;
+}
+} // namespace
+
+expected<void, SemaphoreError> FutexSemaphore::post() noexcept
+{
+    // the read-modify-write synchronizes with the reset of the waiting thread; a plain load of an already set word
+    // could miss a concurrent reset and the waiting thread would not see the data which was written before 'post'
+    const auto previousValue = m_futexWord.exchange(IS_SET, std::memory_order_acq_rel);
+    if ((previousValue & HAS_SLEEPING_THREADS) == 0U)
+    {
+        return ok();
+    }
+
+    if (futex(m_futexWord, FUTEX_WAKE, INT_MAX, nullptr, 0U) == -1)
+    {
+        return err(logFutexError("wake", errno));
+    }
+    return ok();
+}
+
+expected<void, SemaphoreError> FutexSemaphore::wait() noexcept
+{
+    auto result = waitUntil(nullptr);
+    if (result.has_error())
+    {
+        return err(result.error());
+    }
+    return ok();
+}
+
+expected<bool, SemaphoreError> FutexSemaphore::tryWait() noexcept
+{
+    return ok(tryReset());
+}
+
+expected<SemaphoreWaitState, SemaphoreError> FutexSemaphore::timedWait(const units::Duration& timeout) noexcept
+{
+    const struct timespec deadline = timeout.timespec(units::TimeSpecReference::Monotonic);
+    return waitUntil(&deadline);
+}
+
+bool FutexSemaphore::tryReset() noexcept
+{
+    auto value = m_futexWord.load(std::memory_order_relaxed);
+    while ((value & IS_SET) != 0U)
+    {
+        if (m_futexWord.compare_exchange_weak(
+                value, value & ~IS_SET, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+expected<SemaphoreWaitState, SemaphoreError> FutexSemaphore::waitUntil(const struct timespec* deadline) noexcept
+{
+    while (true)
+    {
+        if (tryReset())
+        {
+            return ok(SemaphoreWaitState::NO_TIMEOUT);
+        }
+
+        // the flag announces the sleeping thread to 'post'; the kernel puts the thread only to sleep when the word
+        // is unchanged, therefore a 'post' between the flag and the syscall is not lost
+        uint32_t expectedValue{0U};
+        if (!m_futexWord.compare_exchange_strong(
+                expectedValue, HAS_SLEEPING_THREADS, std::memory_order_relaxed, std::memory_order_relaxed)
+            && expectedValue != HAS_SLEEPING_THREADS)
+        {
+            continue;
+        }
+
+        if (futex(m_futexWord, FUTEX_WAIT_BITSET, HAS_SLEEPING_THREADS, deadline, FUTEX_BITSET_MATCH_ANY) == -1)
+        {
+            const auto errnum = errno;
+            if (errnum == ETIMEDOUT)
+            {
+                return ok(tryReset() ? SemaphoreWaitState::NO_TIMEOUT : SemaphoreWaitState::TIMEOUT);
+            }
+            if (errnum != EAGAIN && errnum != EINTR)
+            {
+                return err(logFutexError("wait", errnum));
+            }
+        }
+    }
+}
+
+} // namespace iox
+
+#endif // IOX_FUTEX_SEMAPHORE_AVAILABLE
@@ -60,6 +60,20 @@ expected<void, ThreadError> ThreadBuilder::create(optional<Thread>& uninitialize
 {
     uninitializedThread.emplace(m_name, callable);
 
+    if (hasSchedulingParameters())
+    {
+        if (UnnamedSemaphoreBuilder()
+                .initialValue(0U)
+                .isInterProcessCapable(false)
+                .create(uninitializedThread->m_startSemaphore)
+                .has_error())
+        {
+            IOX_LOG(ERROR, "Unable to create the semaphore which synchronizes the start of the thread");
+            uninitializedThread.reset();
+            return err(ThreadError::INSUFFICIENT_RESOURCES);
+        }
+    }
+
     const iox_pthread_attr_t* threadAttributes = nullptr;
 
     auto createResult =
@@ -74,8 +88,75 @@ expected<void, ThreadError> ThreadBuilder::create(optional<Thread>& uninitialize
         return err(Thread::errnoToEnum(createResult.error().errnum));
     }
 
+    if (uninitializedThread->m_startSemaphore.has_value())
+    {
+        auto schedulingResult = applySchedulingParameters(uninitializedThread->m_threadHandle);
+        uninitializedThread->m_isStartPermitted = !schedulingResult.has_error();
+        IOX_ENFORCE(!uninitializedThread->m_startSemaphore->post().has_error(),
+                    "Releasing the start semaphore of a newly created thread");
+
+        if (schedulingResult.has_error())
+        {
+            uninitializedThread.reset();
+            return schedulingResult;
+        }
+    }
+
+    return ok();
+}
+
+bool ThreadBuilder::hasSchedulingParameters() const noexcept
+{
+    return m_cpuAffinityMask != 0U || m_scheduler.has_value();
+}
+
+expected<void, ThreadError> ThreadBuilder::applySchedulingParameters(iox_pthread_t threadHandle) const noexcept
+{
+    return detail::applyThreadSchedulingParameters(threadHandle, {m_cpuAffinityMask, m_scheduler, m_priority}, m_name);
+}
+
+expected<void, ThreadError> setThreadSchedulingParameters(const ThreadSchedulingParameters& parameters) noexcept
+{
+    return detail::applyThreadSchedulingParameters(iox_pthread_self(), parameters, getThreadName());
+}
+
+namespace detail
+{
+expected<void, ThreadError> applyThreadSchedulingParameters(iox_pthread_t threadHandle,
+                                                            const ThreadSchedulingParameters& parameters,
+                                                            const ThreadName_t& name) noexcept
+{
+    if (parameters.cpuAffinityMask != 0U)
+    {
+        auto affinityResult = IOX_POSIX_CALL(iox_pthread_setaffinity)(threadHandle, parameters.cpuAffinityMask)
+                                  .returnValueMatchesErrno()
+                                  .evaluate();
+        if (affinityResult.has_error())
+        {
+            IOX_LOG(ERROR,
+                    "Unable to set the CPU affinity mask " << iox::log::hex(parameters.cpuAffinityMask)
+                                                           << " of thread '" << name << "'");
+            return err(Thread::errnoToEnum(affinityResult.error().errnum));
+        }
+    }
+
+    if (parameters.scheduler.has_value())
+    {
+        auto schedulerResult = IOX_POSIX_CALL(iox_pthread_setschedparam)(
+                                   threadHandle, static_cast<int>(parameters.scheduler.value()), parameters.priority)
+                                   .returnValueMatchesErrno()
+                                   .evaluate();
+        if (schedulerResult.has_error())
+        {
+            IOX_LOG(ERROR,
+                    "Unable to set the scheduling priority " << parameters.priority << " of thread '" << name << "'");
+            return err(Thread::errnoToEnum(schedulerResult.error().errnum));
+        }
+    }
+
     return ok();
 }
+} // namespace detail
 
 Thread::Thread(const ThreadName_t& name, const callable_t& callable) noexcept
     : m_threadHandle{}
@@ -128,6 +209,9 @@ ThreadError Thread::errnoToEnum(const int errnoValue) noexcept
     case EPERM:
         IOX_LOG(ERROR, "no appropriate permission to set required scheduling policy or parameters");
         return ThreadError::INSUFFICIENT_PERMISSIONS;
+    case ENOTSUP:
+        IOX_LOG(ERROR, "the requested scheduling parameters are not supported by the platform");
+        return ThreadError::UNSUPPORTED_BY_PLATFORM;
     default:
         IOX_LOG(ERROR, "an unexpected error occurred in thread - this should never happen!");
         return ThreadError::UNDEFINED;
@@ -138,6 +222,15 @@ void* Thread::startRoutine(void* callable)
 {
     auto* self = static_cast<Thread*>(callable);
 
+    if (self->m_startSemaphore.has_value())
+    {
+        IOX_ENFORCE(!self->m_startSemaphore->wait().has_error(), "Waiting for the start of the thread");
+        if (!self->m_isStartPermitted)
+        {
+            return nullptr;
+        }
+    }
+
     if (!setThreadName(self->m_threadName))
     {
         self->m_threadName.clear();
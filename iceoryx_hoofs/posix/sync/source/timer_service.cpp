@@ -0,0 +1,224 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/timer_service.hpp"
+#include "iox/attributes.hpp"
+
+namespace iox
+{
+namespace concurrent
+{
+namespace
+{
+constexpr uint64_t GENERATION_SHIFT{32U};
+constexpr uint64_t INDEX_MASK{(static_cast<uint64_t>(1U) << GENERATION_SHIFT) - 1U};
+
+std::chrono::nanoseconds toChrono(const units::Duration duration) noexcept
+{
+    return std::chrono::nanoseconds(duration.toNanoseconds());
+}
+} // namespace
+
+TimerService::~TimerService() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_keepRunning = false;
+    }
+    m_timersChanged.notify_one();
+
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+}
+
+TimerService& TimerService::getInstance() noexcept
+{
+    static TimerService instance;
+    return instance;
+}
+
+optional<TimerService::TimerId> TimerService::addPeriodicTimer(const units::Duration interval,
+                                                               const function_ref<void()> callable) noexcept
+{
+    return addTimer(units::Duration::fromNanoseconds(0U), interval, true, callable);
+}
+
+optional<TimerService::TimerId> TimerService::addOneShotTimer(const units::Duration delay,
+                                                              const function_ref<void()> callable) noexcept
+{
+    return addTimer(delay, units::Duration::fromNanoseconds(0U), false, callable);
+}
+
+optional<TimerService::TimerId> TimerService::addTimer(const units::Duration firstExecution,
+                                                       const units::Duration interval,
+                                                       const bool isPeriodic,
+                                                       const function_ref<void()> callable) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (uint64_t index = 0U; index < MAX_NUMBER_OF_TIMERS; ++index)
+    {
+        auto& timer = m_timers[index];
+        if (timer.callable.has_value())
+        {
+            continue;
+        }
+
+        timer.callable.emplace(callable);
+        timer.interval = interval;
+        timer.deadline = std::chrono::steady_clock::now() + toChrono(firstExecution);
+        timer.isPeriodic = isPeriodic;
+        ++m_numberOfTimers;
+
+        if (!m_thread.joinable())
+        {
+            m_thread = std::thread(&TimerService::run, this);
+        }
+        m_timersChanged.notify_one();
+
+        return toTimerId(index, timer.generation);
+    }
+
+    return nullopt;
+}
+
+void TimerService::removeTimer(const TimerId id) noexcept
+{
+    const auto index = id & INDEX_MASK;
+    const auto generation = static_cast<uint32_t>(id >> GENERATION_SHIFT);
+    if (index >= MAX_NUMBER_OF_TIMERS)
+    {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto& timer = m_timers[index];
+    if (!timer.callable.has_value() || timer.generation != generation)
+    {
+        return;
+    }
+
+    timer.callable.reset();
+    ++timer.generation;
+    --m_numberOfTimers;
+
+    // the thread of the TimerService would wait for itself when a callable removes its own timer
+    if (std::this_thread::get_id() != m_thread.get_id())
+    {
+        m_executionFinished.wait(lock, [&] { return m_executingTimer != index; });
+    }
+}
+
+uint64_t TimerService::numberOfTimers() const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_numberOfTimers;
+}
+
+void TimerService::setThreadSchedulingParameters(const ThreadSchedulingParameters& parameters) noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pendingSchedulingParameters.emplace(parameters);
+    }
+    m_timersChanged.notify_one();
+}
+
+TimerService::TimerId TimerService::toTimerId(const uint64_t index, const uint32_t generation) noexcept
+{
+    return (static_cast<uint64_t>(generation) << GENERATION_SHIFT) | index;
+}
+
+void TimerService::run() noexcept
+{
+    setThreadName("TimerService");
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (m_keepRunning)
+    {
+        if (m_pendingSchedulingParameters.has_value())
+        {
+            // a failure is already logged and the thread continues with its current scheduling
+            IOX_DISCARD_RESULT(iox::setThreadSchedulingParameters(m_pendingSchedulingParameters.value()));
+            m_pendingSchedulingParameters.reset();
+        }
+
+        uint64_t nextTimer{NO_TIMER};
+        for (uint64_t index = 0U; index < MAX_NUMBER_OF_TIMERS; ++index)
+        {
+            const auto& timer = m_timers[index];
+            if (timer.callable.has_value()
+                && (nextTimer == NO_TIMER || timer.deadline < m_timers[nextTimer].deadline))
+            {
+                nextTimer = index;
+            }
+        }
+
+        if (nextTimer == NO_TIMER)
+        {
+            m_timersChanged.wait(lock);
+            continue;
+        }
+
+        auto& timer = m_timers[nextTimer];
+        const auto deadline = timer.deadline;
+        if (std::chrono::steady_clock::now() < deadline)
+        {
+            // a timer which was added or removed in the meantime requires a new search for the next timer
+            m_timersChanged.wait_until(lock, deadline);
+            continue;
+        }
+
+        // the callable is executed without holding the lock, to be able to add and remove timers concurrently;
+        // 'removeTimer' waits for 'm_executingTimer' to ensure that the callable is not used after the removal
+        const auto callable = timer.callable.value();
+        const auto generation = timer.generation;
+        m_executingTimer = nextTimer;
+        lock.unlock();
+
+        callable();
+
+        lock.lock();
+        m_executingTimer = NO_TIMER;
+        m_executionFinished.notify_all();
+
+        if (!timer.callable.has_value() || timer.generation != generation)
+        {
+            continue;
+        }
+
+        if (timer.isPeriodic)
+        {
+            timer.deadline += toChrono(timer.interval);
+            const auto afterExecution = std::chrono::steady_clock::now();
+            if (timer.deadline < afterExecution)
+            {
+                timer.deadline = afterExecution + toChrono(timer.interval);
+            }
+        }
+        else
+        {
+            timer.callable.reset();
+            ++timer.generation;
+            --m_numberOfTimers;
+        }
+    }
+}
+
+} // namespace concurrent
+} // namespace iox
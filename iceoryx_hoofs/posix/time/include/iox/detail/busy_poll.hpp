@@ -0,0 +1,50 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_TIME_BUSY_POLL_HPP
+#define IOX_HOOFS_TIME_BUSY_POLL_HPP
+
+#include "iox/duration.hpp"
+
+namespace iox
+{
+namespace detail
+{
+/// @brief Tells the CPU that the calling thread is in a busy waiting loop. On x86 and ARM this releases resources to
+/// the sibling hardware thread and reduces the power consumption without giving up the time slice.
+void cpuRelax() noexcept;
+
+/// @brief Polls a condition without blocking until it is satisfied or the budget is exhausted. This trades CPU time
+/// for latency, since a thread which is woken up by the operating system pays for the syscall and the scheduling.
+/// @code
+///   // spin for at most 10us before blocking on the semaphore
+///   if (!iox::detail::busyPoll(10_us, [&] { return hasData(); }))
+///   {
+///       semaphore.wait();
+///   }
+/// @endcode
+/// @param[in] budget is the maximum time the condition is polled; with a budget of zero the condition is checked once
+/// @param[in] condition callable which returns true when the polling shall stop
+/// @return true if the condition was satisfied within the budget, otherwise false
+template <typename Condition>
+bool busyPoll(const units::Duration budget, const Condition& condition) noexcept;
+
+} // namespace detail
+} // namespace iox
+
+#include "iox/detail/busy_poll.inl"
+
+#endif // IOX_HOOFS_TIME_BUSY_POLL_HPP
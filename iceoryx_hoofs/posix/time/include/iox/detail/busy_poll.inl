@@ -0,0 +1,79 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_TIME_BUSY_POLL_INL
+#define IOX_HOOFS_TIME_BUSY_POLL_INL
+
+#include "iox/detail/busy_poll.hpp"
+
+#include <chrono>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+namespace iox
+{
+namespace detail
+{
+inline void cpuRelax() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield" ::: "memory");
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_pause();
+#endif
+}
+
+template <typename Condition>
+inline bool busyPoll(const units::Duration budget, const Condition& condition) noexcept
+{
+    if (condition())
+    {
+        return true;
+    }
+    if (budget == units::Duration::fromNanoseconds(0U))
+    {
+        return false;
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::nanoseconds(budget.toNanoseconds());
+    // the clock is read only every few iterations since reading it is more expensive than checking the condition
+    constexpr uint64_t ITERATIONS_PER_CLOCK_READ{16U};
+    while (true)
+    {
+        for (uint64_t i = 0U; i < ITERATIONS_PER_CLOCK_READ; ++i)
+        {
+            cpuRelax();
+            if (condition())
+            {
+                return true;
+            }
+        }
+
+        if (std::chrono::steady_clock::now() >= deadline)
+        {
+            return false;
+        }
+    }
+}
+
+} // namespace detail
+} // namespace iox
+
+#endif // IOX_HOOFS_TIME_BUSY_POLL_INL
@@ -28,7 +28,8 @@ namespace detail
 /// @brief Defines all supported scheduler
 enum class Scheduler : int32_t
 {
-    FIFO = SCHED_FIFO
+    FIFO = SCHED_FIFO,
+    RR = SCHED_RR
 };
 
 /// @brief Returns the minimum priority of the provided scheduler
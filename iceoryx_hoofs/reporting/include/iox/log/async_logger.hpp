@@ -0,0 +1,106 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_REPORTING_LOG_ASYNC_LOGGER_HPP
+#define IOX_HOOFS_REPORTING_LOG_ASYNC_LOGGER_HPP
+
+#include "iceoryx_platform/unistd.hpp"
+#include "iox/log/logger.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <ctime>
+#include <thread>
+
+namespace iox
+{
+namespace log
+{
+/// @brief A logger which moves the expensive parts of logging off the calling thread. The log message is copied in
+/// binary form together with the raw timestamp and the log level into a lock-free ring buffer owned by the calling
+/// thread. A background thread drains the ring buffers, formats the message header and writes the messages in batches
+/// to the provided file descriptor. When the ring buffer of a thread is full, the message is dropped and counted; the
+/// number of dropped messages is reported in the output by the background thread.
+/// @code
+/// static iox::log::AsyncLogger logger;
+/// iox::log::Logger::setActiveLogger(logger);
+/// iox::log::Logger::init();
+/// @endcode
+/// @note The ring buffers are shared by all instances of the AsyncLogger, therefore there must not be more than one
+/// instance at a time. The instance must outlive all log calls.
+class AsyncLogger : public Logger
+{
+  public:
+    /// @brief the number of threads which can log concurrently; further threads drop their messages until a thread
+    /// with a ring buffer has terminated
+    static constexpr uint32_t MAX_NUMBER_OF_THREADS{32U};
+    /// @brief the capacity of the ring buffer of a single thread in bytes
+    static constexpr uint64_t RING_BUFFER_CAPACITY{8192U};
+    /// @brief the maximum size of a log message; longer messages are truncated
+    static constexpr uint32_t MAX_MESSAGE_SIZE{1024U};
+
+    /// @brief Creates the logger and starts the background thread
+    /// @param[in] fileDescriptor to which the messages are written; the ownership stays with the caller and the file
+    /// descriptor must be valid for the lifetime of the logger
+    explicit AsyncLogger(const int fileDescriptor = STDOUT_FILENO) noexcept;
+
+    /// @brief Writes all pending messages and stops the background thread
+    ~AsyncLogger() noexcept override;
+
+    AsyncLogger(const AsyncLogger&) = delete;
+    AsyncLogger(AsyncLogger&&) = delete;
+
+    AsyncLogger& operator=(const AsyncLogger&) = delete;
+    AsyncLogger& operator=(AsyncLogger&&) = delete;
+
+    /// @brief Returns the number of messages which were dropped since the creation of the logger
+    /// @return number of dropped messages
+    uint64_t numberOfDroppedMessages() const noexcept;
+
+  protected:
+    // AXIVION Next Construct AutosarC++19_03-A3.9.1 : See at declaration in ConsoleLogger
+    void createLogMessageHeader(const char* file,
+                                const int line,
+                                const char* function,
+                                LogLevel logLevel) noexcept override;
+
+    void flush() noexcept override;
+
+  private:
+    bool pushToRingBuffer(const LogBuffer& logBuffer) noexcept;
+    void run() noexcept;
+    uint64_t drainRingBuffers() noexcept;
+    void writeBatch() noexcept;
+    void writeDroppedMessagesNotice() noexcept;
+
+  private:
+    static constexpr uint64_t BATCH_BUFFER_SIZE{16384U};
+    static constexpr uint32_t MAX_HEADER_SIZE{64U};
+
+    int m_fileDescriptor{STDOUT_FILENO};
+    std::atomic_bool m_keepRunning{true};
+    uint64_t m_reportedDroppedMessages{0U};
+    uint64_t m_droppedMessagesAtCreation{0U};
+    uint64_t m_batchSize{0U};
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) low-level buffer for the write call
+    char m_batch[BATCH_BUFFER_SIZE + 1U];
+    std::thread m_backgroundThread;
+};
+
+} // namespace log
+} // namespace iox
+
+#endif // IOX_HOOFS_REPORTING_LOG_ASYNC_LOGGER_HPP
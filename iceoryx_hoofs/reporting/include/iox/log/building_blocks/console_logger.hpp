@@ -24,6 +24,7 @@
 #include <atomic>
 #include <cstdint>
 #include <cstdio>
+#include <ctime>
 #include <mutex>
 
 namespace iox
@@ -94,6 +95,18 @@ class ConsoleLogger
 
     void logRaw(const void* const data, const uint64_t size) noexcept;
 
+    /// @brief Writes the header of a log message, i.e. the timestamp and the log level, into the provided buffer
+    /// @param[out] buffer to write the header into; it must be able to hold 'bufferSize' characters plus the null
+    /// termination
+    /// @param[in] bufferSize is the maximum number of characters which are written into the buffer
+    /// @param[in] timestamp of the log message
+    /// @param[in] logLevel of the log message
+    /// @return the number of characters written into the buffer
+    static uint32_t formatLogMessageHeader(char* buffer,
+                                           const uint32_t bufferSize,
+                                           const timespec& timestamp,
+                                           const LogLevel logLevel) noexcept;
+
   private:
     // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but as actual character
     // AXIVION Next Construct AutosarC++19_03-A18.1.1 : C-style array is used to acquire size of the array safely. Safe
@@ -0,0 +1,327 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/log/async_logger.hpp"
+#include "iceoryx_platform/time.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+namespace iox
+{
+namespace log
+{
+constexpr uint32_t AsyncLogger::MAX_NUMBER_OF_THREADS;
+constexpr uint64_t AsyncLogger::RING_BUFFER_CAPACITY;
+constexpr uint32_t AsyncLogger::MAX_MESSAGE_SIZE;
+constexpr uint64_t AsyncLogger::BATCH_BUFFER_SIZE;
+constexpr uint32_t AsyncLogger::MAX_HEADER_SIZE;
+
+namespace
+{
+/// @brief The record which precedes every log message in the ring buffer
+struct RecordHeader
+{
+    int64_t seconds{0};
+    int64_t nanoseconds{0};
+    uint32_t messageSize{0U};
+    LogLevel logLevel{LogLevel::OFF};
+};
+
+/// @brief A single producer single consumer byte ring buffer. The producer is the thread which has claimed the ring
+/// buffer and the consumer is the background thread of the AsyncLogger.
+struct RingBuffer
+{
+    std::atomic_bool isClaimed{false};
+    std::atomic<uint64_t> writePosition{0U};
+    std::atomic<uint64_t> readPosition{0U};
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) low-level byte storage
+    char data[AsyncLogger::RING_BUFFER_CAPACITY]{};
+
+    void copyInto(const uint64_t position, const void* source, const uint64_t size) noexcept
+    {
+        const auto index = position % AsyncLogger::RING_BUFFER_CAPACITY;
+        const auto sizeUntilWrapAround = std::min(size, AsyncLogger::RING_BUFFER_CAPACITY - index);
+        const auto* bytes = static_cast<const char*>(source);
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        std::memcpy(&data[index], bytes, sizeUntilWrapAround);
+        std::memcpy(&data[0], bytes + sizeUntilWrapAround, size - sizeUntilWrapAround);
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+    }
+
+    void copyFrom(const uint64_t position, void* destination, const uint64_t size) const noexcept
+    {
+        const auto index = position % AsyncLogger::RING_BUFFER_CAPACITY;
+        const auto sizeUntilWrapAround = std::min(size, AsyncLogger::RING_BUFFER_CAPACITY - index);
+        auto* bytes = static_cast<char*>(destination);
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        std::memcpy(bytes, &data[index], sizeUntilWrapAround);
+        std::memcpy(bytes + sizeUntilWrapAround, &data[0], size - sizeUntilWrapAround);
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+    }
+};
+
+/// @brief The ring buffers are not owned by the AsyncLogger since a thread might still hold a claim when the logger is
+/// destroyed; the pool is constant initialized and trivially destructible, hence it is valid for the whole lifetime of
+/// the process
+struct RingBufferPool
+{
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) must be constant initialized
+    RingBuffer ringBuffers[AsyncLogger::MAX_NUMBER_OF_THREADS];
+    std::atomic<uint64_t> droppedMessages{0U};
+};
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables) shared by all threads which are logging
+RingBufferPool g_ringBufferPool;
+
+/// @brief The per thread state of the AsyncLogger; the claim of the ring buffer is released when the thread terminates
+struct AsyncThreadLocalData
+{
+    AsyncThreadLocalData() noexcept = default;
+    AsyncThreadLocalData(const AsyncThreadLocalData&) = delete;
+    AsyncThreadLocalData(AsyncThreadLocalData&&) = delete;
+    AsyncThreadLocalData& operator=(const AsyncThreadLocalData&) = delete;
+    AsyncThreadLocalData& operator=(AsyncThreadLocalData&&) = delete;
+
+    ~AsyncThreadLocalData() noexcept
+    {
+        if (ringBuffer != nullptr)
+        {
+            ringBuffer->isClaimed.store(false, std::memory_order_release);
+        }
+    }
+
+    RingBuffer* ringBuffer{nullptr};
+    timespec timestamp{0, 0};
+    LogLevel logLevel{LogLevel::OFF};
+};
+
+AsyncThreadLocalData& getAsyncThreadLocalData() noexcept
+{
+    thread_local static AsyncThreadLocalData data;
+    return data;
+}
+
+RingBuffer* claimRingBuffer() noexcept
+{
+    for (auto& ringBuffer : g_ringBufferPool.ringBuffers)
+    {
+        bool isClaimed{false};
+        if (!ringBuffer.isClaimed.load(std::memory_order_relaxed)
+            && ringBuffer.isClaimed.compare_exchange_strong(
+                isClaimed, true, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            return &ringBuffer;
+        }
+    }
+    return nullptr;
+}
+} // namespace
+
+AsyncLogger::AsyncLogger(const int fileDescriptor) noexcept
+    : m_fileDescriptor(fileDescriptor)
+    , m_droppedMessagesAtCreation(g_ringBufferPool.droppedMessages.load(std::memory_order_relaxed))
+{
+    m_reportedDroppedMessages = m_droppedMessagesAtCreation;
+    m_backgroundThread = std::thread([this] { run(); });
+}
+
+AsyncLogger::~AsyncLogger() noexcept
+{
+    m_keepRunning.store(false, std::memory_order_relaxed);
+    if (m_backgroundThread.joinable())
+    {
+        m_backgroundThread.join();
+    }
+}
+
+uint64_t AsyncLogger::numberOfDroppedMessages() const noexcept
+{
+    return g_ringBufferPool.droppedMessages.load(std::memory_order_relaxed) - m_droppedMessagesAtCreation;
+}
+
+// AXIVION Next Construct AutosarC++19_03-A3.9.1 : See at declaration in ConsoleLogger
+void AsyncLogger::createLogMessageHeader(const char* file,
+                                         const int line,
+                                         const char* function,
+                                         LogLevel logLevel) noexcept
+{
+    static_cast<void>(file);
+    static_cast<void>(line);
+    static_cast<void>(function);
+
+    auto& data = getAsyncThreadLocalData();
+    // intentionally avoid using 'IOX_POSIX_CALL' here to keep the logger dependency free
+    if (iox_clock_gettime(CLOCK_REALTIME, &data.timestamp) != 0)
+    {
+        // a timestamp from 01.01.1970 already indicates an issue with the clock
+        data.timestamp = {0, 0};
+    }
+    data.logLevel = logLevel;
+
+    // only the message is stored in the buffer of the ConsoleLogger; the header is created by the background thread
+    assumeFlushed();
+}
+
+void AsyncLogger::flush() noexcept
+{
+    if (!pushToRingBuffer(getLogBuffer()))
+    {
+        g_ringBufferPool.droppedMessages.fetch_add(1U, std::memory_order_relaxed);
+    }
+    assumeFlushed();
+}
+
+bool AsyncLogger::pushToRingBuffer(const LogBuffer& logBuffer) noexcept
+{
+    auto& data = getAsyncThreadLocalData();
+    if (data.ringBuffer == nullptr)
+    {
+        data.ringBuffer = claimRingBuffer();
+        if (data.ringBuffer == nullptr)
+        {
+            return false;
+        }
+    }
+
+    auto& ringBuffer = *data.ringBuffer;
+    RecordHeader header;
+    header.seconds = static_cast<int64_t>(data.timestamp.tv_sec);
+    header.nanoseconds = static_cast<int64_t>(data.timestamp.tv_nsec);
+    header.messageSize = static_cast<uint32_t>(std::min<uint64_t>(logBuffer.writeIndex, MAX_MESSAGE_SIZE));
+    header.logLevel = data.logLevel;
+
+    const uint64_t recordSize{sizeof(RecordHeader) + header.messageSize};
+    const auto writePosition = ringBuffer.writePosition.load(std::memory_order_relaxed);
+    const auto readPosition = ringBuffer.readPosition.load(std::memory_order_acquire);
+    if (RING_BUFFER_CAPACITY - (writePosition - readPosition) < recordSize)
+    {
+        return false;
+    }
+
+    ringBuffer.copyInto(writePosition, &header, sizeof(RecordHeader));
+    ringBuffer.copyInto(writePosition + sizeof(RecordHeader), logBuffer.buffer, header.messageSize);
+    ringBuffer.writePosition.store(writePosition + recordSize, std::memory_order_release);
+    return true;
+}
+
+void AsyncLogger::run() noexcept
+{
+    constexpr std::chrono::milliseconds POLLING_INTERVAL{10};
+    while (m_keepRunning.load(std::memory_order_relaxed))
+    {
+        if (drainRingBuffers() == 0U)
+        {
+            std::this_thread::sleep_for(POLLING_INTERVAL);
+        }
+    }
+
+    // write the messages which were logged before the destruction of the logger
+    while (drainRingBuffers() != 0U)
+    {
+    }
+}
+
+uint64_t AsyncLogger::drainRingBuffers() noexcept
+{
+    uint64_t numberOfMessages{0U};
+    for (auto& ringBuffer : g_ringBufferPool.ringBuffers)
+    {
+        auto readPosition = ringBuffer.readPosition.load(std::memory_order_relaxed);
+        const auto writePosition = ringBuffer.writePosition.load(std::memory_order_acquire);
+        while (readPosition != writePosition)
+        {
+            RecordHeader header;
+            ringBuffer.copyFrom(readPosition, &header, sizeof(RecordHeader));
+
+            constexpr uint64_t LINE_ENDING_SIZE{1U};
+            if (m_batchSize + MAX_HEADER_SIZE + header.messageSize + LINE_ENDING_SIZE > BATCH_BUFFER_SIZE)
+            {
+                writeBatch();
+            }
+
+            timespec timestamp{0, 0};
+            timestamp.tv_sec = header.seconds;
+            timestamp.tv_nsec = header.nanoseconds;
+            // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+            m_batchSize += formatLogMessageHeader(&m_batch[m_batchSize], MAX_HEADER_SIZE, timestamp, header.logLevel);
+            ringBuffer.copyFrom(readPosition + sizeof(RecordHeader), &m_batch[m_batchSize], header.messageSize);
+            m_batchSize += header.messageSize;
+            m_batch[m_batchSize] = '\n';
+            // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+            m_batchSize += LINE_ENDING_SIZE;
+
+            readPosition += sizeof(RecordHeader) + header.messageSize;
+            ringBuffer.readPosition.store(readPosition, std::memory_order_release);
+            ++numberOfMessages;
+        }
+    }
+
+    writeDroppedMessagesNotice();
+    writeBatch();
+
+    return numberOfMessages;
+}
+
+void AsyncLogger::writeDroppedMessagesNotice() noexcept
+{
+    const auto droppedMessages = g_ringBufferPool.droppedMessages.load(std::memory_order_relaxed);
+    if (droppedMessages == m_reportedDroppedMessages)
+    {
+        return;
+    }
+
+    if (m_batchSize + MAX_HEADER_SIZE > BATCH_BUFFER_SIZE)
+    {
+        writeBatch();
+    }
+
+    // NOLINTJUSTIFICATION snprintf required to populate char array so that it can be written in one piece
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+    const auto retVal = snprintf(&m_batch[m_batchSize],
+                                 MAX_HEADER_SIZE + 1U,
+                                 "[%llu log messages dropped]\n",
+                                 static_cast<unsigned long long>(droppedMessages - m_reportedDroppedMessages));
+    if (retVal > 0)
+    {
+        m_batchSize += std::min<uint64_t>(static_cast<uint64_t>(retVal), MAX_HEADER_SIZE);
+    }
+    m_reportedDroppedMessages = droppedMessages;
+}
+
+void AsyncLogger::writeBatch() noexcept
+{
+    if (m_batchSize == 0U)
+    {
+        return;
+    }
+
+    if (iox_write(m_fileDescriptor, &m_batch[0], m_batchSize) < 0)
+    {
+        /// @todo iox-#1755 writing the log messages failed; call the error handler after the error handler refactoring
+        /// was merged
+    }
+    m_batchSize = 0U;
+}
+
+} // namespace log
+} // namespace iox
@@ -18,6 +18,7 @@
 #include "iox/detail/periodic_task.hpp"
 #include "iox/function.hpp"
 #include "iox/function_ref.hpp"
+#include "iox/timer_service.hpp"
 
 #include "test.hpp"
 
@@ -28,6 +29,7 @@ namespace
 {
 using namespace ::testing;
 using namespace iox;
+using namespace iox::concurrent;
 using namespace iox::concurrent::detail;
 using namespace iox::units::duration_literals;
 
@@ -253,4 +255,51 @@ TIMING_TEST_F(PeriodicTask_test, PeriodicTaskWhichIsExecutingTheCallableIsBlocki
 
     EXPECT_THAT(elapsedTime, Ge(SLEEP_TIME));
 })
+
+TEST_F(PeriodicTask_test, PeriodicTaskWithTimerServiceIsRegisteredAtTheTimerServiceWhileActive)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6e2a9c4f-1b7d-4f3e-8a5c-9d1f4b7e2c63");
+    TimerService timerService;
+    PeriodicTask<PeriodicTaskTestType> sut(PeriodicTaskManualStart, timerService, "Test");
+    EXPECT_THAT(sut.is_active(), Eq(false));
+    EXPECT_THAT(timerService.numberOfTimers(), Eq(0U));
+
+    sut.start(INTERVAL);
+    EXPECT_THAT(sut.is_active(), Eq(true));
+    EXPECT_THAT(timerService.numberOfTimers(), Eq(1U));
+
+    sut.stop();
+    EXPECT_THAT(sut.is_active(), Eq(false));
+    EXPECT_THAT(timerService.numberOfTimers(), Eq(0U));
+}
+
+TIMING_TEST_F(PeriodicTask_test, PeriodicTaskRunningOnTimerService, Repeat(3), [&] {
+    ::testing::Test::RecordProperty("TEST_ID", "b3d7f1a9-5c2e-4b8d-a6f4-2e9c7a1d5b38");
+    TimerService timerService;
+    {
+        PeriodicTask<PeriodicTaskTestType> sut(PeriodicTaskAutoStart, INTERVAL, timerService, "Test");
+
+        std::this_thread::sleep_for(SLEEP_TIME);
+    }
+
+    EXPECT_THAT(PeriodicTaskTestType::callCounter, AllOf(Ge(MIN_RUNS), Le(MAX_RUNS)));
+})
+
+TIMING_TEST_F(PeriodicTask_test, PeriodicTaskUsesDedicatedThreadWhenTimerServiceIsFull, Repeat(3), [&] {
+    ::testing::Test::RecordProperty("TEST_ID", "4c8e2b6d-9f1a-4d3c-b7e5-1a6d9c3f8e24");
+    TimerService timerService;
+    auto noop = [] {};
+    for (uint64_t i = 0U; i < TimerService::MAX_NUMBER_OF_TIMERS; ++i)
+    {
+        ASSERT_TRUE(timerService.addOneShotTimer(units::Duration::fromHours(1U), noop).has_value());
+    }
+    {
+        PeriodicTask<PeriodicTaskTestType> sut(PeriodicTaskAutoStart, INTERVAL, timerService, "Test");
+        EXPECT_THAT(sut.is_active(), Eq(true));
+
+        std::this_thread::sleep_for(SLEEP_TIME);
+    }
+
+    EXPECT_THAT(PeriodicTaskTestType::callCounter, AllOf(Ge(MIN_RUNS), Le(MAX_RUNS)));
+})
 } // namespace
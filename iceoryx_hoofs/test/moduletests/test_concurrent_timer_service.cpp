@@ -0,0 +1,197 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/timer_service.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::concurrent;
+using namespace iox::units::duration_literals;
+
+constexpr std::chrono::milliseconds SLEEP_TIME{100};
+constexpr units::Duration INTERVAL{10_ms};
+constexpr uint64_t MIN_RUNS{5U};
+constexpr uint64_t MAX_RUNS{15U};
+
+class TimerService_test : public Test
+{
+  public:
+    TimerService sut;
+};
+
+TEST_F(TimerService_test, TimerServiceWithoutTimersHasNoTimers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0d5e8a3c-2f7b-4c1e-9a6d-4b8f1e3c7a25");
+    EXPECT_THAT(sut.numberOfTimers(), Eq(0U));
+}
+
+TEST_F(TimerService_test, PeriodicTimerIsExecutedPeriodically)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7a3f1c9e-5b2d-4e8a-b6c4-1d9e7f3a5c82");
+    std::atomic<uint64_t> counter{0U};
+    auto callable = [&] { ++counter; };
+
+    auto id = sut.addPeriodicTimer(INTERVAL, callable);
+    ASSERT_TRUE(id.has_value());
+    std::this_thread::sleep_for(SLEEP_TIME);
+    sut.removeTimer(id.value());
+
+    EXPECT_THAT(counter.load(), Ge(MIN_RUNS));
+    EXPECT_THAT(counter.load(), Le(MAX_RUNS));
+}
+
+TEST_F(TimerService_test, RemovedTimerIsNotExecutedAnymore)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c4e9b2d7-1a6f-4c3b-8e5d-9f2a7c1e4b68");
+    std::atomic<uint64_t> counter{0U};
+    auto callable = [&] { ++counter; };
+
+    auto id = sut.addPeriodicTimer(INTERVAL, callable);
+    ASSERT_TRUE(id.has_value());
+    std::this_thread::sleep_for(SLEEP_TIME);
+    sut.removeTimer(id.value());
+    const auto counterAfterRemoval = counter.load();
+    std::this_thread::sleep_for(SLEEP_TIME);
+
+    EXPECT_THAT(counter.load(), Eq(counterAfterRemoval));
+    EXPECT_THAT(sut.numberOfTimers(), Eq(0U));
+}
+
+TEST_F(TimerService_test, OneShotTimerIsExecutedOnceAfterTheDelay)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3b8d6f1a-9c4e-4a7b-a2f5-6e1c8d3b9f47");
+    std::atomic<uint64_t> counter{0U};
+    auto callable = [&] { ++counter; };
+
+    auto id = sut.addOneShotTimer(INTERVAL * 2U, callable);
+    ASSERT_TRUE(id.has_value());
+    EXPECT_THAT(counter.load(), Eq(0U));
+    std::this_thread::sleep_for(SLEEP_TIME);
+
+    EXPECT_THAT(counter.load(), Eq(1U));
+    EXPECT_THAT(sut.numberOfTimers(), Eq(0U));
+    // removing an expired one-shot timer must be harmless
+    sut.removeTimer(id.value());
+}
+
+TEST_F(TimerService_test, TimersAreExecutedInTheOrderOfTheirDeadlines)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e1a7c3f9-4d2b-4b8e-9c6a-2f5d8b1e7c34");
+    std::vector<uint64_t> order;
+    auto first = [&] { order.push_back(1U); };
+    auto second = [&] { order.push_back(2U); };
+    auto third = [&] { order.push_back(3U); };
+
+    ASSERT_TRUE(sut.addOneShotTimer(30_ms, third).has_value());
+    ASSERT_TRUE(sut.addOneShotTimer(10_ms, first).has_value());
+    ASSERT_TRUE(sut.addOneShotTimer(20_ms, second).has_value());
+    std::this_thread::sleep_for(SLEEP_TIME);
+
+    ASSERT_THAT(sut.numberOfTimers(), Eq(0U));
+    EXPECT_THAT(order, ElementsAre(1U, 2U, 3U));
+}
+
+TEST_F(TimerService_test, AddingMoreThanTheMaximumNumberOfTimersFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5f2c8e4a-7b1d-4e9c-b3a6-8d4f2c7e1b95");
+    auto callable = [] {};
+    for (uint64_t i = 0U; i < TimerService::MAX_NUMBER_OF_TIMERS; ++i)
+    {
+        ASSERT_TRUE(sut.addOneShotTimer(1_h, callable).has_value());
+    }
+
+    EXPECT_FALSE(sut.addOneShotTimer(1_h, callable).has_value());
+    EXPECT_THAT(sut.numberOfTimers(), Eq(TimerService::MAX_NUMBER_OF_TIMERS));
+}
+
+TEST_F(TimerService_test, RemovingAStaleIdDoesNotRemoveTheTimerWhichReusesTheSlot)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9d4b1e7c-3a8f-4c2d-a5e9-7b3c1f8d4a62");
+    auto callable = [] {};
+    auto staleId = sut.addOneShotTimer(1_h, callable);
+    ASSERT_TRUE(staleId.has_value());
+    sut.removeTimer(staleId.value());
+
+    auto id = sut.addOneShotTimer(1_h, callable);
+    ASSERT_TRUE(id.has_value());
+    sut.removeTimer(staleId.value());
+
+    EXPECT_THAT(sut.numberOfTimers(), Eq(1U));
+}
+
+TEST_F(TimerService_test, TimerCanRemoveItselfFromWithinTheCallable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2c7e5a9f-8b3d-4f1a-9e6c-4a1d7b5e3c89");
+    std::atomic<uint64_t> counter{0U};
+    optional<TimerService::TimerId> id;
+    auto callable = [&] {
+        ++counter;
+        sut.removeTimer(id.value());
+    };
+
+    // the thread of the TimerService is blocked until the id is assigned since a periodic timer is executed immediately
+    std::atomic<bool> isBlocked{true};
+    auto blocker = [&] {
+        while (isBlocked.load())
+        {
+            std::this_thread::yield();
+        }
+    };
+    ASSERT_TRUE(sut.addOneShotTimer(0_ms, blocker).has_value());
+    id = sut.addPeriodicTimer(INTERVAL, callable);
+    ASSERT_TRUE(id.has_value());
+    isBlocked.store(false);
+    std::this_thread::sleep_for(SLEEP_TIME);
+
+    EXPECT_THAT(counter.load(), Eq(1U));
+    EXPECT_THAT(sut.numberOfTimers(), Eq(0U));
+}
+
+TEST_F(TimerService_test, SharedInstanceIsTheSameForAllCallers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8f1d3b6e-2c9a-4d7f-b4e1-5c8a3f9d2b16");
+    EXPECT_THAT(&TimerService::getInstance(), Eq(&TimerService::getInstance()));
+}
+
+#if defined(__linux__)
+TEST_F(TimerService_test, ThreadSchedulingParametersAreAppliedToTheThreadOfTheTimerService)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4a8c2e6f-9d1b-4f3a-b7e5-2c6f8a4d1e97");
+    constexpr uint64_t CPU_0_MASK = 1U;
+    ThreadSchedulingParameters parameters;
+    parameters.cpuAffinityMask = CPU_0_MASK;
+    sut.setThreadSchedulingParameters(parameters);
+
+    std::atomic<int> cpuOfCallable{-1};
+    auto callable = [&] { cpuOfCallable = sched_getcpu(); };
+    ASSERT_TRUE(sut.addOneShotTimer(0_ms, callable).has_value());
+    std::this_thread::sleep_for(SLEEP_TIME);
+
+    EXPECT_THAT(cpuOfCallable.load(), Eq(0));
+}
+#endif
+
+} // namespace
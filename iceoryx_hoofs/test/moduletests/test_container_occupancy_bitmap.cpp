@@ -0,0 +1,155 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/detail/occupancy_bitmap.hpp"
+
+#include "test.hpp"
+
+#include <random>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::detail;
+
+class OccupancyBitmap_test : public Test
+{
+  public:
+    // more than one summary word and a partially used last word
+    static constexpr uint64_t CAPACITY{64U * 64U + 100U};
+    using Sut = OccupancyBitmap<CAPACITY>;
+
+    static uint64_t linearFindPrevious(const std::vector<bool>& occupied, const uint64_t index, const bool value)
+    {
+        for (uint64_t i = index; i > 0U; --i)
+        {
+            if (occupied[i - 1U] == value)
+            {
+                return i - 1U;
+            }
+        }
+        return Sut::INVALID_INDEX;
+    }
+
+    Sut sut;
+};
+
+TEST_F(OccupancyBitmap_test, MostSignificantSetBitIsFound)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2b6f0e8d-4c1a-4f3b-9e7d-5a8c1b3f6e20");
+    EXPECT_THAT(mostSignificantSetBit(1U), Eq(0U));
+    EXPECT_THAT(mostSignificantSetBit(0x0FU), Eq(3U));
+    EXPECT_THAT(mostSignificantSetBit(0x1000U), Eq(12U));
+    EXPECT_THAT(mostSignificantSetBit(~static_cast<uint64_t>(0U)), Eq(63U));
+}
+
+TEST_F(OccupancyBitmap_test, AllSlotsAreInitiallyFree)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8d3a1f5c-7e2b-4a9d-b6c0-1f4e8a2d5c73");
+    EXPECT_FALSE(sut.isOccupied(0U));
+    EXPECT_FALSE(sut.isOccupied(CAPACITY - 1U));
+    EXPECT_THAT(sut.findPreviousOccupied(CAPACITY), Eq(Sut::INVALID_INDEX));
+    EXPECT_THAT(sut.findPreviousFree(CAPACITY), Eq(CAPACITY - 1U));
+}
+
+TEST_F(OccupancyBitmap_test, NoSlotPrecedesTheFirstSlot)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f0c7e4b2-9a3d-4e6f-8b1c-2d5a7f9e3b48");
+    sut.occupy(0U);
+
+    EXPECT_THAT(sut.findPreviousOccupied(0U), Eq(Sut::INVALID_INDEX));
+    EXPECT_THAT(sut.findPreviousFree(0U), Eq(Sut::INVALID_INDEX));
+}
+
+TEST_F(OccupancyBitmap_test, OccupiedSlotIsFoundAcrossWordBoundaries)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4e9b2c6a-1d8f-4b3e-a7c5-6f0d2e8b1a94");
+    sut.occupy(3U);
+    sut.occupy(64U);
+
+    EXPECT_TRUE(sut.isOccupied(3U));
+    EXPECT_THAT(sut.findPreviousOccupied(64U), Eq(3U));
+    EXPECT_THAT(sut.findPreviousOccupied(65U), Eq(64U));
+    EXPECT_THAT(sut.findPreviousOccupied(CAPACITY), Eq(64U));
+    EXPECT_THAT(sut.findPreviousOccupied(3U), Eq(Sut::INVALID_INDEX));
+}
+
+TEST_F(OccupancyBitmap_test, FreeSlotIsFoundAcrossFullWords)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b7a5d3e1-6c2f-4d8a-9e4b-0c3f7a1d5e62");
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        sut.occupy(i);
+    }
+    EXPECT_THAT(sut.findPreviousFree(CAPACITY), Eq(Sut::INVALID_INDEX));
+
+    sut.release(10U);
+
+    EXPECT_THAT(sut.findPreviousFree(CAPACITY), Eq(10U));
+    EXPECT_THAT(sut.findPreviousFree(11U), Eq(10U));
+    EXPECT_THAT(sut.findPreviousFree(10U), Eq(Sut::INVALID_INDEX));
+}
+
+TEST_F(OccupancyBitmap_test, ClearFreesAllSlots)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1c8e4a7f-3b9d-4f2a-8d6e-5b0a3c7f9e15");
+    for (uint64_t i = 0U; i < CAPACITY; i += 3U)
+    {
+        sut.occupy(i);
+    }
+
+    sut.clear();
+
+    EXPECT_THAT(sut.findPreviousOccupied(CAPACITY), Eq(Sut::INVALID_INDEX));
+    EXPECT_THAT(sut.findPreviousFree(CAPACITY), Eq(CAPACITY - 1U));
+}
+
+TEST_F(OccupancyBitmap_test, SearchResultsMatchLinearSearchOnFragmentedBitmap)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6a2d9f3c-8e1b-4c7a-b5d0-3e6f1a9c4b87");
+    std::vector<bool> occupied(CAPACITY, false);
+    std::mt19937_64 generator{42U};
+    std::uniform_int_distribution<uint64_t> indexDistribution{0U, CAPACITY - 1U};
+
+    // occupy large regions and punch sparse holes into them to get empty as well as full words
+    for (uint64_t i = 0U; i < CAPACITY / 2U; ++i)
+    {
+        sut.occupy(i);
+        occupied[i] = true;
+    }
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        const auto index = indexDistribution(generator);
+        if (occupied[index])
+        {
+            sut.release(index);
+        }
+        else
+        {
+            sut.occupy(index);
+        }
+        occupied[index] = !occupied[index];
+    }
+
+    for (uint64_t index = 0U; index <= CAPACITY; ++index)
+    {
+        ASSERT_THAT(sut.findPreviousOccupied(index), Eq(linearFindPrevious(occupied, index, true))) << index;
+        ASSERT_THAT(sut.findPreviousFree(index), Eq(linearFindPrevious(occupied, index, false))) << index;
+    }
+}
+
+} // namespace
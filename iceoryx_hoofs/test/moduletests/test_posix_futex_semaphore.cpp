@@ -0,0 +1,139 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/futex_semaphore.hpp"
+
+#if defined(IOX_FUTEX_SEMAPHORE_AVAILABLE)
+
+#include "test.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::units::duration_literals;
+
+class FutexSemaphore_test : public Test
+{
+  public:
+    FutexSemaphore sut;
+};
+
+TEST_F(FutexSemaphore_test, TryWaitOnInitialSemaphoreReturnsFalse)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1f7c4a9e-3b6d-4e2a-8c5f-9d1e7b3a6c48");
+    auto result = sut.tryWait();
+    ASSERT_FALSE(result.has_error());
+    EXPECT_FALSE(result.value());
+}
+
+TEST_F(FutexSemaphore_test, TryWaitAfterPostReturnsTrueOnlyOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8b3e6d1f-5a9c-4f7b-a2e4-6c8d1f3b9a57");
+    ASSERT_FALSE(sut.post().has_error());
+
+    EXPECT_TRUE(sut.tryWait().value());
+    EXPECT_FALSE(sut.tryWait().value());
+}
+
+TEST_F(FutexSemaphore_test, MultiplePostsAreCombinedIntoOne)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c5a9e2d7-4f1b-4b8e-9d3a-2e7f5c1a8b64");
+    ASSERT_FALSE(sut.post().has_error());
+    ASSERT_FALSE(sut.post().has_error());
+    ASSERT_FALSE(sut.post().has_error());
+
+    EXPECT_TRUE(sut.tryWait().value());
+    EXPECT_FALSE(sut.tryWait().value());
+}
+
+TEST_F(FutexSemaphore_test, WaitReturnsImmediatelyWhenSemaphoreIsSet)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3d8f1b6a-9e4c-4a2d-b7f5-1a6c9e3d8b25");
+    ASSERT_FALSE(sut.post().has_error());
+
+    EXPECT_FALSE(sut.wait().has_error());
+    EXPECT_FALSE(sut.tryWait().value());
+}
+
+TEST_F(FutexSemaphore_test, TimedWaitTimesOutWhenSemaphoreIsNotSet)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6e2a9c4f-1d7b-4e8a-a5c3-8f4b2d6e1a79");
+    constexpr std::chrono::milliseconds TIMEOUT{20};
+
+    const auto start = std::chrono::steady_clock::now();
+    auto result = sut.timedWait(20_ms);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value(), Eq(SemaphoreWaitState::TIMEOUT));
+    EXPECT_THAT(elapsed, Ge(TIMEOUT));
+}
+
+TEST_F(FutexSemaphore_test, TimedWaitReturnsNoTimeoutWhenSemaphoreIsSet)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a4d7f2b9-6c1e-4d3a-8b9f-5e2a7c4d1f86");
+    ASSERT_FALSE(sut.post().has_error());
+
+    auto result = sut.timedWait(1_h);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value(), Eq(SemaphoreWaitState::NO_TIMEOUT));
+}
+
+TEST_F(FutexSemaphore_test, WaitIsWokenUpByPostFromAnotherThread)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9c1b5e8d-2f6a-4b7c-a3d9-4e8f1b5c2a93");
+    std::atomic<bool> hasReturned{false};
+
+    std::thread waiter([&] {
+        EXPECT_FALSE(sut.wait().has_error());
+        hasReturned.store(true);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(hasReturned.load());
+    ASSERT_FALSE(sut.post().has_error());
+    waiter.join();
+
+    EXPECT_TRUE(hasReturned.load());
+}
+
+TEST_F(FutexSemaphore_test, TimedWaitIsWokenUpByPostFromAnotherThread)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2e6d9a3f-8b1c-4f5e-9a7d-3c1f6e9b4d52");
+    SemaphoreWaitState waitState{SemaphoreWaitState::TIMEOUT};
+
+    std::thread waiter([&] {
+        auto result = sut.timedWait(1_h);
+        ASSERT_FALSE(result.has_error());
+        waitState = result.value();
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ASSERT_FALSE(sut.post().has_error());
+    waiter.join();
+
+    EXPECT_THAT(waitState, Eq(SemaphoreWaitState::NO_TIMEOUT));
+}
+
+} // namespace
+
+#endif // IOX_FUTEX_SEMAPHORE_AVAILABLE
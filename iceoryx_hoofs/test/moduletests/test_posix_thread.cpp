@@ -15,10 +15,12 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_hoofs/testing/barrier.hpp"
+#include "iox/detail/posix_scheduler.hpp"
 #include "iox/duration.hpp"
 #include "iox/thread.hpp"
 #include "test.hpp"
 
+#include <atomic>
 #include <thread>
 
 namespace
@@ -113,4 +115,88 @@ TEST_F(Thread_test, SetAndGetSmallStringIsWorking)
 
     EXPECT_THAT(getResult.c_str(), StrEq(stringShorterThanThreadNameCapacitiy.c_str()));
 }
+
+#if defined(__linux__)
+TEST_F(Thread_test, CreateThreadWithCpuAffinityRunsCallableOnSelectedCpu)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6a1e29c4-5d0b-4d8e-9b43-0d4cb1f7a8e2");
+    constexpr uint64_t CPU_0_MASK = 1U;
+    int cpuOfCallable = -1;
+    ASSERT_FALSE(ThreadBuilder()
+                     .cpuAffinityMask(CPU_0_MASK)
+                     .create(sut, [&] { cpuOfCallable = sched_getcpu(); })
+                     .has_error());
+    sut.reset();
+
+    EXPECT_THAT(cpuOfCallable, Eq(0));
+}
+
+TEST_F(Thread_test, CreateThreadWithNonExistingCpuInAffinityMaskFailsAndDoesNotInvokeCallable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c3d8f0e5-7b2a-4f61-8e95-2a6f3b4c9d10");
+    if (std::thread::hardware_concurrency() >= 64U)
+    {
+        GTEST_SKIP() << "All CPUs which are representable in the affinity mask are available";
+    }
+    constexpr uint64_t CPU_63_MASK = static_cast<uint64_t>(1U) << 63U;
+    std::atomic_bool callableWasCalled{false};
+    auto result = ThreadBuilder().cpuAffinityMask(CPU_63_MASK).create(sut, [&] { callableWasCalled = true; });
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(ThreadError::INVALID_ATTRIBUTES));
+    EXPECT_FALSE(sut.has_value());
+    EXPECT_FALSE(callableWasCalled.load());
+}
+
+TEST_F(Thread_test, CreateThreadWithPriorityOutOfSchedulerRangeFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4f7b2e91-08ad-4c3e-b6d5-91e0a7c2f348");
+    const auto invalidPriority = detail::getSchedulerPriorityMaximum(detail::Scheduler::FIFO) + 1;
+    std::atomic_bool callableWasCalled{false};
+    auto result = ThreadBuilder()
+                      .scheduler(detail::Scheduler::FIFO)
+                      .priority(invalidPriority)
+                      .create(sut, [&] { callableWasCalled = true; });
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(ThreadError::INVALID_ATTRIBUTES));
+    EXPECT_FALSE(callableWasCalled.load());
+}
+TEST_F(Thread_test, SetThreadSchedulingParametersPinsCallingThreadToSelectedCpu)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b2e8d4f1-6c3a-4a9e-8f7d-1c5b9e3a7d64");
+    constexpr uint64_t CPU_0_MASK = 1U;
+    int cpuOfThread = -1;
+    bool hasError{true};
+
+    // a separate thread is used to keep the affinity of the test thread untouched
+    std::thread thread([&] {
+        ThreadSchedulingParameters parameters;
+        parameters.cpuAffinityMask = CPU_0_MASK;
+        hasError = setThreadSchedulingParameters(parameters).has_error();
+        cpuOfThread = sched_getcpu();
+    });
+    thread.join();
+
+    EXPECT_FALSE(hasError);
+    EXPECT_THAT(cpuOfThread, Eq(0));
+}
+
+TEST_F(Thread_test, SetThreadSchedulingParametersWithPriorityOutOfSchedulerRangeFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7d3a9f5e-2b8c-4e1d-a6f4-9e2c7b5a1d38");
+    optional<ThreadError> error;
+
+    std::thread thread([&] {
+        ThreadSchedulingParameters parameters;
+        parameters.scheduler = detail::Scheduler::FIFO;
+        parameters.priority = detail::getSchedulerPriorityMaximum(detail::Scheduler::FIFO) + 1;
+        setThreadSchedulingParameters(parameters).or_else([&](auto& e) { error = e; });
+    });
+    thread.join();
+
+    ASSERT_TRUE(error.has_value());
+    EXPECT_THAT(error.value(), Eq(ThreadError::INVALID_ATTRIBUTES));
+}
+#endif
 } // namespace
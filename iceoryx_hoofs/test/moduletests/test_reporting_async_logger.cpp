@@ -0,0 +1,203 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/log/async_logger.hpp"
+
+#include "iceoryx_platform/fcntl.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iox/optional.hpp"
+#include "test.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+
+class LoggerSUT : public iox::log::AsyncLogger
+{
+  public:
+    using iox::log::AsyncLogger::AsyncLogger;
+    using iox::log::AsyncLogger::createLogMessageHeader;
+    using iox::log::AsyncLogger::flush;
+    using iox::log::AsyncLogger::logString;
+
+    void log(const iox::log::LogLevel logLevel, const char* message) noexcept
+    {
+        createLogMessageHeader("file", 42, "function", logLevel);
+        logString(message);
+        flush();
+    }
+};
+
+class AsyncLogger_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        m_fileDescriptor = iox_open(LOG_FILE_NAME, O_CREAT | O_RDWR | O_TRUNC, 0664);
+        ASSERT_GE(m_fileDescriptor, 0);
+        m_sut.emplace(m_fileDescriptor);
+    }
+
+    void TearDown() override
+    {
+        m_sut.reset();
+        iox_close(m_fileDescriptor);
+        iox_unlink(LOG_FILE_NAME);
+    }
+
+    /// @brief stops the logger in order to write all pending messages and reads the log file
+    std::vector<std::string> stopLoggerAndReadLines()
+    {
+        m_droppedMessages = m_sut->numberOfDroppedMessages();
+        m_sut.reset();
+
+        std::string content;
+        iox_lseek(m_fileDescriptor, 0, SEEK_SET);
+        constexpr uint64_t READ_SIZE{4096U};
+        char buffer[READ_SIZE];
+        iox_ssize_t readBytes{0};
+        while ((readBytes = iox_read(m_fileDescriptor, &buffer[0], READ_SIZE)) > 0)
+        {
+            content.append(&buffer[0], static_cast<size_t>(readBytes));
+        }
+
+        std::vector<std::string> lines;
+        std::string::size_type start{0U};
+        std::string::size_type end{0U};
+        while ((end = content.find('\n', start)) != std::string::npos)
+        {
+            lines.emplace_back(content.substr(start, end - start));
+            start = end + 1U;
+        }
+        return lines;
+    }
+
+    static constexpr const char* LOG_FILE_NAME{"iceoryx_async_logger_output_test.txt"};
+    int m_fileDescriptor{-1};
+    uint64_t m_droppedMessages{0U};
+    iox::optional<LoggerSUT> m_sut;
+};
+
+std::vector<std::string> linesContaining(const std::vector<std::string>& lines, const std::string& text)
+{
+    std::vector<std::string> matchingLines;
+    for (const auto& line : lines)
+    {
+        if (line.find(text) != std::string::npos)
+        {
+            matchingLines.emplace_back(line);
+        }
+    }
+    return matchingLines;
+}
+
+TEST_F(AsyncLogger_test, LoggedMessageIsWrittenWithHeader)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f9c2b1e-7a6d-4c5e-9f8a-1b2c3d4e5f60");
+    constexpr const char* LOG_MESSAGE{"All glory to the hypnotoad!"};
+
+    m_sut->log(iox::log::LogLevel::WARN, LOG_MESSAGE);
+
+    const auto lines = stopLoggerAndReadLines();
+    ASSERT_THAT(lines.size(), Eq(1U));
+    EXPECT_THAT(lines[0], HasSubstr(iox::log::logLevelDisplayText(iox::log::LogLevel::WARN)));
+    EXPECT_THAT(lines[0], EndsWith(LOG_MESSAGE));
+    EXPECT_THAT(m_droppedMessages, Eq(0U));
+}
+
+TEST_F(AsyncLogger_test, MessagesOfOneThreadAreWrittenInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b7e4a1c2-5d3f-4e6a-8b9c-0d1e2f3a4b5c");
+    // the messages are small enough to fit into the ring buffer at once
+    constexpr uint64_t NUMBER_OF_MESSAGES{100U};
+
+    for (uint64_t i = 0U; i < NUMBER_OF_MESSAGES; ++i)
+    {
+        m_sut->log(iox::log::LogLevel::INFO, std::to_string(i).c_str());
+    }
+
+    const auto lines = stopLoggerAndReadLines();
+    ASSERT_THAT(lines.size(), Eq(NUMBER_OF_MESSAGES));
+    for (uint64_t i = 0U; i < NUMBER_OF_MESSAGES; ++i)
+    {
+        EXPECT_THAT(lines[i], EndsWith(" " + std::to_string(i)));
+    }
+    EXPECT_THAT(m_droppedMessages, Eq(0U));
+}
+
+TEST_F(AsyncLogger_test, MessagesOfMultipleThreadsAreWritten)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6a1d9e3f-2c4b-4d7e-a0f1-8e9d7c6b5a43");
+    // a terminated thread passes its ring buffer on to the next thread, therefore all messages must fit into a single
+    // ring buffer to prevent dropped messages
+    constexpr uint64_t NUMBER_OF_THREADS{4U};
+    constexpr uint64_t NUMBER_OF_MESSAGES_PER_THREAD{20U};
+
+    std::vector<std::thread> threads;
+    for (uint64_t t = 0U; t < NUMBER_OF_THREADS; ++t)
+    {
+        threads.emplace_back([&, t] {
+            for (uint64_t i = 0U; i < NUMBER_OF_MESSAGES_PER_THREAD; ++i)
+            {
+                m_sut->log(iox::log::LogLevel::INFO,
+                           ("thread-" + std::to_string(t) + " message-" + std::to_string(i)).c_str());
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    const auto lines = stopLoggerAndReadLines();
+    EXPECT_THAT(m_droppedMessages, Eq(0U));
+    ASSERT_THAT(lines.size(), Eq(NUMBER_OF_THREADS * NUMBER_OF_MESSAGES_PER_THREAD));
+    for (uint64_t t = 0U; t < NUMBER_OF_THREADS; ++t)
+    {
+        const auto linesOfThread = linesContaining(lines, "thread-" + std::to_string(t) + " ");
+        ASSERT_THAT(linesOfThread.size(), Eq(NUMBER_OF_MESSAGES_PER_THREAD));
+        for (uint64_t i = 0U; i < NUMBER_OF_MESSAGES_PER_THREAD; ++i)
+        {
+            EXPECT_THAT(linesOfThread[i], EndsWith("message-" + std::to_string(i)));
+        }
+    }
+}
+
+TEST_F(AsyncLogger_test, MessagesAreDroppedAndReportedWhenTheRingBufferIsFull)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d2c8f4a7-9b1e-4f3c-8d6a-5e0b1c2d3f4a");
+    // the ring buffer can hold only a few of these messages; whether a message is dropped depends on the progress of
+    // the background thread, therefore only the sum of written and dropped messages is deterministic
+    constexpr uint64_t NUMBER_OF_MESSAGES{200U};
+    const std::string message(iox::log::AsyncLogger::MAX_MESSAGE_SIZE / 2U, 'x');
+
+    for (uint64_t i = 0U; i < NUMBER_OF_MESSAGES; ++i)
+    {
+        m_sut->log(iox::log::LogLevel::INFO, message.c_str());
+    }
+
+    const auto lines = stopLoggerAndReadLines();
+    const auto droppedNotices = linesContaining(lines, "log messages dropped");
+    const auto writtenMessages = linesContaining(lines, message);
+    EXPECT_THAT(writtenMessages.size() + m_droppedMessages, Eq(NUMBER_OF_MESSAGES));
+    EXPECT_THAT(droppedNotices.empty(), Eq(m_droppedMessages == 0U));
+}
+
+} // namespace
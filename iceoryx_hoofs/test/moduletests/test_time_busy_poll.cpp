@@ -0,0 +1,81 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/detail/busy_poll.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::units::duration_literals;
+using iox::detail::busyPoll;
+
+TEST(BusyPoll_test, SatisfiedConditionReturnsImmediatelyWithoutBudget)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5a1e8c3f-7b2d-4f9a-a6c4-3d8e1b5f7a29");
+    uint64_t numberOfChecks{0U};
+
+    EXPECT_TRUE(busyPoll(0_ms, [&] {
+        ++numberOfChecks;
+        return true;
+    }));
+    EXPECT_THAT(numberOfChecks, Eq(1U));
+}
+
+TEST(BusyPoll_test, UnsatisfiedConditionIsCheckedOnceWithoutBudget)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c7f2a9d4-1e6b-4c3a-9b8f-6a2d4e9c1f73");
+    uint64_t numberOfChecks{0U};
+
+    EXPECT_FALSE(busyPoll(0_ms, [&] {
+        ++numberOfChecks;
+        return false;
+    }));
+    EXPECT_THAT(numberOfChecks, Eq(1U));
+}
+
+TEST(BusyPoll_test, UnsatisfiedConditionIsPolledForTheWholeBudget)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3e9b6d1a-8f4c-4a2e-b7d5-1c9f3a6e8b42");
+    constexpr std::chrono::milliseconds BUDGET{20};
+
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(busyPoll(20_ms, [] { return false; }));
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_THAT(elapsed, Ge(BUDGET));
+}
+
+TEST(BusyPoll_test, PollingStopsWhenTheConditionIsSatisfiedByAnotherThread)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8d4c2f7e-5a1b-4e9d-a3c6-7f2e8b4d1a95");
+    std::atomic<bool> isSatisfied{false};
+
+    std::thread notifier([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        isSatisfied.store(true);
+    });
+    EXPECT_TRUE(busyPoll(10_s, [&] { return isSatisfied.load(); }));
+    notifier.join();
+}
+
+} // namespace
@@ -21,6 +21,7 @@
 #include "iox/std_string_support.hpp"
 #include "test.hpp"
 
+#include <array>
 #include <cmath>
 #include <cstdint>
 #include <tuple>
@@ -145,6 +146,52 @@ TEST_F(convert_test, toString_StringConvertableClass)
     EXPECT_THAT(iox::convert::toString(A()), Eq("fuu"));
 }
 
+TEST_F(convert_test, toString_FloatingPointHasSixSignificantDigits)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cc307112-a5a6-4c69-8885-09300376741f");
+    EXPECT_THAT(iox::convert::toString(-12.5), Eq("-12.5"));
+    EXPECT_THAT(iox::convert::toString(1.0 / 3.0), Eq("0.333333"));
+    EXPECT_THAT(iox::convert::toString(1e20), Eq("1e+20"));
+    EXPECT_THAT(iox::convert::toString(2.5L), Eq("2.5"));
+}
+
+TEST_F(convert_test, toString_IntegerLimits)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0485ac11-427c-4544-af49-4bd9c3c08f3e");
+    EXPECT_THAT(iox::convert::toString(std::numeric_limits<int64_t>::min()), Eq("-9223372036854775808"));
+    EXPECT_THAT(iox::convert::toString(std::numeric_limits<uint64_t>::max()), Eq("18446744073709551615"));
+}
+
+TEST_F(convert_test, toString_Bool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7a60c287-de13-4c8b-953a-e1a6f59975c2");
+    EXPECT_THAT(iox::convert::toString(true), Eq("1"));
+    EXPECT_THAT(iox::convert::toString(false), Eq("0"));
+}
+
+TEST_F(convert_test, toChars_WritesNumberIntoBuffer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1d444f70-9912-4391-958e-3464295d5d83");
+    std::array<char, iox::convert::MAX_NUMBER_STRING_SIZE> buffer{};
+
+    auto length = iox::convert::to_chars(buffer.data(), buffer.data() + buffer.size(), -1337);
+    ASSERT_THAT(length.has_value(), Eq(true));
+    EXPECT_THAT(std::string(buffer.data(), length.value()), Eq("-1337"));
+
+    length = iox::convert::to_chars(buffer.data(), buffer.data() + buffer.size(), 0.125F);
+    ASSERT_THAT(length.has_value(), Eq(true));
+    EXPECT_THAT(std::string(buffer.data(), length.value()), Eq("0.125"));
+}
+
+TEST_F(convert_test, toChars_FailsWhenBufferIsTooSmall)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fa4bf178-cb0d-4005-9d9e-391d3da2a1f6");
+    std::array<char, 4U> buffer{};
+
+    EXPECT_THAT(iox::convert::to_chars(buffer.data(), buffer.data() + buffer.size(), 12345).has_value(), Eq(false));
+    EXPECT_THAT(iox::convert::to_chars(buffer.data(), buffer.data() + buffer.size(), 123.45).has_value(), Eq(false));
+}
+
 TEST_F(convert_test, FromString_String)
 {
     ::testing::Test::RecordProperty("TEST_ID", "22463da5-0fcb-4aa2-a7e5-68b863278a81");
@@ -373,6 +420,69 @@ TEST_F(convert_test, fromString_Integer_InvalidTrailingChar_Fail)
     std::apply([&expect_failure](auto... args) { (..., expect_failure(args)); }, IntegerType{});
 }
 
+TEST_F(convert_test, fromString_Integer_LeadingWhitespaceAndPlusSign_Success)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "17ae3257-07e5-4e54-b11f-e33baeba0d32");
+    for (const auto* source : {" 42", "+42", "\t +42"})
+    {
+        auto result = iox::convert::from_string<int>(source);
+        ASSERT_THAT(result.has_value(), Eq(true));
+        EXPECT_THAT(result.value(), Eq(42));
+    }
+}
+
+TEST_F(convert_test, fromString_Integer_PlusFollowedByMinus_Fail)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f5e39e0a-2f3e-4935-8a37-3f4cd1c7a82d");
+    EXPECT_THAT(iox::convert::from_string<int>("+-42").has_value(), Eq(false));
+    EXPECT_THAT(iox::convert::from_string<double>("+-42").has_value(), Eq(false));
+}
+
+TEST_F(convert_test, fromString_Double_HexadecimalNotation_Success)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5336cfc2-05bc-4938-b6cf-fa0984c885e3");
+    auto result = iox::convert::from_string<double>("0x1p3");
+    ASSERT_THAT(result.has_value(), Eq(true));
+    EXPECT_THAT(result.value(), DoubleEq(8.0));
+
+    result = iox::convert::from_string<double>("-0X1.8p1");
+    ASSERT_THAT(result.has_value(), Eq(true));
+    EXPECT_THAT(result.value(), DoubleEq(-3.0));
+}
+
+TEST_F(convert_test, fromCharsFastPath_ConvertsExactlyRepresentableNumbers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8ce13767-47a7-41dd-af03-d766e745f23f");
+#if FLT_EVAL_METHOD != 0
+    GTEST_SKIP() << "The fast path is disabled when intermediate results are calculated with a higher precision";
+#endif
+    auto fastPath = [](const std::string& source) {
+        return iox::detail::from_chars_fast_path<double>(source.data(), source.data() + source.size());
+    };
+
+    EXPECT_THAT(fastPath("123.04").value_or(0.0), Eq(123.04));
+    EXPECT_THAT(fastPath("-1e22").value_or(0.0), Eq(-1e22));
+    EXPECT_THAT(fastPath("+.5E-3").value_or(0.0), Eq(0.5e-3));
+    EXPECT_THAT(fastPath("9007199254740992").value_or(0.0), Eq(9007199254740992.0));
+
+    const std::string floatSource{"0.1"};
+    EXPECT_THAT(iox::detail::from_chars_fast_path<float>(floatSource.data(), floatSource.data() + floatSource.size())
+                    .value_or(0.0F),
+                Eq(0.1F));
+}
+
+TEST_F(convert_test, fromCharsFastPath_LeavesAllOtherInputsToTheCompleteImplementation)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fd37f037-6c14-495f-89a7-a84d755a4723");
+    for (const std::string source : {"1e23", "12345678901234567890", "inf", "nan", "0x1p3", "1.5x", "1e", ".", ""})
+    {
+        EXPECT_THAT(
+            iox::detail::from_chars_fast_path<double>(source.data(), source.data() + source.size()).has_value(),
+            Eq(false))
+            << source;
+    }
+}
+
 /// SINGED INTEGRAL EDGE CASES START
 /// inc: increment, dec: decrement
 
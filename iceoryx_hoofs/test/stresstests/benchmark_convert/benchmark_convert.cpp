@@ -0,0 +1,125 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/detail/convert.hpp"
+#include "iox/posix_call.hpp"
+
+#include "../benchmark_optional_and_expected/benchmark.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <sstream>
+
+constexpr uint64_t NUMBER_OF_INPUTS{8U};
+constexpr std::array<const char*, NUMBER_OF_INPUTS> UNSIGNED_INPUTS{
+    "0", "7", "42", "1337", "65535", "123456789", "4294967296", "18446744073709551615"};
+constexpr std::array<const char*, NUMBER_OF_INPUTS> FLOATING_POINT_INPUTS{
+    "0", "0.5", "-1.25", "3.14159", "123.04", "6.02214076e23", "-1e-7", "1.7976931348623157e308"};
+
+uint64_t globalCounter{0U};
+uint64_t inputIndex{0U};
+
+const char* nextInput(const std::array<const char*, NUMBER_OF_INPUTS>& inputs)
+{
+    inputIndex = (inputIndex + 1U) % NUMBER_OF_INPUTS;
+    return inputs[inputIndex];
+}
+
+// the previous implementation of 'from_string' and 'toString' without the range and edge case checks, which only
+// make it slower
+
+void strtoullFromString()
+{
+    const char* input = nextInput(UNSIGNED_INPUTS);
+    char* end_ptr = nullptr;
+    auto call = IOX_POSIX_CALL(strtoull)(input, &end_ptr, iox::convert::STRTOULL_BASE)
+                    .failureReturnValue(ULLONG_MAX)
+                    .ignoreErrnos(0, EINVAL, ERANGE)
+                    .evaluate();
+    globalCounter += call.has_error() ? 0U : call->value;
+}
+
+void fromCharsFromString()
+{
+    globalCounter += iox::convert::from_string<uint64_t>(nextInput(UNSIGNED_INPUTS)).value_or(0U);
+}
+
+void strtodFromString()
+{
+    const char* input = nextInput(FLOATING_POINT_INPUTS);
+    char* end_ptr = nullptr;
+    auto call = IOX_POSIX_CALL(strtod)(input, &end_ptr)
+                    .failureReturnValue(HUGE_VAL, -HUGE_VAL)
+                    .ignoreErrnos(0, EINVAL, ERANGE)
+                    .evaluate();
+    globalCounter += call.has_error() ? 0U : static_cast<uint64_t>(call->value != 0.0);
+}
+
+void fromCharsFromStringDouble()
+{
+    globalCounter += static_cast<uint64_t>(iox::convert::from_string<double>(nextInput(FLOATING_POINT_INPUTS))
+                                               .value_or(0.0)
+                                           != 0.0);
+}
+
+void stringstreamToString()
+{
+    std::stringstream ss;
+    ss << globalCounter;
+    globalCounter += ss.str().size();
+}
+
+void toCharsToString()
+{
+    globalCounter += iox::convert::toString(globalCounter).size();
+}
+
+void stringstreamToStringDouble()
+{
+    std::stringstream ss;
+    ss << static_cast<double>(globalCounter) / 7.0;
+    globalCounter += ss.str().size();
+}
+
+void toCharsToStringDouble()
+{
+    globalCounter += iox::convert::toString(static_cast<double>(globalCounter) / 7.0).size();
+}
+
+void toCharsIntoBuffer()
+{
+    std::array<char, iox::convert::MAX_NUMBER_STRING_SIZE> buffer{};
+    globalCounter += iox::convert::to_chars(buffer.data(), buffer.data() + buffer.size(), globalCounter).value_or(0U);
+}
+
+int main()
+{
+    using namespace iox::units::duration_literals;
+    auto timeout = 1_s;
+
+    BENCHMARK(strtoullFromString, timeout);
+    BENCHMARK(fromCharsFromString, timeout);
+    BENCHMARK(strtodFromString, timeout);
+    BENCHMARK(fromCharsFromStringDouble, timeout);
+    BENCHMARK(stringstreamToString, timeout);
+    BENCHMARK(toCharsToString, timeout);
+    BENCHMARK(stringstreamToStringDouble, timeout);
+    BENCHMARK(toCharsToStringDouble, timeout);
+    BENCHMARK(toCharsIntoBuffer, timeout);
+
+    return (globalCounter != 0U) ? 0 : 1;
+}
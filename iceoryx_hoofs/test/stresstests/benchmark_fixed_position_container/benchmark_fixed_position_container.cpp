@@ -0,0 +1,122 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/attributes.hpp"
+#include "iox/fixed_position_container.hpp"
+
+#include "../benchmark_optional_and_expected/benchmark.hpp"
+
+#include <cstdint>
+#include <random>
+
+constexpr uint64_t CAPACITY{16384U};
+using Container = iox::FixedPositionContainer<uint64_t, CAPACITY>;
+
+uint64_t globalCounter{0U};
+
+// the containers are filled in place since copying or moving a container compacts the elements
+
+/// @brief all slots except the first one are used; erasing the last slot requires to find the free slot at the very
+/// beginning of the container, which is the worst case of the predecessor search
+Container& containerWithLongUsedRun()
+{
+    static Container container;
+    static const bool IS_INITIALIZED = [] {
+        for (uint64_t i = 0U; i < CAPACITY; ++i)
+        {
+            IOX_DISCARD_RESULT(container.emplace(i));
+        }
+        IOX_DISCARD_RESULT(container.erase(Container::IndexType{0U}));
+        return true;
+    }();
+    static_cast<void>(IS_INITIALIZED);
+    return container;
+}
+
+/// @brief every odd slot and a random set of the even slots are used, like a port pool after many processes
+/// came and went
+Container& fragmentedContainer()
+{
+    static Container container;
+    static const bool IS_INITIALIZED = [] {
+        std::mt19937_64 generator{42U};
+        for (uint64_t i = 0U; i < CAPACITY; ++i)
+        {
+            IOX_DISCARD_RESULT(container.emplace(i));
+        }
+        for (uint64_t i = 0U; i < CAPACITY; i += 2U)
+        {
+            if (generator() % 4U != 0U)
+            {
+                IOX_DISCARD_RESULT(container.erase(static_cast<Container::IndexType>(i)));
+            }
+        }
+        return true;
+    }();
+    static_cast<void>(IS_INITIALIZED);
+    return container;
+}
+
+void eraseAndEmplaceBehindLongUsedRun()
+{
+    auto& container = containerWithLongUsedRun();
+
+    // erasing the last slot is the expensive operation; the remaining operations restore the initial state
+    auto it = container.erase(Container::Index::LAST);
+    globalCounter += it.to_index();
+    IOX_DISCARD_RESULT(container.emplace(globalCounter));
+    IOX_DISCARD_RESULT(container.emplace(globalCounter));
+    IOX_DISCARD_RESULT(container.erase(Container::IndexType{0U}));
+}
+
+void eraseAndEmplaceInFragmentedContainer()
+{
+    static std::mt19937_64 generator{13U};
+    auto& container = fragmentedContainer();
+
+    // the freed slot is not necessarily the one which is used by the emplace, therefore the fragmentation pattern
+    // changes over time but the number of used slots stays constant
+    auto index = static_cast<Container::IndexType>(generator() % CAPACITY);
+    auto it = container.iter_from_index(index);
+    while (it == container.end())
+    {
+        index = static_cast<Container::IndexType>((index + 1U) % CAPACITY);
+        it = container.iter_from_index(index);
+    }
+    IOX_DISCARD_RESULT(container.erase(it));
+    auto emplaced = container.emplace(globalCounter);
+    globalCounter += emplaced.to_index();
+}
+
+void iterateFragmentedContainer()
+{
+    for (const auto& value : fragmentedContainer())
+    {
+        globalCounter += value;
+    }
+}
+
+int main()
+{
+    using namespace iox::units::duration_literals;
+    auto timeout = 1_s;
+
+    BENCHMARK(eraseAndEmplaceBehindLongUsedRun, timeout);
+    BENCHMARK(eraseAndEmplaceInFragmentedContainer, timeout);
+    BENCHMARK(iterateFragmentedContainer, timeout);
+
+    return (globalCounter != 0U) ? 0 : 1;
+}
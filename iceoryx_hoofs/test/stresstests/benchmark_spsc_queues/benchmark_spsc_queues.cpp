@@ -0,0 +1,113 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/attributes.hpp"
+#include "iox/detail/spsc_fifo.hpp"
+#include "iox/detail/spsc_sofi.hpp"
+
+#include "../benchmark_optional_and_expected/benchmark.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+constexpr uint64_t CAPACITY{256U};
+
+iox::concurrent::SpscFifo<uint64_t, CAPACITY> fifo;
+// the storage of the sofi has one additional element, hence this is the sofi with the power of two storage
+iox::concurrent::SpscSofi<uint64_t, CAPACITY - 1U> sofi;
+
+uint64_t globalCounter{0U};
+std::atomic<uint64_t> consumedValues{0U};
+std::atomic_bool keepConsuming{true};
+
+void pushAndPopFifo()
+{
+    IOX_DISCARD_RESULT(fifo.push(globalCounter));
+    globalCounter += fifo.pop().value_or(0U);
+}
+
+void pushAndPopSofi()
+{
+    uint64_t value{0U};
+    IOX_DISCARD_RESULT(sofi.push(globalCounter, value));
+    IOX_DISCARD_RESULT(sofi.pop(value));
+    globalCounter += value;
+}
+
+void pushIntoFifoWithConcurrentConsumer()
+{
+    // a full fifo is not waited for, otherwise the result would depend on the scheduling of the consumer thread
+    if (fifo.push(globalCounter))
+    {
+        ++globalCounter;
+    }
+}
+
+void pushIntoSofiWithConcurrentConsumer()
+{
+    uint64_t overflowValue{0U};
+    if (!sofi.push(globalCounter, overflowValue))
+    {
+        globalCounter += overflowValue;
+    }
+    ++globalCounter;
+}
+
+/// @brief pops on a separate thread while the benchmarked function pushes, which puts the positions of the producer
+/// and the consumer under concurrent access
+template <typename PopFunction>
+std::thread startConsumer(const PopFunction pop)
+{
+    keepConsuming = true;
+    return std::thread([pop] {
+        while (keepConsuming.load(std::memory_order_relaxed))
+        {
+            if (pop())
+            {
+                consumedValues.fetch_add(1U, std::memory_order_relaxed);
+            }
+        }
+    });
+}
+
+void stopConsumer(std::thread& consumer)
+{
+    keepConsuming = false;
+    consumer.join();
+}
+
+int main()
+{
+    using namespace iox::units::duration_literals;
+    auto timeout = 1_s;
+
+    BENCHMARK(pushAndPopFifo, timeout);
+    BENCHMARK(pushAndPopSofi, timeout);
+
+    auto consumer = startConsumer([] { return fifo.pop().has_value(); });
+    BENCHMARK(pushIntoFifoWithConcurrentConsumer, timeout);
+    stopConsumer(consumer);
+
+    consumer = startConsumer([] {
+        uint64_t value{0U};
+        return sofi.pop(value);
+    });
+    BENCHMARK(pushIntoSofiWithConcurrentConsumer, timeout);
+    stopConsumer(consumer);
+
+    return (globalCounter != 0U && consumedValues.load() != 0U) ? 0 : 1;
+}
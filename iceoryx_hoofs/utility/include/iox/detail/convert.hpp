@@ -23,8 +23,12 @@
 #include "iox/posix_call.hpp"
 #include "iox/string.hpp"
 
+#include <array>
+#include <cfloat>
+#include <charconv>
 #include <climits>
 #include <cmath>
+#include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
@@ -32,8 +36,36 @@
 #include <sstream>
 #include <string>
 
+/// @brief Is 1 when the standard library provides 'std::from_chars' and 'std::to_chars' for floating point types;
+/// otherwise the floating point conversions fall back to a handwritten parser and to 'strtod' and 'snprintf'. It can be
+/// set to 0 in order to test the fallback on toolchains with full charconv support.
+#ifndef IOX_HOOFS_CONVERT_HAS_FLOATING_POINT_CHARCONV
+#if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage) must be usable in preprocessor conditions
+#define IOX_HOOFS_CONVERT_HAS_FLOATING_POINT_CHARCONV 1
+#else
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage) must be usable in preprocessor conditions
+#define IOX_HOOFS_CONVERT_HAS_FLOATING_POINT_CHARCONV 0
+#endif
+#endif
+
 namespace iox
 {
+namespace detail
+{
+/// @brief Parses a decimal floating point number like '-12.5e3' independent of the locale and without allocating
+/// memory. Only numbers whose significand and power of ten are both exactly representable are converted, since then
+/// the single multiplication or division yields the correctly rounded result (Clinger's fast path). For all other
+/// inputs, like 'inf', hexadecimal numbers or numbers with too many digits, nullopt is returned and the caller has to
+/// fall back to a complete implementation like 'strtod'.
+/// @tparam T is either float or double
+/// @param[in] first is the begin of the string
+/// @param[in] last is the end of the string; the whole range must be a number
+/// @return the parsed number or nullopt if the number cannot be parsed exactly with the fast path
+template <typename T>
+iox::optional<T> from_chars_fast_path(const char* first, const char* last) noexcept;
+} // namespace detail
+
 /// @brief Collection of static methods for conversion from and to string.
 /// @code
 ///     std::string number      = iox::convert::toString(123);
@@ -64,6 +96,22 @@ class convert
     static constexpr uint32_t FLOAT_SIGNALING_NAN_MASK{static_cast<uint32_t>(1) << static_cast<uint32_t>(22)};
     static constexpr uint64_t DOUBLE_SIGNALING_NAN_MASK{static_cast<uint64_t>(1) << static_cast<uint64_t>(51)};
 
+    /// @brief the size of a buffer which can hold the string representation of every number, see 'to_chars'
+    static constexpr uint64_t MAX_NUMBER_STRING_SIZE{32U};
+    /// @brief the number of significant digits of floating point numbers, which is the default of 'std::stringstream'
+    static constexpr int32_t FLOATING_POINT_PRECISION{6};
+
+    /// @brief Writes the decimal representation of a number into a buffer, independent of the locale and without
+    /// allocating memory. Floating point numbers are formatted like 'printf' with '%g', i.e. with
+    /// FLOATING_POINT_PRECISION significant digits. The string is not null-terminated.
+    /// @param Source is an arithmetic type, except for the character types
+    /// @param[in] first is the begin of the buffer
+    /// @param[in] last is the end of the buffer; MAX_NUMBER_STRING_SIZE characters are sufficient for every number
+    /// @param[in] value which should be converted
+    /// @return the number of written characters or nullopt if the buffer is too small
+    template <typename Source>
+    static iox::optional<uint64_t> to_chars(char* first, char* last, const Source value) noexcept;
+
     /// @brief Converts every type which is either a pod (plain old data) type or is convertable
     ///         to a string (this means that the operator std::string() is defined)
     /// @param Source type of the value which should be converted to a string
@@ -83,7 +131,8 @@ class convert
     toString(const Source& t) noexcept;
 
     /// @brief  convert the input based on the 'Destination', allowing only 'iox::string' and numeric types as valid
-    /// destination types
+    /// destination types; numbers are parsed with 'std::from_chars' and therefore independent of the locale and without
+    /// allocating memory, leading whitespace and a leading plus sign are accepted like with 'strtol' and 'strtod'
     /// @note   for the 'Destination' equal to 'std::string,' please include 'iox/std_string_support.hpp'
     /// @tparam Destination the desired target type for converting text
     /// @param v the input string in c type
@@ -93,6 +142,28 @@ class convert
     static iox::optional<TargetType> from_string(const char* v) noexcept;
 
   private:
+    template <typename T>
+    static constexpr bool IS_NUMBER = std::is_arithmetic_v<T> && !std::is_same_v<T, char>
+                                      && !std::is_same_v<T, wchar_t> && !std::is_same_v<T, char16_t>
+                                      && !std::is_same_v<T, char32_t>;
+
+    template <typename TargetType>
+    static iox::optional<TargetType> from_chars_integer(const char* v) noexcept;
+
+    template <typename TargetType>
+    static iox::optional<TargetType> from_chars_floating_point(const char* v) noexcept;
+
+    template <typename TargetType>
+    static iox::optional<TargetType> strto_floating_point(const char* v) noexcept;
+
+    template <typename TargetType>
+    static iox::optional<TargetType> evaluate_from_chars_result(const std::from_chars_result& result,
+                                                                const TargetType value,
+                                                                const char* last,
+                                                                const char* v) noexcept;
+
+    static const char* skip_leading_whitespace(const char* v) noexcept;
+
     template <typename TargetType, typename CallType>
     static iox::optional<TargetType> evaluate_return_value(CallType& call, const char* end_ptr, const char* v) noexcept;
 
@@ -109,7 +180,6 @@ class convert
     static bool is_within_range(const SourceType& source_val) noexcept;
 
     static bool is_valid_errno(decltype(errno) errno_cache, const char* v) noexcept;
-    static bool start_with_neg_sign(const char* v) noexcept;
 };
 
 } // namespace iox
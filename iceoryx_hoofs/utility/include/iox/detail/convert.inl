@@ -26,30 +26,191 @@
 
 namespace iox
 {
-///@brief specialization for  uint8_t and int8_t is required  since uint8_t is unsigned char and int8_t is signed char
-/// and stringstream will not convert these to string as it is already a character.
-template <>
-inline typename std::enable_if<!std::is_convertible<uint8_t, std::string>::value, std::string>::type
-convert::toString(const uint8_t& t) noexcept
+namespace detail
+{
+template <typename T>
+inline iox::optional<T> from_chars_fast_path(const char* first, const char* last) noexcept
 {
-    return toString(static_cast<uint16_t>(t));
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "Only float and double are supported");
+
+#if FLT_EVAL_METHOD != 0
+    // the intermediate results are calculated with a higher precision and the result would be rounded twice
+    static_cast<void>(first);
+    static_cast<void>(last);
+    return iox::nullopt;
+#else
+
+    constexpr uint64_t DECIMAL_BASE{10U};
+    // the largest significand and power of ten which are exactly representable
+    constexpr uint64_t MAX_SIGNIFICAND{static_cast<uint64_t>(1U)
+                                       << static_cast<uint64_t>(std::numeric_limits<T>::digits)};
+    constexpr int32_t MAX_EXACT_POWER_OF_TEN{std::is_same_v<T, float> ? 10 : 22};
+    // larger exponents are left to the complete implementation; this also prevents an overflow while parsing
+    constexpr int32_t MAX_EXPONENT{1000};
+    constexpr std::array<double, 23U> POWERS_OF_TEN{1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                                    1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                                    1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+    auto isDigit = [](const char c) { return c >= '0' && c <= '9'; };
+    auto digitValue = [](const char c) { return static_cast<uint64_t>(c - '0'); };
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic) the parser iterates over a character range
+    bool isNegative{false};
+    if (first != last && (*first == '-' || *first == '+'))
+    {
+        isNegative = (*first == '-');
+        ++first;
+    }
+
+    uint64_t significand{0U};
+    int32_t exponent{0};
+    bool hasDigits{false};
+    for (; first != last && isDigit(*first); ++first)
+    {
+        if (significand > MAX_SIGNIFICAND / DECIMAL_BASE)
+        {
+            return iox::nullopt;
+        }
+        significand = significand * DECIMAL_BASE + digitValue(*first);
+        hasDigits = true;
+    }
+    if (first != last && *first == '.')
+    {
+        for (++first; first != last && isDigit(*first); ++first)
+        {
+            if (significand > MAX_SIGNIFICAND / DECIMAL_BASE)
+            {
+                return iox::nullopt;
+            }
+            significand = significand * DECIMAL_BASE + digitValue(*first);
+            --exponent;
+            hasDigits = true;
+        }
+    }
+    if (!hasDigits)
+    {
+        return iox::nullopt;
+    }
+
+    if (first != last && (*first == 'e' || *first == 'E'))
+    {
+        ++first;
+        bool isExponentNegative{false};
+        if (first != last && (*first == '-' || *first == '+'))
+        {
+            isExponentNegative = (*first == '-');
+            ++first;
+        }
+        int32_t explicitExponent{0};
+        bool hasExponentDigits{false};
+        for (; first != last && isDigit(*first); ++first)
+        {
+            if (explicitExponent > MAX_EXPONENT)
+            {
+                return iox::nullopt;
+            }
+            explicitExponent =
+                explicitExponent * static_cast<int32_t>(DECIMAL_BASE) + static_cast<int32_t>(digitValue(*first));
+            hasExponentDigits = true;
+        }
+        if (!hasExponentDigits)
+        {
+            return iox::nullopt;
+        }
+        exponent += isExponentNegative ? -explicitExponent : explicitExponent;
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    if (first != last || significand > MAX_SIGNIFICAND || exponent < -MAX_EXACT_POWER_OF_TEN
+        || exponent > MAX_EXACT_POWER_OF_TEN)
+    {
+        return iox::nullopt;
+    }
+
+    auto value = static_cast<T>(significand);
+    const auto exactPowerOfTen = POWERS_OF_TEN[static_cast<uint64_t>(exponent < 0 ? -exponent : exponent)];
+    T powerOfTen{0};
+    if constexpr (std::is_same_v<T, float>)
+    {
+        powerOfTen = static_cast<float>(exactPowerOfTen);
+    }
+    else
+    {
+        powerOfTen = exactPowerOfTen;
+    }
+    value = (exponent < 0) ? value / powerOfTen : value * powerOfTen;
+    return iox::optional<T>(isNegative ? -value : value);
+#endif
 }
+} // namespace detail
 
-template <>
-inline typename std::enable_if<!std::is_convertible<int8_t, std::string>::value, std::string>::type
-convert::toString(const int8_t& t) noexcept
+template <typename Source>
+inline iox::optional<uint64_t> convert::to_chars(char* first, char* last, const Source value) noexcept
 {
-    return toString(static_cast<int16_t>(t));
-}
+    static_assert(IS_NUMBER<Source>, "Only arithmetic types except for the character types are supported");
 
+    if constexpr (std::is_same_v<Source, bool>)
+    {
+        return to_chars(first, last, static_cast<uint8_t>(value));
+    }
+    else if constexpr (std::is_integral_v<Source>)
+    {
+        const auto result = std::to_chars(first, last, value);
+        if (result.ec != std::errc())
+        {
+            return iox::nullopt;
+        }
+        return iox::optional<uint64_t>(static_cast<uint64_t>(result.ptr - first));
+    }
+    else
+    {
+#if IOX_HOOFS_CONVERT_HAS_FLOATING_POINT_CHARCONV
+        const auto result = std::to_chars(first, last, value, std::chars_format::general, FLOATING_POINT_PRECISION);
+        if (result.ec != std::errc())
+        {
+            return iox::nullopt;
+        }
+        return iox::optional<uint64_t>(static_cast<uint64_t>(result.ptr - first));
+#else
+        // 'snprintf' requires space for the null-termination, which is not part of the result
+        const auto size = static_cast<uint64_t>(last - first);
+        int32_t written{0};
+        if constexpr (std::is_same_v<Source, long double>)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) the fallback for toolchains without 'std::to_chars'
+            written = snprintf(first, size, "%.*Lg", FLOATING_POINT_PRECISION, value);
+        }
+        else
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) the fallback for toolchains without 'std::to_chars'
+            written = snprintf(first, size, "%.*g", FLOATING_POINT_PRECISION, static_cast<double>(value));
+        }
+        if (written < 0 || static_cast<uint64_t>(written) >= size)
+        {
+            return iox::nullopt;
+        }
+        return iox::optional<uint64_t>(static_cast<uint64_t>(written));
+#endif
+    }
+}
 
 template <typename Source>
 inline typename std::enable_if<!std::is_convertible<Source, std::string>::value, std::string>::type
 convert::toString(const Source& t) noexcept
 {
-    std::stringstream ss;
-    ss << t;
-    return ss.str();
+    if constexpr (IS_NUMBER<Source>)
+    {
+        std::array<char, MAX_NUMBER_STRING_SIZE> buffer{};
+        const auto length = to_chars(buffer.data(), buffer.data() + buffer.size(), t);
+        // the buffer is large enough for every number and the resulting string fits into the small string buffer
+        return std::string(buffer.data(), length.value_or(0U));
+    }
+    else
+    {
+        std::stringstream ss;
+        ss << t;
+        return ss.str();
+    }
 }
 
 template <typename Source>
@@ -96,217 +257,244 @@ inline iox::optional<char> convert::from_string<char>(const char* v) noexcept
 template <>
 inline iox::optional<bool> convert::from_string<bool>(const char* v) noexcept
 {
-    char* end_ptr = nullptr;
-
-    if (start_with_neg_sign(v))
+    auto value = from_chars_integer<unsigned long>(v);
+    if (!value.has_value())
     {
         return iox::nullopt;
     }
 
-    auto call = IOX_POSIX_CALL(strtoul)(v, &end_ptr, STRTOUL_BASE)
-                    .failureReturnValue(ULONG_MAX)
-                    .ignoreErrnos(0, EINVAL, ERANGE)
-                    .evaluate();
+    if (value.value() > 1U)
+    {
+        IOX_LOG(DEBUG, value.value() << " is out of range (upper bound), should be less than 1");
+        return iox::nullopt;
+    }
 
-    // we assume that in the IOX_POSIX_CALL procedure, no other POSIX call will change errno,
-    // except for the target function 'f'.
-    return evaluate_return_value<bool>(call, end_ptr, v);
+    return iox::optional<bool>(value.value() == 1U);
 }
 
 template <>
 inline iox::optional<float> convert::from_string<float>(const char* v) noexcept
 {
-    char* end_ptr = nullptr;
-
-    auto call = IOX_POSIX_CALL(strtof)(v, &end_ptr)
-                    .failureReturnValue(HUGE_VALF, -HUGE_VALF)
-                    .ignoreErrnos(0, EINVAL, ERANGE)
-                    .evaluate();
-
-    return evaluate_return_value<float>(call, end_ptr, v);
+    return from_chars_floating_point<float>(v);
 }
 
 template <>
 inline iox::optional<double> convert::from_string<double>(const char* v) noexcept
 {
-    char* end_ptr = nullptr;
-
-    auto call = IOX_POSIX_CALL(strtod)(v, &end_ptr)
-                    .failureReturnValue(HUGE_VAL, -HUGE_VAL)
-                    .ignoreErrnos(0, EINVAL, ERANGE)
-                    .evaluate();
-
-    return evaluate_return_value<double>(call, end_ptr, v);
+    return from_chars_floating_point<double>(v);
 }
 
 template <>
 inline iox::optional<long double> convert::from_string<long double>(const char* v) noexcept
 {
-    char* end_ptr = nullptr;
-
-    auto call = IOX_POSIX_CALL(strtold)(v, &end_ptr)
-                    .failureReturnValue(HUGE_VALL, -HUGE_VALL)
-                    .ignoreErrnos(0, EINVAL, ERANGE)
-                    .evaluate();
-
-    return evaluate_return_value<long double>(call, end_ptr, v);
+    return from_chars_floating_point<long double>(v);
 }
 
 template <>
 inline iox::optional<unsigned long long> convert::from_string<unsigned long long>(const char* v) noexcept
 {
-    char* end_ptr = nullptr;
-
-    if (start_with_neg_sign(v))
-    {
-        return iox::nullopt;
-    }
-
-    auto call = IOX_POSIX_CALL(strtoull)(v, &end_ptr, STRTOULL_BASE)
-                    .failureReturnValue(ULLONG_MAX)
-                    .ignoreErrnos(0, EINVAL, ERANGE)
-                    .evaluate();
-
-    return evaluate_return_value<unsigned long long>(call, end_ptr, v);
+    return from_chars_integer<unsigned long long>(v);
 }
 
 template <>
 inline iox::optional<unsigned long> convert::from_string<unsigned long>(const char* v) noexcept
 {
-    char* end_ptr = nullptr;
-
-    if (start_with_neg_sign(v))
-    {
-        return iox::nullopt;
-    }
-
-    auto call = IOX_POSIX_CALL(strtoul)(v, &end_ptr, STRTOUL_BASE)
-                    .failureReturnValue(ULONG_MAX)
-                    .ignoreErrnos(0, EINVAL, ERANGE)
-                    .evaluate();
-
-    return evaluate_return_value<unsigned long>(call, end_ptr, v);
+    return from_chars_integer<unsigned long>(v);
 }
 
 template <>
 inline iox::optional<unsigned int> convert::from_string<unsigned int>(const char* v) noexcept
 {
-    char* end_ptr = nullptr;
-
-    if (start_with_neg_sign(v))
-    {
-        return iox::nullopt;
-    }
-
-    // use alwaysSuccess for the conversion edge cases in 32-bit system?
-    auto call = IOX_POSIX_CALL(strtoul)(v, &end_ptr, STRTOUL_BASE)
-                    .failureReturnValue(ULONG_MAX)
-                    .ignoreErrnos(0, EINVAL, ERANGE)
-                    .evaluate();
-
-    return evaluate_return_value<unsigned int>(call, end_ptr, v);
+    return from_chars_integer<unsigned int>(v);
 }
 
 template <>
 inline iox::optional<unsigned short> convert::from_string<unsigned short>(const char* v) noexcept
 {
-    char* end_ptr = nullptr;
-
-    if (start_with_neg_sign(v))
-    {
-        return iox::nullopt;
-    }
-
-    auto call = IOX_POSIX_CALL(strtoul)(v, &end_ptr, STRTOUL_BASE)
-                    .failureReturnValue(ULONG_MAX)
-                    .ignoreErrnos(0, EINVAL, ERANGE)
-                    .evaluate();
-
-    return evaluate_return_value<unsigned short>(call, end_ptr, v);
+    return from_chars_integer<unsigned short>(v);
 }
 
 template <>
 inline iox::optional<unsigned char> convert::from_string<unsigned char>(const char* v) noexcept
 {
-    char* end_ptr = nullptr;
-
-    if (start_with_neg_sign(v))
-    {
-        return iox::nullopt;
-    }
-
-    auto call = IOX_POSIX_CALL(strtoul)(v, &end_ptr, STRTOULL_BASE)
-                    .failureReturnValue(ULONG_MAX)
-                    .ignoreErrnos(0, EINVAL, ERANGE)
-                    .evaluate();
-
-    return evaluate_return_value<unsigned char>(call, end_ptr, v);
+    return from_chars_integer<unsigned char>(v);
 }
 
 template <>
 inline iox::optional<long long> convert::from_string<long long>(const char* v) noexcept
 {
-    char* end_ptr = nullptr;
-
-    auto call = IOX_POSIX_CALL(strtoll)(v, &end_ptr, STRTOLL_BASE)
-                    .failureReturnValue(LLONG_MAX, LLONG_MIN)
-                    .ignoreErrnos(0, EINVAL, ERANGE)
-                    .evaluate();
-
-    return evaluate_return_value<long long>(call, end_ptr, v);
+    return from_chars_integer<long long>(v);
 }
 
 template <>
 inline iox::optional<long> convert::from_string<long>(const char* v) noexcept
 {
-    char* end_ptr = nullptr;
+    return from_chars_integer<long>(v);
+}
 
-    auto call = IOX_POSIX_CALL(strtol)(v, &end_ptr, STRTOL_BASE)
-                    .failureReturnValue(LONG_MAX, LONG_MIN)
-                    .ignoreErrnos(0, EINVAL, ERANGE)
-                    .evaluate();
+template <>
+inline iox::optional<int> convert::from_string<int>(const char* v) noexcept
+{
+    return from_chars_integer<int>(v);
+}
 
-    return evaluate_return_value<long>(call, end_ptr, v);
+template <>
+inline iox::optional<short> convert::from_string<short>(const char* v) noexcept
+{
+    return from_chars_integer<short>(v);
 }
 
 template <>
-inline iox::optional<int> convert::from_string<int>(const char* v) noexcept
+inline iox::optional<signed char> convert::from_string<signed char>(const char* v) noexcept
 {
-    char* end_ptr = nullptr;
+    return from_chars_integer<signed char>(v);
+}
 
-    // use alwaysSuccess for the conversion edge cases in 32-bit system?
-    auto call = IOX_POSIX_CALL(strtol)(v, &end_ptr, STRTOL_BASE)
-                    .failureReturnValue(LONG_MAX, LONG_MIN)
-                    .ignoreErrnos(0, EINVAL, ERANGE)
-                    .evaluate();
+template <typename TargetType>
+inline iox::optional<TargetType> convert::from_chars_integer(const char* v) noexcept
+{
+    const char* first = skip_leading_whitespace(v);
+    const char* last = first + strlen(first);
 
-    return evaluate_return_value<int>(call, end_ptr, v);
+    // 'std::from_chars' does not accept a leading plus sign
+    if (*first == '+')
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) the sign is the first character of the range
+        ++first;
+        if (*first == '-')
+        {
+            IOX_LOG(DEBUG, "invalid input");
+            return iox::nullopt;
+        }
+    }
+
+    TargetType value{0};
+    const auto result = std::from_chars(first, last, value, STRTOL_BASE);
+    return evaluate_from_chars_result(result, value, last, v);
 }
 
-template <>
-inline iox::optional<short> convert::from_string<short>(const char* v) noexcept
+template <typename TargetType>
+inline iox::optional<TargetType> convert::from_chars_floating_point(const char* v) noexcept
+{
+    const char* first = skip_leading_whitespace(v);
+    const char* last = first + strlen(first);
+
+#if IOX_HOOFS_CONVERT_HAS_FLOATING_POINT_CHARCONV
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic) the sign and prefix are part of the range
+    // 'std::from_chars' accepts neither a leading plus sign nor the '0x' prefix of hexadecimal floating point numbers,
+    // which are both accepted by 'strtod'
+    const bool isNegative = (*first == '-');
+    if (isNegative || *first == '+')
+    {
+        ++first;
+    }
+    auto format = std::chars_format::general;
+    if (first[0] == '0' && (first[1] == 'x' || first[1] == 'X'))
+    {
+        format = std::chars_format::hex;
+        first += 2;
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    if (*first == '-' || *first == '+')
+    {
+        IOX_LOG(DEBUG, "invalid input");
+        return iox::nullopt;
+    }
+
+    TargetType value{0};
+    const auto result = std::from_chars(first, last, value, format);
+    return evaluate_from_chars_result(result, isNegative ? -value : value, last, v);
+#else
+    if constexpr (!std::is_same_v<TargetType, long double>)
+    {
+        auto value = detail::from_chars_fast_path<TargetType>(first, last);
+        if (value.has_value())
+        {
+            return value;
+        }
+    }
+    return strto_floating_point<TargetType>(v);
+#endif
+}
+
+template <typename TargetType>
+inline iox::optional<TargetType> convert::strto_floating_point(const char* v) noexcept
 {
     char* end_ptr = nullptr;
 
-    auto call = IOX_POSIX_CALL(strtol)(v, &end_ptr, STRTOL_BASE)
-                    .failureReturnValue(LONG_MAX, LONG_MIN)
-                    .ignoreErrnos(0, EINVAL, ERANGE)
-                    .evaluate();
+    if constexpr (std::is_same_v<TargetType, float>)
+    {
+        auto call = IOX_POSIX_CALL(strtof)(v, &end_ptr)
+                        .failureReturnValue(HUGE_VALF, -HUGE_VALF)
+                        .ignoreErrnos(0, EINVAL, ERANGE)
+                        .evaluate();
+
+        return evaluate_return_value<float>(call, end_ptr, v);
+    }
+    else if constexpr (std::is_same_v<TargetType, double>)
+    {
+        auto call = IOX_POSIX_CALL(strtod)(v, &end_ptr)
+                        .failureReturnValue(HUGE_VAL, -HUGE_VAL)
+                        .ignoreErrnos(0, EINVAL, ERANGE)
+                        .evaluate();
 
-    return evaluate_return_value<short>(call, end_ptr, v);
+        return evaluate_return_value<double>(call, end_ptr, v);
+    }
+    else
+    {
+        auto call = IOX_POSIX_CALL(strtold)(v, &end_ptr)
+                        .failureReturnValue(HUGE_VALL, -HUGE_VALL)
+                        .ignoreErrnos(0, EINVAL, ERANGE)
+                        .evaluate();
+
+        return evaluate_return_value<long double>(call, end_ptr, v);
+    }
 }
 
-template <>
-inline iox::optional<signed char> convert::from_string<signed char>(const char* v) noexcept
+template <typename TargetType>
+inline iox::optional<TargetType> convert::evaluate_from_chars_result(const std::from_chars_result& result,
+                                                                     const TargetType value,
+                                                                     const char* last,
+                                                                     const char* v) noexcept
 {
-    char* end_ptr = nullptr;
+    if (result.ec == std::errc::invalid_argument)
+    {
+        IOX_LOG(DEBUG, "invalid input");
+        return iox::nullopt;
+    }
+
+    if (result.ec == std::errc::result_out_of_range)
+    {
+        IOX_LOG(DEBUG, "'" << v << "' is out of range");
+        return iox::nullopt;
+    }
+
+    if (result.ptr != last)
+    {
+        IOX_LOG(DEBUG, "conversion failed at " << result.ptr - v << " : " << *result.ptr);
+        return iox::nullopt;
+    }
 
-    auto call = IOX_POSIX_CALL(strtol)(v, &end_ptr, STRTOL_BASE)
-                    .failureReturnValue(LONG_MAX, LONG_MIN)
-                    .ignoreErrnos(0, EINVAL, ERANGE)
-                    .evaluate();
+    if constexpr (std::is_floating_point_v<TargetType>)
+    {
+        if (!is_within_range<TargetType>(value))
+        {
+            return iox::nullopt;
+        }
+    }
 
-    return evaluate_return_value<signed char>(call, end_ptr, v);
+    return iox::optional<TargetType>(value);
+}
+
+inline const char* convert::skip_leading_whitespace(const char* v) noexcept
+{
+    // the characters of 'isspace' in the "C" locale
+    while (*v == ' ' || *v == '\t' || *v == '\n' || *v == '\v' || *v == '\f' || *v == '\r')
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        ++v;
+    }
+    return v;
 }
 
 template <typename TargetType, typename SourceType>
@@ -396,23 +584,6 @@ inline bool convert::is_within_range(const SourceType& source_val) noexcept
     return true;
 }
 
-inline bool convert::start_with_neg_sign(const char* v) noexcept
-{
-    if (v == nullptr)
-    {
-        return false;
-    }
-
-    // remove space
-    while (*v != '\0' && (isspace((unsigned char)*v) != 0))
-    {
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        ++v;
-    }
-
-    return (*v == '-');
-}
-
 inline bool convert::is_valid_errno(decltype(errno) errno_cache, const char* v) noexcept
 {
     if (errno_cache == ERANGE)
@@ -30,6 +30,7 @@ option(EXAMPLES "Build all iceoryx examples" OFF)
 option(INTROSPECTION "Builds the introspection client which requires the ncurses library with an activated terminfo feature" OFF)
 option(ONE_TO_MANY_ONLY "Restricts communication to 1:n pattern" OFF)
 set(IOX_PLATFORM_PATH "" CACHE PATH "Overrides integrated platform detection and uses provided custom path")
+option(RECORD_REPLAY "Builds the iox-record and iox-replay tools to record topics into a file and to replay them" OFF)
 option(ROUDI_ENVIRONMENT "Build RouDi Environment for testing, is enabled when building tests" OFF)
 option(ADDRESS_SANITIZER "Build with address sanitizer" OFF)
 option(THREAD_SANITIZER "Build with thread sanitizer" OFF)
@@ -46,6 +47,7 @@ if(BUILD_ALL)
   set(EXAMPLES ON)
   set(BUILD_TEST ON)
   set(INTROSPECTION ON)
+  set(RECORD_REPLAY ON)
   set(BINDING_C ON)
 endif()
 
@@ -90,6 +92,7 @@ function(show_config_options)
   message("          INTROSPECTION........................: " ${INTROSPECTION})
   message("          ONE_TO_MANY_ONLY ....................: " ${ONE_TO_MANY_ONLY})
   message("          IOX_PLATFORM_PATH....................: " ${IOX_PLATFORM_PATH})
+  message("          RECORD_REPLAY........................: " ${RECORD_REPLAY})
   message("          ROUDI_ENVIRONMENT....................: " ${ROUDI_ENVIRONMENT} ${ROUDI_ENV_HINT})
   message("          ADDRESS_SANITIZER....................: " ${ADDRESS_SANITIZER})
   message("          THREAD_SANITIZER.....................: " ${THREAD_SANITIZER})
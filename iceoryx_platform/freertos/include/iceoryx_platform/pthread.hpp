@@ -19,6 +19,7 @@
 #ifndef IOX_HOOFS_FREERTOS_PLATFORM_PTHREAD_HPP
 #define IOX_HOOFS_FREERTOS_PLATFORM_PTHREAD_HPP
 
+#include "iceoryx_platform/errno.hpp"
 #include "iceoryx_platform/fcntl.hpp"
 #include "iceoryx_platform/types.hpp"
 
@@ -148,4 +149,16 @@ inline iox_pthread_t iox_pthread_self()
     return {};
 }
 
+inline int iox_pthread_setschedparam(iox_pthread_t, int, int)
+{
+    // the priority of FreeRTOS tasks is defined at task creation
+    return ENOTSUP;
+}
+
+inline int iox_pthread_setaffinity(iox_pthread_t, uint64_t)
+{
+    // Not supported on FreeRTOS
+    return ENOTSUP;
+}
+
 #endif // IOX_HOOFS_FREERTOS_PLATFORM_PTHREAD_HPP
@@ -21,6 +21,7 @@
 #include <sched.h>
 
 #define SCHED_FIFO 1
+#define SCHED_RR 2
 
 inline int sched_get_priority_max(int)
 {
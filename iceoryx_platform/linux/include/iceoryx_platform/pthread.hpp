@@ -18,6 +18,9 @@
 #define IOX_HOOFS_LINUX_PLATFORM_PTHREAD_HPP
 
 #include <pthread.h>
+#include <sched.h>
+
+#include <cstdint>
 
 #define IOX_PTHREAD_MUTEX_INITIALIZER PTHREAD_MUTEX_INITIALIZER
 #define IOX_PTHREAD_PROCESS_SHARED PTHREAD_PROCESS_SHARED
@@ -131,4 +134,26 @@ inline iox_pthread_t iox_pthread_self()
     return pthread_self();
 }
 
+inline int iox_pthread_setschedparam(iox_pthread_t thread, int policy, int priority)
+{
+    struct sched_param param = {};
+    param.sched_priority = priority;
+    return pthread_setschedparam(thread, policy, &param);
+}
+
+/// @brief pins the thread to the CPU cores which are set in cpuMask, bit n corresponds to CPU core n
+inline int iox_pthread_setaffinity(iox_pthread_t thread, uint64_t cpuMask)
+{
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (uint64_t cpu = 0U; cpu < 64U; ++cpu)
+    {
+        if ((cpuMask & (static_cast<uint64_t>(1U) << cpu)) != 0U)
+        {
+            CPU_SET(cpu, &cpuSet);
+        }
+    }
+    return pthread_setaffinity_np(thread, sizeof(cpu_set_t), &cpuSet);
+}
+
 #endif // IOX_HOOFS_LINUX_PLATFORM_PTHREAD_HPP
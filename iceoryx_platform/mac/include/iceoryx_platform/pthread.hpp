@@ -19,6 +19,8 @@
 
 #include <pthread.h>
 
+#include <cstdint>
+
 #define IOX_PTHREAD_MUTEX_INITIALIZER PTHREAD_MUTEX_INITIALIZER
 #define IOX_PTHREAD_PROCESS_SHARED PTHREAD_PROCESS_SHARED
 #define IOX_PTHREAD_PROCESS_PRIVATE PTHREAD_PROCESS_PRIVATE
@@ -115,4 +117,8 @@ int iox_pthread_join(iox_pthread_t thread, void** retval);
 
 iox_pthread_t iox_pthread_self();
 
+int iox_pthread_setschedparam(iox_pthread_t thread, int policy, int priority);
+
+int iox_pthread_setaffinity(iox_pthread_t thread, uint64_t cpuMask);
+
 #endif // IOX_HOOFS_MAC_PLATFORM_PTHREAD_HPP
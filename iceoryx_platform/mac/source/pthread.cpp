@@ -17,6 +17,7 @@
 
 #include "iceoryx_platform/pthread.hpp"
 
+#include <cerrno>
 #include <map>
 #include <mutex>
 #include <string>
@@ -71,6 +72,19 @@ iox_pthread_t iox_pthread_self()
     return pthread_self();
 }
 
+int iox_pthread_setschedparam(iox_pthread_t thread, int policy, int priority)
+{
+    struct sched_param param = {};
+    param.sched_priority = priority;
+    return pthread_setschedparam(thread, policy, &param);
+}
+
+int iox_pthread_setaffinity(iox_pthread_t, uint64_t)
+{
+    // MacOS provides only affinity tags as scheduling hints but no pinning of threads to CPU cores
+    return ENOTSUP;
+}
+
 int pthread_mutexattr_setrobust(pthread_mutexattr_t*, int)
 {
     return 0;
@@ -18,6 +18,10 @@
 #define IOX_HOOFS_UNIX_PLATFORM_PTHREAD_HPP
 
 #include <pthread.h>
+#include <sched.h>
+
+#include <cerrno>
+#include <cstdint>
 
 #define IOX_PTHREAD_MUTEX_INITIALIZER PTHREAD_MUTEX_INITIALIZER
 #define IOX_PTHREAD_PROCESS_SHARED PTHREAD_PROCESS_SHARED
@@ -131,4 +135,17 @@ inline iox_pthread_t iox_pthread_self()
     return pthread_self();
 }
 
+inline int iox_pthread_setschedparam(iox_pthread_t thread, int policy, int priority)
+{
+    struct sched_param param = {};
+    param.sched_priority = priority;
+    return pthread_setschedparam(thread, policy, &param);
+}
+
+inline int iox_pthread_setaffinity(iox_pthread_t, uint64_t)
+{
+    // pinning a thread by its handle is not supported on this platform
+    return ENOTSUP;
+}
+
 #endif // IOX_HOOFS_UNIX_PLATFORM_PTHREAD_HPP
@@ -22,6 +22,7 @@
 #include "iceoryx_platform/windows.hpp"
 
 #include <thread>
+#include <cstdint>
 #include <type_traits>
 
 #define IOX_PTHREAD_PROCESS_SHARED 0
@@ -75,5 +76,7 @@ int iox_pthread_getname_np(iox_pthread_t thread, char* name, size_t len);
 int iox_pthread_create(iox_pthread_t* thread, const iox_pthread_attr_t* attr, void* (*start_routine)(void*), void* arg);
 int iox_pthread_join(iox_pthread_t thread, void** retval);
 iox_pthread_t iox_pthread_self();
+int iox_pthread_setschedparam(iox_pthread_t thread, int policy, int priority);
+int iox_pthread_setaffinity(iox_pthread_t thread, uint64_t cpuMask);
 
 #endif // IOX_HOOFS_WIN_PLATFORM_PTHREAD_HPP
@@ -23,6 +23,7 @@
 #elif defined(_MSC_VER)
 
 #define SCHED_FIFO 1
+#define SCHED_RR 2
 
 int sched_get_priority_max(int policy);
 int sched_get_priority_min(int policy);
@@ -20,6 +20,7 @@
 #include "iceoryx_platform/win32_errorHandling.hpp"
 #include "iceoryx_platform/windows.hpp"
 
+#include <cerrno>
 #include <cwchar>
 #include <sstream>
 #include <vector>
@@ -113,6 +114,16 @@ iox_pthread_t iox_pthread_self()
     return GetCurrentThread();
 }
 
+int iox_pthread_setschedparam(iox_pthread_t, int, int)
+{
+    return ENOTSUP;
+}
+
+int iox_pthread_setaffinity(iox_pthread_t thread, uint64_t cpuMask)
+{
+    return (Win32Call(SetThreadAffinityMask, thread, static_cast<DWORD_PTR>(cpuMask)).value == 0) ? EINVAL : 0;
+}
+
 int iox_pthread_mutexattr_destroy(iox_pthread_mutexattr_t* attr)
 {
     return 0;
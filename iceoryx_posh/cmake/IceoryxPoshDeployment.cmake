@@ -68,6 +68,12 @@ configure_option(
     NAME IOX_MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY
     DEFAULT_VALUE 256
 )
+# NOTE: user-payloads up to this size are copied into the queues instead of being allocated in a mempool chunk by
+# publishers which opt-in with the 'inlineUserPayload' option; '0' disables this path without any overhead
+configure_option(
+    NAME IOX_MAX_INLINE_USER_PAYLOAD_SIZE
+    DEFAULT_VALUE 0
+)
 configure_option(
     NAME IOX_MAX_PROCESS_NUMBER
     DEFAULT_VALUE 300
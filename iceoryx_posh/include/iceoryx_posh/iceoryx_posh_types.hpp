@@ -65,6 +65,9 @@ constexpr uint32_t MAX_SUBSCRIBERS_PER_PUBLISHER = build::IOX_MAX_SUBSCRIBERS_PE
 constexpr uint32_t MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY =
     build::IOX_MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY;
 constexpr uint64_t MAX_PUBLISHER_HISTORY = build::IOX_MAX_PUBLISHER_HISTORY;
+/// @brief user-payloads up to this size are copied into the subscriber queues by publishers with the
+/// 'inlineUserPayload' option instead of being allocated in a mempool chunk; '0' disables the inline path
+constexpr uint64_t MAX_INLINE_USER_PAYLOAD_SIZE = build::IOX_MAX_INLINE_USER_PAYLOAD_SIZE;
 // Subscriber
 constexpr uint32_t MAX_SUBSCRIBERS = build::IOX_MAX_SUBSCRIBERS;
 constexpr uint32_t MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY =
@@ -73,8 +76,8 @@ constexpr uint32_t MAX_SUBSCRIBER_QUEUE_CAPACITY = MAX_CHUNKS_HELD_PER_SUBSCRIBE
 // Introspection is using the following publisherPorts, which reduced the number of ports available for the user
 // 1x publisherPort mempool introspection
 // 1x publisherPort process introspection
-// 3x publisherPort port introspection
-constexpr uint32_t PUBLISHERS_RESERVED_FOR_INTROSPECTION = 5;
+// 4x publisherPort port introspection
+constexpr uint32_t PUBLISHERS_RESERVED_FOR_INTROSPECTION = 6;
 constexpr uint32_t PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY = 1;
 constexpr uint32_t NUMBER_OF_INTERNAL_PUBLISHERS =
     PUBLISHERS_RESERVED_FOR_INTROSPECTION + PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY;
@@ -93,6 +96,8 @@ constexpr uint32_t MAX_CLIENTS = build::IOX_MAX_SUBSCRIBERS;
 constexpr uint32_t MAX_REQUESTS_ALLOCATED_SIMULTANEOUSLY = 4U;
 constexpr uint32_t MAX_RESPONSES_PROCESSED_SIMULTANEOUSLY = build::IOX_MAX_RESPONSES_PROCESSED_SIMULTANEOUSLY;
 constexpr uint32_t MAX_RESPONSE_QUEUE_CAPACITY = build::IOX_MAX_RESPONSE_QUEUE_CAPACITY;
+/// @brief the number of servers of the same service a client distributes its requests to
+constexpr uint32_t MAX_SERVERS_PER_CLIENT = 8U;
 // Server
 constexpr uint32_t MAX_SERVERS = build::IOX_MAX_PUBLISHERS;
 constexpr uint32_t MAX_CLIENTS_PER_SERVER = build::IOX_MAX_CLIENTS_PER_SERVER;
@@ -111,6 +116,7 @@ constexpr uint32_t MAX_NUMBER_OF_NOTIFIERS = build::IOX_MAX_NUMBER_OF_NOTIFIERS;
 /// the variable above must be increased
 constexpr uint32_t MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET = MAX_NUMBER_OF_NOTIFIERS;
 constexpr uint32_t MAX_NUMBER_OF_EVENTS_PER_LISTENER = MAX_NUMBER_OF_NOTIFIERS;
+constexpr uint32_t MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER = 8U;
 //--------- Communication Resources End---------------------
 
 // Memory
@@ -205,6 +211,7 @@ struct DefaultChunkDistributorConfig
 struct DefaultChunkQueueConfig
 {
     static constexpr uint64_t MAX_QUEUE_CAPACITY = MAX_SUBSCRIBER_QUEUE_CAPACITY;
+    static constexpr uint64_t INLINE_USER_PAYLOAD_CAPACITY = MAX_INLINE_USER_PAYLOAD_SIZE;
 };
 
 // Domain ID
@@ -297,10 +304,13 @@ constexpr units::Duration DISCOVERY_INTERVAL = 100_ms;
 /// Once Runlevel Management is extended, it will detect absent processes. Those processes can register again.
 /// ON - all processes are monitored
 /// OFF - no process is monitored
+/// PIDFD - all processes are monitored and a terminated process is removed immediately by waiting on a process file
+/// descriptor (Linux 5.3 and newer); falls back to ON if process file descriptors are not available
 enum class MonitoringMode
 {
     ON,
-    OFF
+    OFF,
+    PIDFD
 };
 
 iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const MonitoringMode& mode) noexcept;
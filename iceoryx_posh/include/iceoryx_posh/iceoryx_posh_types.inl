@@ -62,6 +62,9 @@ inline iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const Mon
     case MonitoringMode::ON:
         logstream << "MonitoringMode::ON";
         break;
+    case MonitoringMode::PIDFD:
+        logstream << "MonitoringMode::PIDFD";
+        break;
     default:
         logstream << "MonitoringMode::UNDEFINED";
         break;
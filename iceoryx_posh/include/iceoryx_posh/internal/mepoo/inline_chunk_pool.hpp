@@ -0,0 +1,135 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_MEPOO_INLINE_CHUNK_POOL_HPP
+#define IOX_POSH_MEPOO_INLINE_CHUNK_POOL_HPP
+
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iox/optional.hpp"
+#include "iox/uninitialized_array.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief A fixed number of chunks for small user-payloads which are located in the port data itself instead of a
+/// mempool. The samples of publishers with inline user-payloads are written into and read from these chunks while the
+/// chunk queues carry only a copy of the user-payload, which keeps the ChunkHeader based API of the ChunkSender and
+/// ChunkReceiver unchanged. The chunks are only accessed by the process which owns the port and by RouDi for the
+/// cleanup when this process terminated.
+/// @tparam UserPayloadCapacity is the maximum user-payload size of a chunk; '0' disables the pool without any overhead
+/// @tparam NumberOfChunks is the number of chunks which can be in use at the same time
+template <uint64_t UserPayloadCapacity, uint32_t NumberOfChunks>
+class InlineChunkPool
+{
+    static_assert(NumberOfChunks > 0U, "The InlineChunkPool requires at least one chunk!");
+
+  public:
+    static constexpr uint64_t CHUNK_SIZE{
+        ((sizeof(ChunkHeader) + UserPayloadCapacity + alignof(ChunkHeader) - 1U) / alignof(ChunkHeader))
+        * alignof(ChunkHeader)};
+
+    InlineChunkPool() noexcept;
+
+    InlineChunkPool(const InlineChunkPool&) = delete;
+    InlineChunkPool(InlineChunkPool&&) = delete;
+    InlineChunkPool& operator=(const InlineChunkPool&) = delete;
+    InlineChunkPool& operator=(InlineChunkPool&&) = delete;
+    ~InlineChunkPool() noexcept = default;
+
+    /// @brief Checks if a chunk with the provided settings fits into the chunks of the pool
+    /// @param[in] chunkSettings of the requested chunk
+    /// @return true if there is no user-header, the user-payload does not exceed UserPayloadCapacity and the required
+    /// chunk size does not exceed CHUNK_SIZE
+    static bool fits(const ChunkSettings& chunkSettings) noexcept;
+
+    /// @brief Constructs a ChunkHeader in a free chunk of the pool
+    /// @param[in] chunkSettings of the requested chunk; the settings must fit into the chunks of the pool
+    /// @return the ChunkHeader of the chunk or nullopt if all chunks are in use or the settings do not fit
+    optional<ChunkHeader*> tryAllocate(const ChunkSettings& chunkSettings) noexcept;
+
+    /// @brief Checks if the ChunkHeader belongs to a chunk of this pool
+    /// @param[in] chunkHeader to check
+    /// @return true if the chunk is located in this pool, otherwise false
+    bool contains(const ChunkHeader* const chunkHeader) const noexcept;
+
+    /// @brief Returns a chunk to the pool
+    /// @param[in] chunkHeader of the chunk to free
+    /// @return true if the chunk was in use and is freed, false if the chunk does not belong to the pool or is not
+    /// in use
+    bool free(const ChunkHeader* const chunkHeader) noexcept;
+
+    /// @brief Returns all chunks to the pool
+    /// @note from RouDi context once the application which owns the pool terminated
+    void freeAll() noexcept;
+
+  private:
+    struct alignas(ChunkHeader) Chunk
+    {
+        uint8_t data[CHUNK_SIZE];
+    };
+
+    using Index_t = uint32_t;
+    static constexpr Index_t INVALID_INDEX{NumberOfChunks};
+    static constexpr Index_t IN_USE{NumberOfChunks + 1U};
+
+    UninitializedArray<Chunk, NumberOfChunks> m_chunks;
+    /// @note the successor in the list of free chunks or 'IN_USE' for the chunks which are currently allocated
+    UninitializedArray<Index_t, NumberOfChunks> m_next;
+    Index_t m_freeListHead{0U};
+};
+
+/// @brief Specialization for a disabled inline user-payload path which does not occupy any memory for the chunks
+template <uint32_t NumberOfChunks>
+class InlineChunkPool<0U, NumberOfChunks>
+{
+  public:
+    static constexpr uint64_t CHUNK_SIZE{0U};
+
+    static bool fits(const ChunkSettings&) noexcept
+    {
+        return false;
+    }
+
+    optional<ChunkHeader*> tryAllocate(const ChunkSettings&) noexcept
+    {
+        return nullopt;
+    }
+
+    bool contains(const ChunkHeader* const) const noexcept
+    {
+        return false;
+    }
+
+    bool free(const ChunkHeader* const) noexcept
+    {
+        return false;
+    }
+
+    void freeAll() noexcept
+    {
+    }
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#include "iceoryx_posh/internal/mepoo/inline_chunk_pool.inl"
+
+#endif // IOX_POSH_MEPOO_INLINE_CHUNK_POOL_HPP
@@ -0,0 +1,104 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_MEPOO_INLINE_CHUNK_POOL_INL
+#define IOX_POSH_MEPOO_INLINE_CHUNK_POOL_INL
+
+#include "iceoryx_posh/internal/mepoo/inline_chunk_pool.hpp"
+
+#include <new>
+
+namespace iox
+{
+namespace mepoo
+{
+template <uint64_t UserPayloadCapacity, uint32_t NumberOfChunks>
+inline InlineChunkPool<UserPayloadCapacity, NumberOfChunks>::InlineChunkPool() noexcept
+{
+    freeAll();
+}
+
+template <uint64_t UserPayloadCapacity, uint32_t NumberOfChunks>
+inline bool InlineChunkPool<UserPayloadCapacity, NumberOfChunks>::fits(const ChunkSettings& chunkSettings) noexcept
+{
+    return chunkSettings.userHeaderSize() == 0U && chunkSettings.userPayloadSize() <= UserPayloadCapacity
+           && chunkSettings.requiredChunkSize() <= CHUNK_SIZE;
+}
+
+template <uint64_t UserPayloadCapacity, uint32_t NumberOfChunks>
+inline optional<ChunkHeader*>
+InlineChunkPool<UserPayloadCapacity, NumberOfChunks>::tryAllocate(const ChunkSettings& chunkSettings) noexcept
+{
+    if (!fits(chunkSettings) || m_freeListHead == INVALID_INDEX)
+    {
+        return nullopt;
+    }
+
+    const auto index = m_freeListHead;
+    m_freeListHead = m_next[index];
+    m_next[index] = IN_USE;
+
+    return new (&m_chunks[index].data[0]) ChunkHeader(CHUNK_SIZE, chunkSettings);
+}
+
+template <uint64_t UserPayloadCapacity, uint32_t NumberOfChunks>
+inline bool
+InlineChunkPool<UserPayloadCapacity, NumberOfChunks>::contains(const ChunkHeader* const chunkHeader) const noexcept
+{
+    const auto address = reinterpret_cast<uintptr_t>(chunkHeader);
+    const auto begin = reinterpret_cast<uintptr_t>(m_chunks.begin());
+    return address >= begin && address < reinterpret_cast<uintptr_t>(m_chunks.end());
+}
+
+template <uint64_t UserPayloadCapacity, uint32_t NumberOfChunks>
+inline bool InlineChunkPool<UserPayloadCapacity, NumberOfChunks>::free(const ChunkHeader* const chunkHeader) noexcept
+{
+    if (!contains(chunkHeader))
+    {
+        return false;
+    }
+
+    const auto offset = reinterpret_cast<uintptr_t>(chunkHeader) - reinterpret_cast<uintptr_t>(m_chunks.begin());
+    if (offset % sizeof(Chunk) != 0U)
+    {
+        return false;
+    }
+
+    const auto index = static_cast<Index_t>(offset / sizeof(Chunk));
+    if (m_next[index] != IN_USE)
+    {
+        return false;
+    }
+
+    m_next[index] = m_freeListHead;
+    m_freeListHead = index;
+    return true;
+}
+
+template <uint64_t UserPayloadCapacity, uint32_t NumberOfChunks>
+inline void InlineChunkPool<UserPayloadCapacity, NumberOfChunks>::freeAll() noexcept
+{
+    for (Index_t i = 0U; i < NumberOfChunks; ++i)
+    {
+        m_next[i] = i + 1U;
+    }
+    m_freeListHead = 0U;
+}
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_INLINE_CHUNK_POOL_INL
@@ -49,6 +49,20 @@ class SharedChunk
 
     ChunkManagement* release() noexcept;
 
+    /// @brief Increments the reference counter with a single atomic operation by the given number of references which
+    /// are handed out with 'adoptAcquiredReference' afterwards, e.g. when a chunk is delivered to multiple queues
+    /// @param[in] numberOfReferences the number of references to acquire
+    void acquireReferences(const uint64_t numberOfReferences) noexcept;
+
+    /// @brief Creates a SharedChunk which takes over one of the references acquired with 'acquireReferences' without
+    /// incrementing the reference counter
+    /// @return the SharedChunk owning the adopted reference
+    SharedChunk adoptAcquiredReference() const noexcept;
+
+    /// @brief Returns the references acquired with 'acquireReferences' which were not adopted
+    /// @param[in] numberOfReferences the number of references to return
+    void releaseAcquiredReferences(const uint64_t numberOfReferences) noexcept;
+
     bool operator==(const SharedChunk& rhs) const noexcept;
     /// @todo iox-#1617 use the newtype pattern to avoid the void pointer
     bool operator==(const void* const rhs) const noexcept;
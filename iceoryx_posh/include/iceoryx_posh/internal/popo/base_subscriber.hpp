@@ -127,6 +127,15 @@ class BaseSubscriber
     /// port
     expected<const mepoo::ChunkHeader*, ChunkReceiveResult> takeChunk() noexcept;
 
+    /// @brief Waits until data is available or the timeout has passed. The receive queue is busy polled for the
+    /// busyPollBudget before the thread is put to sleep.
+    /// @param[in] timeout the maximum time to wait for data
+    /// @param[in] busyPollBudget the part of the timeout which is spent with busy polling; zero disables it
+    /// @return true if data is available, otherwise false
+    /// @note When the subscriber is attached to a WaitSet or Listener, the condition variable of the port is in use
+    /// and the receive queue is polled with an adaptive wait instead.
+    bool waitForData(const units::Duration timeout, const units::Duration busyPollBudget) noexcept;
+
     void invalidateTrigger(const uint64_t trigger) noexcept;
 
     /// @brief Only usable by the WaitSet, not for public use. Attaches the triggerHandle to the internal trigger.
@@ -166,6 +175,7 @@ class BaseSubscriber
   protected:
     port_t m_port{nullptr};
     TriggerHandle m_trigger;
+    optional<WaitSet<1U>> m_dataWaitSet;
 };
 
 } // namespace popo
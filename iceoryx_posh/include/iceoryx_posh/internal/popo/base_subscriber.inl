@@ -19,6 +19,11 @@
 #define IOX_POSH_POPO_BASE_SUBSCRIBER_INL
 
 #include "iceoryx_posh/internal/popo/base_subscriber.hpp"
+#include "iox/deadline_timer.hpp"
+#include "iox/detail/adaptive_wait.hpp"
+#include "iox/detail/busy_poll.hpp"
+
+#include <algorithm>
 
 namespace iox
 {
@@ -105,6 +110,39 @@ inline void BaseSubscriber<port_t>::releaseQueuedData() noexcept
     m_port.releaseQueuedChunks();
 }
 
+template <typename port_t>
+inline bool BaseSubscriber<port_t>::waitForData(const units::Duration timeout,
+                                                const units::Duration busyPollBudget) noexcept
+{
+    const auto busyPollTime = std::min(busyPollBudget, timeout);
+    if (iox::detail::busyPoll(busyPollTime, [this] { return hasData(); }))
+    {
+        return true;
+    }
+    const auto remainingTime = timeout - busyPollTime;
+
+    if (m_trigger)
+    {
+        deadline_timer deadline(remainingTime);
+        iox::detail::adaptive_wait adaptiveWait;
+        adaptiveWait.wait_loop([&] { return !hasData() && !deadline.hasExpired(); });
+        return hasData();
+    }
+
+    // the internal WaitSet is detached after every wait to keep the subscriber free for a WaitSet or Listener of
+    // the user
+    if (!m_dataWaitSet.has_value())
+    {
+        m_dataWaitSet.emplace();
+    }
+    m_dataWaitSet->attachState(*this, SubscriberState::HAS_DATA)
+        .expect("Attaching a single subscriber to an empty WaitSet always succeeds");
+    IOX_DISCARD_RESULT(m_dataWaitSet->timedWait(remainingTime));
+    m_dataWaitSet->detachState(*this, SubscriberState::HAS_DATA);
+
+    return hasData();
+}
+
 template <typename port_t>
 inline void BaseSubscriber<port_t>::invalidateTrigger(const uint64_t uniqueTriggerId) noexcept
 {
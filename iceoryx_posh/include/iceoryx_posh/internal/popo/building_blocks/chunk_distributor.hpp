@@ -26,6 +26,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <limits>
 #include <thread>
 
 namespace iox
@@ -68,6 +69,7 @@ class ChunkDistributor
     using MemberType_t = ChunkDistributorDataType;
     using ChunkQueueData_t = typename ChunkDistributorDataType::ChunkQueueData_t;
     using ChunkQueuePusher_t = typename ChunkDistributorDataType::ChunkQueuePusher_t;
+    using QueueElement_t = typename ChunkQueueData_t::QueueElement_t;
 
     explicit ChunkDistributor(not_null<MemberType_t* const> chunkDistrubutorDataPtr) noexcept;
 
@@ -113,6 +115,16 @@ class ChunkDistributor
     expected<void, ChunkDistributorError>
     deliverToQueue(const UniqueId uniqueQueueId, const uint32_t lastKnownQueueIndex, mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief Deliver the provided shared chunk to one of the stored chunk queues which is selected by the provided
+    /// LoadBalancingPolicy. The chunk will NOT be added to the chunk history
+    /// @param[in] loadBalancingPolicy is the policy to select the queue
+    /// @param[in] routingKey is used to select the queue with LoadBalancingPolicy::CONSISTENT_HASH
+    /// @param[in] chunk is the SharedChunk to be delivered
+    /// @return ChunkDistributorError if there is no stored queue
+    expected<void, ChunkDistributorError> deliverToOneOfStoredQueues(const LoadBalancingPolicy loadBalancingPolicy,
+                                                                     const uint64_t routingKey,
+                                                                     mepoo::SharedChunk chunk) noexcept;
+
     /// @brief Lookup for the index of a queue with a specific iox::UniqueId
     /// @param[in] uniqueQueueId is the unique ID of the queue to query the index
     /// @param[in] lastKnownQueueIndex is used for a fast lookup of the queue with uniqueQueueId; if the queue is not
@@ -143,7 +155,23 @@ class ChunkDistributor
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
-    bool pushToQueue(not_null<ChunkQueueData_t* const> queue, mepoo::SharedChunk chunk) noexcept;
+    /// @brief Deliver the provided queue element to all the stored chunk queues and add it to the chunk history
+    /// @param[in] element is the chunk or the inline user-payload to deliver; the element owns one reference of the
+    /// chunk which is transferred to this method
+    /// @return the number of queues the element was delivered to
+    uint64_t deliverElementToAllStoredQueues(QueueElement_t element) noexcept;
+
+    /// @brief Add the provided queue element to the chunk history without delivering it to any chunk queue
+    /// @param[in] element is the chunk or the inline user-payload to add; the element owns one reference of the chunk
+    /// which is transferred to this method
+    void addElementToHistoryWithoutDelivery(QueueElement_t element) noexcept;
+
+    bool pushToQueue(not_null<ChunkQueueData_t* const> queue, QueueElement_t element) noexcept;
+
+    optional<uint32_t> selectQueueIndex(const LoadBalancingPolicy loadBalancingPolicy,
+                                        const uint64_t routingKey) noexcept;
+
+    static uint64_t rendezvousWeight(const uint64_t routingKey, const UniqueId uniqueQueueId) noexcept;
 
   private:
     MemberType_t* m_chunkDistrubutorDataPtr{nullptr};
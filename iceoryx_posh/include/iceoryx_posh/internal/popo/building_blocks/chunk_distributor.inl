@@ -82,7 +82,7 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(not_null<ChunkQueueData_
                 (requestedHistory <= currChunkHistorySize) ? currChunkHistorySize - requestedHistory : 0u;
             for (auto i = startIndex; i < currChunkHistorySize; ++i)
             {
-                pushToQueue(queueToAdd, getMembers()->m_history[i].cloneToSharedChunk());
+                pushToQueue(queueToAdd, getMembers()->m_history[i].clone());
             }
 
             return ok();
@@ -140,6 +140,13 @@ inline bool ChunkDistributor<ChunkDistributorDataType>::hasStoredQueues() const
 
 template <typename ChunkDistributorDataType>
 inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept
+{
+    return deliverElementToAllStoredQueues(QueueElement_t(std::move(chunk)));
+}
+
+template <typename ChunkDistributorDataType>
+inline uint64_t
+ChunkDistributor<ChunkDistributorDataType>::deliverElementToAllStoredQueues(QueueElement_t element) noexcept
 {
     uint64_t numberOfQueuesTheChunkWasDeliveredTo{0U};
     using QueueContainer = decltype(getMembers()->m_queues);
@@ -148,14 +155,21 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQu
         typename MemberType_t::LockGuard_t lock(*getMembers());
 
         bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+
+        // the references of all queues are acquired with a single update of the shared reference counter instead of
+        // one increment and decrement per copy of the chunk; every queue consumes its reference, either by storing
+        // the chunk or by releasing it when the push fails; inline user-payloads are just copied
+        element.acquireReferences(getMembers()->m_queues.size());
+
         // send to all the queues
         for (auto& queue : getMembers()->m_queues)
         {
             bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
 
-            if (pushToQueue(queue.get(), chunk))
+            if (pushToQueue(queue.get(), element.adoptAcquiredReference()))
             {
                 ++numberOfQueuesTheChunkWasDeliveredTo;
+                incrementStatistic(getMembers()->m_statistics.m_deliveredChunks);
             }
             else
             {
@@ -167,6 +181,7 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQu
                 {
                     ++numberOfQueuesTheChunkWasDeliveredTo;
                     ChunkQueuePusher_t(queue.get()).lostAChunk();
+                    incrementStatistic(getMembers()->m_statistics.m_droppedChunks);
                 }
             }
         }
@@ -174,6 +189,11 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQu
 
     // busy waiting until every queue is served
     iox::detail::adaptive_wait adaptiveWait;
+    BlockedTimeRecorder blockedTimeRecorder(getMembers()->m_statistics);
+    if (!fullQueuesAwaitingDelivery.empty())
+    {
+        blockedTimeRecorder.blocked();
+    }
     while (!fullQueuesAwaitingDelivery.empty())
     {
         adaptiveWait.wait();
@@ -209,9 +229,10 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQu
             // deliver to remaining queues
             for (auto& queue : remainingQueues)
             {
-                if (pushToQueue(queue.get(), chunk))
+                if (pushToQueue(queue.get(), element.clone()))
                 {
                     ++numberOfQueuesTheChunkWasDeliveredTo;
+                    incrementStatistic(getMembers()->m_statistics.m_deliveredChunks);
                 }
                 else
                 {
@@ -221,16 +242,16 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQu
         }
     }
 
-    addToHistoryWithoutDelivery(chunk);
+    addElementToHistoryWithoutDelivery(element);
 
     return numberOfQueuesTheChunkWasDeliveredTo;
 }
 
 template <typename ChunkDistributorDataType>
 inline bool ChunkDistributor<ChunkDistributorDataType>::pushToQueue(not_null<ChunkQueueData_t* const> queue,
-                                                                    mepoo::SharedChunk chunk) noexcept
+                                                                    QueueElement_t element) noexcept
 {
-    return ChunkQueuePusher_t(queue).push(chunk);
+    return ChunkQueuePusher_t(queue).push(element);
 }
 
 template <typename ChunkDistributorDataType>
@@ -240,6 +261,7 @@ ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(const UniqueId unique
                                                            mepoo::SharedChunk chunk [[maybe_unused]]) noexcept
 {
     bool retry{false};
+    BlockedTimeRecorder blockedTimeRecorder(getMembers()->m_statistics);
     do
     {
         typename MemberType_t::LockGuard_t lock(*getMembers());
@@ -263,17 +285,116 @@ ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(const UniqueId unique
             if (isBlockingQueue)
             {
                 retry = true;
+                blockedTimeRecorder.blocked();
             }
             else
             {
                 ChunkQueuePusher_t(queue.get()).lostAChunk();
+                incrementStatistic(getMembers()->m_statistics.m_droppedChunks);
             }
         }
+        else
+        {
+            incrementStatistic(getMembers()->m_statistics.m_deliveredChunks);
+        }
     } while (retry);
 
     return ok();
 }
 
+template <typename ChunkDistributorDataType>
+inline expected<void, ChunkDistributorError> ChunkDistributor<ChunkDistributorDataType>::deliverToOneOfStoredQueues(
+    const LoadBalancingPolicy loadBalancingPolicy, const uint64_t routingKey, mepoo::SharedChunk chunk) noexcept
+{
+    optional<UniqueId> uniqueQueueId;
+    uint32_t queueIndex{0U};
+    {
+        // the lock must not be held while waiting for a full queue, else the queue could not be removed by RouDi
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+
+        selectQueueIndex(loadBalancingPolicy, routingKey).and_then([&](const auto& index) {
+            queueIndex = index;
+            uniqueQueueId.emplace(getMembers()->m_queues[index]->m_uniqueId);
+        });
+    }
+
+    if (!uniqueQueueId.has_value())
+    {
+        return err(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
+    }
+
+    return deliverToQueue(uniqueQueueId.value(), queueIndex, chunk);
+}
+
+template <typename ChunkDistributorDataType>
+inline optional<uint32_t>
+ChunkDistributor<ChunkDistributorDataType>::selectQueueIndex(const LoadBalancingPolicy loadBalancingPolicy,
+                                                             const uint64_t routingKey) noexcept
+{
+    auto& queues = getMembers()->m_queues;
+    if (queues.empty())
+    {
+        return nullopt;
+    }
+
+    const auto numberOfQueues = static_cast<uint32_t>(queues.size());
+
+    switch (loadBalancingPolicy)
+    {
+    case LoadBalancingPolicy::ROUND_ROBIN:
+        return static_cast<uint32_t>(getMembers()->m_loadBalancingCounter++ % numberOfQueues);
+    case LoadBalancingPolicy::LEAST_QUEUED:
+    {
+        // the search starts at a rotating index in order to distribute the chunks evenly to equally filled queues
+        const auto startIndex = static_cast<uint32_t>(getMembers()->m_loadBalancingCounter++ % numberOfQueues);
+        uint32_t selectedIndex{startIndex};
+        uint64_t minimalFillLevel{std::numeric_limits<uint64_t>::max()};
+        for (uint32_t i = 0U; i < numberOfQueues; ++i)
+        {
+            const auto index = (startIndex + i) % numberOfQueues;
+            const auto fillLevel = queues[index]->m_queue.size();
+            if (fillLevel < minimalFillLevel)
+            {
+                minimalFillLevel = fillLevel;
+                selectedIndex = index;
+            }
+        }
+        return selectedIndex;
+    }
+    case LoadBalancingPolicy::CONSISTENT_HASH:
+    {
+        // rendezvous hashing; adding or removing a queue only moves the routing keys of this queue
+        uint32_t selectedIndex{0U};
+        uint64_t maximalWeight{0U};
+        for (uint32_t index = 0U; index < numberOfQueues; ++index)
+        {
+            const auto weight = rendezvousWeight(routingKey, queues[index]->m_uniqueId);
+            if (index == 0U || weight > maximalWeight)
+            {
+                maximalWeight = weight;
+                selectedIndex = index;
+            }
+        }
+        return selectedIndex;
+    }
+    }
+
+    return nullopt;
+}
+
+template <typename ChunkDistributorDataType>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::rendezvousWeight(const uint64_t routingKey,
+                                                                              const UniqueId uniqueQueueId) noexcept
+{
+    // the finalizer of splitmix64 is used to mix the bits of the routing key and the queue id
+    auto mix = [](uint64_t value) -> uint64_t {
+        value = (value ^ (value >> 30U)) * 0xbf58476d1ce4e5b9U;
+        value = (value ^ (value >> 27U)) * 0x94d049bb133111ebU;
+        return value ^ (value >> 31U);
+    };
+    return mix(routingKey ^ mix(static_cast<uint64_t>(uniqueQueueId)));
+}
+
 template <typename ChunkDistributorDataType>
 inline optional<uint32_t>
 ChunkDistributor<ChunkDistributorDataType>::getQueueIndex(const UniqueId uniqueQueueId,
@@ -302,6 +423,13 @@ ChunkDistributor<ChunkDistributorDataType>::getQueueIndex(const UniqueId uniqueQ
 
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::addToHistoryWithoutDelivery(mepoo::SharedChunk chunk) noexcept
+{
+    addElementToHistoryWithoutDelivery(QueueElement_t(std::move(chunk)));
+}
+
+template <typename ChunkDistributorDataType>
+inline void
+ChunkDistributor<ChunkDistributorDataType>::addElementToHistoryWithoutDelivery(QueueElement_t element) noexcept
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
@@ -316,7 +444,12 @@ inline void ChunkDistributor<ChunkDistributorDataType>::addToHistoryWithoutDeliv
         }
         // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : we ensured that there is space in the
         // history, so return value can be ignored
-        getMembers()->m_history.push_back(chunk);
+        getMembers()->m_history.push_back(element);
+    }
+    else
+    {
+        // d'tor of SharedChunk will release the chunk which is not stored in the history
+        element.releaseToSharedChunk();
     }
 }
 
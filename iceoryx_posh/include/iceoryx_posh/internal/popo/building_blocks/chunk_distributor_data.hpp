@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_statistics.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 #include "iox/algorithm.hpp"
@@ -52,12 +53,19 @@ struct ChunkDistributorData : public LockingPolicy
 
     /// @todo iox-#1710 If we would make the ChunkDistributor lock-free, can we than extend the UsedChunkList to
     /// be like a ring buffer and use this for the history? This would be needed to be able to safely cleanup.
-    /// Using ShmSafeUnmanagedChunk since RouDi must access this list to cleanup the chunks in case of an application
-    /// crash.
+    /// Using the trivially copyable queue elements since RouDi must access this list to cleanup the chunks in case of
+    /// an application crash.
     using HistoryContainer_t =
-        vector<mepoo::ShmSafeUnmanagedChunk, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY>;
+        vector<typename ChunkQueueData_t::QueueElement_t, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY>;
     HistoryContainer_t m_history;
     const ConsumerTooSlowPolicy m_consumerTooSlowPolicy;
+
+    /// @brief running counter to select the queue for LoadBalancingPolicy::ROUND_ROBIN
+    uint64_t m_loadBalancingCounter{0U};
+
+    /// @note the statistics belong to the ChunkSender which owns this data; they are located here since the
+    /// ChunkDistributor updates the delivery related counters
+    ChunkSenderStatistics m_statistics;
 };
 
 } // namespace popo
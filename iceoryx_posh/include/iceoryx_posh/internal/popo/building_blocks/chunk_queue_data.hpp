@@ -17,7 +17,8 @@
 #ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_DATA_HPP
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_DATA_HPP
 
-#include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_element.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_statistics.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/variant_queue.hpp"
@@ -43,8 +44,10 @@ struct ChunkQueueData : public LockingPolicy
     UniqueId m_uniqueId{};
 
     static constexpr uint64_t MAX_CAPACITY = ChunkQueueDataProperties_t::MAX_QUEUE_CAPACITY;
-    VariantQueue<mepoo::ShmSafeUnmanagedChunk, MAX_CAPACITY> m_queue;
+    using QueueElement_t = ChunkQueueElement<ChunkQueueDataProperties_t::INLINE_USER_PAYLOAD_CAPACITY>;
+    VariantQueue<QueueElement_t, MAX_CAPACITY> m_queue;
     std::atomic_bool m_queueHasLostChunks{false};
+    ChunkQueueStatistics m_statistics;
 
     RelativePointer<ConditionVariableData> m_conditionVariableDataPtr;
     optional<uint64_t> m_conditionVariableNotificationIndex;
@@ -0,0 +1,147 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_ELEMENT_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_ELEMENT_HPP
+
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/unique_port_id.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iox/optional.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The element which is stored in the chunk queues and in the history of the ChunkDistributor. It either refers
+/// to a chunk in a mempool or, for small samples of publishers with inline user-payloads, carries a copy of the
+/// user-payload together with the ChunkHeader fields which are required to restore the sample on the receiving side.
+/// Like the ShmSafeUnmanagedChunk, it is trivially copyable and does not manage the reference of the chunk it refers
+/// to. The reference to the chunk is located at the beginning of the element and does not exceed 64 bit, which
+/// prevents torn writes of the part RouDi needs for the cleanup.
+/// @tparam InlineUserPayloadCapacity is the maximum size of an inline user-payload; with '0' the element is a plain
+/// ShmSafeUnmanagedChunk
+template <uint64_t InlineUserPayloadCapacity>
+class ChunkQueueElement
+{
+  public:
+    static constexpr uint64_t INLINE_USER_PAYLOAD_CAPACITY{InlineUserPayloadCapacity};
+
+    ChunkQueueElement() noexcept = default;
+
+    /// @brief takes a SharedChunk without decrementing the chunk reference counter
+    // NOLINTNEXTLINE(hicpp-explicit-conversions) implicit conversion to push a SharedChunk into a chunk queue
+    ChunkQueueElement(mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief takes the ShmSafeUnmanagedChunk without touching the chunk reference counter
+    // NOLINTNEXTLINE(hicpp-explicit-conversions) implicit conversion to push an unmanaged chunk into a chunk queue
+    ChunkQueueElement(const mepoo::ShmSafeUnmanagedChunk chunk) noexcept;
+
+    /// @brief Copies the user-payload and the ChunkHeader fields of a chunk into an inline element
+    /// @param[in] chunkHeader of the chunk to copy
+    /// @return the inline element or nullopt if the chunk has a user-header or the user-payload exceeds the inline
+    /// capacity
+    static optional<ChunkQueueElement> fromInlineChunk(const mepoo::ChunkHeader& chunkHeader) noexcept;
+
+    /// @brief Checks if the element carries an inline user-payload instead of referring to a chunk
+    /// @return true for an inline user-payload, false for a chunk
+    bool isInline() const noexcept;
+
+    /// @brief const access to the ChunkHeader of the chunk the element refers to
+    /// @return the pointer to the ChunkHeader or nullptr for an inline element
+    const mepoo::ChunkHeader* getChunkHeader() const noexcept;
+
+    /// @brief Creates a SharedChunk without incrementing the chunk reference counter and invalidates itself
+    /// @return the SharedChunk of the element or an empty SharedChunk for an inline element
+    mepoo::SharedChunk releaseToSharedChunk() noexcept;
+
+    /// @brief Creates a copy of the element which owns an additional reference of the chunk
+    /// @return the copy of the element
+    ChunkQueueElement clone() noexcept;
+
+    /// @brief Acquires multiple references of the chunk at once which are handed out with 'adoptAcquiredReference'
+    /// @param[in] numberOfReferences the number of references to acquire
+    /// @note this has no effect on an inline element
+    void acquireReferences(const uint64_t numberOfReferences) noexcept;
+
+    /// @brief Creates a copy of the element which takes over one of the references acquired with 'acquireReferences'
+    /// @return the copy of the element
+    ChunkQueueElement adoptAcquiredReference() const noexcept;
+
+    /// @brief Allocates a chunk from an InlineChunkPool and copies the inline user-payload and the ChunkHeader fields
+    /// into it
+    /// @param[in] inlineChunks is the InlineChunkPool to allocate the chunk from
+    /// @return the ChunkHeader of the restored chunk or nullopt if the pool has no free chunk
+    /// @pre the element is inline
+    template <typename InlineChunkPool>
+    optional<mepoo::ChunkHeader*> restoreInlineChunk(InlineChunkPool& inlineChunks) const noexcept;
+
+  private:
+    mepoo::ShmSafeUnmanagedChunk m_chunk;
+    UniquePortId::value_type m_originId{0U};
+    uint64_t m_sequenceNumber{0U};
+    uint32_t m_userPayloadSize{0U};
+    /// @note an alignment of '0' indicates an element which refers to a chunk
+    uint32_t m_userPayloadAlignment{0U};
+    alignas(8) uint8_t m_userPayload[InlineUserPayloadCapacity];
+};
+
+/// @brief Specialization for a disabled inline user-payload path which only refers to chunks
+template <>
+class ChunkQueueElement<0U>
+{
+  public:
+    static constexpr uint64_t INLINE_USER_PAYLOAD_CAPACITY{0U};
+
+    ChunkQueueElement() noexcept = default;
+
+    // NOLINTNEXTLINE(hicpp-explicit-conversions) implicit conversion to push a SharedChunk into a chunk queue
+    ChunkQueueElement(mepoo::SharedChunk chunk) noexcept;
+
+    // NOLINTNEXTLINE(hicpp-explicit-conversions) implicit conversion to push an unmanaged chunk into a chunk queue
+    ChunkQueueElement(const mepoo::ShmSafeUnmanagedChunk chunk) noexcept;
+
+    static optional<ChunkQueueElement> fromInlineChunk(const mepoo::ChunkHeader&) noexcept;
+
+    bool isInline() const noexcept;
+
+    const mepoo::ChunkHeader* getChunkHeader() const noexcept;
+
+    mepoo::SharedChunk releaseToSharedChunk() noexcept;
+
+    ChunkQueueElement clone() noexcept;
+
+    void acquireReferences(const uint64_t numberOfReferences) noexcept;
+
+    ChunkQueueElement adoptAcquiredReference() const noexcept;
+
+    template <typename InlineChunkPool>
+    optional<mepoo::ChunkHeader*> restoreInlineChunk(InlineChunkPool&) const noexcept;
+
+  private:
+    mepoo::ShmSafeUnmanagedChunk m_chunk;
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_element.inl"
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_ELEMENT_HPP
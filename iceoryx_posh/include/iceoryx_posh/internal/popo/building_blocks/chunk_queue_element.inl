@@ -0,0 +1,183 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_ELEMENT_INL
+#define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_ELEMENT_INL
+
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_element.hpp"
+
+#include <cstring>
+#include <type_traits>
+
+namespace iox
+{
+namespace popo
+{
+template <uint64_t InlineUserPayloadCapacity>
+inline ChunkQueueElement<InlineUserPayloadCapacity>::ChunkQueueElement(mepoo::SharedChunk chunk) noexcept
+    : m_chunk(std::move(chunk))
+{
+    static_assert(std::is_trivially_copyable<ChunkQueueElement>::value,
+                  "The ChunkQueueElement must be trivially copyable to be stored in the chunk queues!");
+}
+
+template <uint64_t InlineUserPayloadCapacity>
+inline ChunkQueueElement<InlineUserPayloadCapacity>::ChunkQueueElement(
+    const mepoo::ShmSafeUnmanagedChunk chunk) noexcept
+    : m_chunk(chunk)
+{
+}
+
+template <uint64_t InlineUserPayloadCapacity>
+inline optional<ChunkQueueElement<InlineUserPayloadCapacity>>
+ChunkQueueElement<InlineUserPayloadCapacity>::fromInlineChunk(const mepoo::ChunkHeader& chunkHeader) noexcept
+{
+    if (chunkHeader.userHeaderSize() != 0U || chunkHeader.userPayloadSize() > InlineUserPayloadCapacity)
+    {
+        return nullopt;
+    }
+
+    ChunkQueueElement element;
+    element.m_originId = static_cast<UniquePortId::value_type>(chunkHeader.originId());
+    element.m_sequenceNumber = chunkHeader.sequenceNumber();
+    element.m_userPayloadSize = static_cast<uint32_t>(chunkHeader.userPayloadSize());
+    element.m_userPayloadAlignment = chunkHeader.userPayloadAlignment();
+    std::memcpy(&element.m_userPayload[0], chunkHeader.userPayload(), chunkHeader.userPayloadSize());
+    return element;
+}
+
+template <uint64_t InlineUserPayloadCapacity>
+inline bool ChunkQueueElement<InlineUserPayloadCapacity>::isInline() const noexcept
+{
+    return m_userPayloadAlignment != 0U;
+}
+
+template <uint64_t InlineUserPayloadCapacity>
+inline const mepoo::ChunkHeader* ChunkQueueElement<InlineUserPayloadCapacity>::getChunkHeader() const noexcept
+{
+    return m_chunk.getChunkHeader();
+}
+
+template <uint64_t InlineUserPayloadCapacity>
+inline mepoo::SharedChunk ChunkQueueElement<InlineUserPayloadCapacity>::releaseToSharedChunk() noexcept
+{
+    return m_chunk.releaseToSharedChunk();
+}
+
+template <uint64_t InlineUserPayloadCapacity>
+inline ChunkQueueElement<InlineUserPayloadCapacity> ChunkQueueElement<InlineUserPayloadCapacity>::clone() noexcept
+{
+    if (isInline())
+    {
+        return *this;
+    }
+    return ChunkQueueElement(m_chunk.cloneToSharedChunk());
+}
+
+template <uint64_t InlineUserPayloadCapacity>
+inline void
+ChunkQueueElement<InlineUserPayloadCapacity>::acquireReferences(const uint64_t numberOfReferences) noexcept
+{
+    if (!isInline())
+    {
+        auto chunk = m_chunk.releaseToSharedChunk();
+        chunk.acquireReferences(numberOfReferences);
+        m_chunk = mepoo::ShmSafeUnmanagedChunk(std::move(chunk));
+    }
+}
+
+template <uint64_t InlineUserPayloadCapacity>
+inline ChunkQueueElement<InlineUserPayloadCapacity>
+ChunkQueueElement<InlineUserPayloadCapacity>::adoptAcquiredReference() const noexcept
+{
+    return *this;
+}
+
+template <uint64_t InlineUserPayloadCapacity>
+template <typename InlineChunkPool>
+inline optional<mepoo::ChunkHeader*>
+ChunkQueueElement<InlineUserPayloadCapacity>::restoreInlineChunk(InlineChunkPool& inlineChunks) const noexcept
+{
+    auto chunkSettings = mepoo::ChunkSettings::create(m_userPayloadSize, m_userPayloadAlignment)
+                             .expect("The settings of an inline user-payload are valid since they were taken from a "
+                                     "valid chunk");
+    auto chunkHeader = inlineChunks.tryAllocate(chunkSettings);
+    if (chunkHeader.has_value())
+    {
+        chunkHeader.value()->setOriginId(UniquePortId(m_originId, newtype::internal::ProtectedConstructor));
+        chunkHeader.value()->setSequenceNumber(m_sequenceNumber);
+        std::memcpy(chunkHeader.value()->userPayload(), &m_userPayload[0], m_userPayloadSize);
+    }
+    return chunkHeader;
+}
+
+inline ChunkQueueElement<0U>::ChunkQueueElement(mepoo::SharedChunk chunk) noexcept
+    : m_chunk(std::move(chunk))
+{
+}
+
+inline ChunkQueueElement<0U>::ChunkQueueElement(const mepoo::ShmSafeUnmanagedChunk chunk) noexcept
+    : m_chunk(chunk)
+{
+}
+
+inline optional<ChunkQueueElement<0U>> ChunkQueueElement<0U>::fromInlineChunk(const mepoo::ChunkHeader&) noexcept
+{
+    return nullopt;
+}
+
+inline bool ChunkQueueElement<0U>::isInline() const noexcept
+{
+    return false;
+}
+
+inline const mepoo::ChunkHeader* ChunkQueueElement<0U>::getChunkHeader() const noexcept
+{
+    return m_chunk.getChunkHeader();
+}
+
+inline mepoo::SharedChunk ChunkQueueElement<0U>::releaseToSharedChunk() noexcept
+{
+    return m_chunk.releaseToSharedChunk();
+}
+
+inline ChunkQueueElement<0U> ChunkQueueElement<0U>::clone() noexcept
+{
+    return ChunkQueueElement(m_chunk.cloneToSharedChunk());
+}
+
+inline void ChunkQueueElement<0U>::acquireReferences(const uint64_t numberOfReferences) noexcept
+{
+    auto chunk = m_chunk.releaseToSharedChunk();
+    chunk.acquireReferences(numberOfReferences);
+    m_chunk = mepoo::ShmSafeUnmanagedChunk(std::move(chunk));
+}
+
+inline ChunkQueueElement<0U> ChunkQueueElement<0U>::adoptAcquiredReference() const noexcept
+{
+    return *this;
+}
+
+template <typename InlineChunkPool>
+inline optional<mepoo::ChunkHeader*> ChunkQueueElement<0U>::restoreInlineChunk(InlineChunkPool&) const noexcept
+{
+    return nullopt;
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_ELEMENT_INL
@@ -37,6 +37,7 @@ class ChunkQueuePopper
 {
   public:
     using MemberType_t = ChunkQueueDataType;
+    using QueueElement_t = typename ChunkQueueDataType::QueueElement_t;
 
     explicit ChunkQueuePopper(not_null<MemberType_t* const> chunkQueueDataPtr) noexcept;
 
@@ -48,8 +49,15 @@ class ChunkQueuePopper
 
     /// @brief pop a chunk from the chunk queue
     /// @return optional for a shared chunk that is set if the queue is not empty
+    /// @note an inline user-payload is dropped with an error since there is no chunk for it; queues which receive
+    /// inline user-payloads must be read with 'tryPopElement'
     optional<mepoo::SharedChunk> tryPop() noexcept;
 
+    /// @brief pop a chunk or an inline user-payload from the chunk queue
+    /// @return optional for the queue element that is set if the queue is not empty; the ownership of the chunk
+    /// reference is transferred to the caller
+    optional<QueueElement_t> tryPopElement() noexcept;
+
     /// @brief check if chunks were lost and reset flag
     /// @return true if the underlying queue has lost chunks due to an overflow since the last call of this method
     bool hasLostChunks() noexcept;
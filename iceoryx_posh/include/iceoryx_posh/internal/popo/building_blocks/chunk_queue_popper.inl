@@ -47,17 +47,45 @@ ChunkQueuePopper<ChunkQueueDataType>::getMembers() noexcept
 
 template <typename ChunkQueueDataType>
 inline optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::tryPop() noexcept
+{
+    auto retVal = tryPopElement();
+
+    // check if queue had an element that was poped and return if so
+    if (retVal.has_value())
+    {
+        if (retVal->isInline())
+        {
+            IOX_LOG(ERROR, "Received an inline user-payload which cannot be provided as chunk! Dropping it!");
+            IOX_REPORT(PoshError::POPO__CHUNK_QUEUE_POPPER_INLINE_USER_PAYLOAD_WITHOUT_CHUNK, iox::er::RUNTIME_ERROR);
+            return nullopt_t();
+        }
+        return make_optional<mepoo::SharedChunk>(retVal->releaseToSharedChunk());
+    }
+    else
+    {
+        return nullopt_t();
+    }
+}
+
+template <typename ChunkQueueDataType>
+inline optional<typename ChunkQueuePopper<ChunkQueueDataType>::QueueElement_t>
+ChunkQueuePopper<ChunkQueueDataType>::tryPopElement() noexcept
 {
     auto retVal = getMembers()->m_queue.pop();
 
     // check if queue had an element that was poped and return if so
     if (retVal.has_value())
     {
-        auto chunk = retVal.value().releaseToSharedChunk();
+        if (retVal->isInline())
+        {
+            return retVal;
+        }
 
-        auto receivedChunkHeaderVersion = chunk.getChunkHeader()->chunkHeaderVersion();
+        auto receivedChunkHeaderVersion = retVal->getChunkHeader()->chunkHeaderVersion();
         if (receivedChunkHeaderVersion != mepoo::ChunkHeader::CHUNK_HEADER_VERSION)
         {
+            // the d'tor of the SharedChunk releases the dropped chunk
+            retVal->releaseToSharedChunk();
             IOX_LOG(ERROR,
                     "Received chunk with CHUNK_HEADER_VERSION '" << receivedChunkHeaderVersion << "' but expected '"
                                                                  << mepoo::ChunkHeader::CHUNK_HEADER_VERSION
@@ -66,7 +94,7 @@ inline optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::tryPop
                        iox::er::RUNTIME_ERROR);
             return nullopt_t();
         }
-        return make_optional<mepoo::SharedChunk>(chunk);
+        return retVal;
     }
     else
     {
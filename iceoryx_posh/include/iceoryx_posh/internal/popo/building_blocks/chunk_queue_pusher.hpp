@@ -36,6 +36,7 @@ class ChunkQueuePusher
 {
   public:
     using MemberType_t = ChunkQueueDataType;
+    using QueueElement_t = typename ChunkQueueDataType::QueueElement_t;
 
     explicit ChunkQueuePusher(not_null<MemberType_t* const> chunkQueueDataPtr) noexcept;
 
@@ -46,9 +47,10 @@ class ChunkQueuePusher
     ~ChunkQueuePusher() noexcept = default;
 
     /// @brief push a new chunk to the chunk queue
-    /// @param[in] shared chunk object
+    /// @param[in] element is the chunk or the inline user-payload to push; a SharedChunk is implicitly converted and
+    /// the reference it owns is transferred to the queue
     /// @return false if a queue overflow occurred, otherwise true
-    bool push(mepoo::SharedChunk chunk) noexcept;
+    bool push(QueueElement_t element) noexcept;
 
     /// @brief tell the queue that it lost a chunk (e.g. because push failed and there will be no retry)
     void lostAChunk() noexcept;
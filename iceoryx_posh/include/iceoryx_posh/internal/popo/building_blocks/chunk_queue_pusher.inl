@@ -43,9 +43,9 @@ ChunkQueuePusher<ChunkQueueDataType>::getMembers() noexcept
 }
 
 template <typename ChunkQueueDataType>
-inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk) noexcept
+inline bool ChunkQueuePusher<ChunkQueueDataType>::push(QueueElement_t element) noexcept
 {
-    auto pushRet = getMembers()->m_queue.push(chunk);
+    auto pushRet = getMembers()->m_queue.push(element);
     bool hasQueueOverflow = false;
 
     // drop the chunk if one is returned by an overflow
@@ -55,6 +55,10 @@ inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk)
         // tell the ChunkDistributor that we had an overflow and dropped a sample
         hasQueueOverflow = true;
     }
+    else
+    {
+        incrementStatistic(getMembers()->m_statistics.m_receivedChunks);
+    }
 
     {
         typename MemberType_t::LockGuard_t lock(*getMembers());
@@ -73,6 +77,7 @@ template <typename ChunkQueueDataType>
 inline void ChunkQueuePusher<ChunkQueueDataType>::lostAChunk() noexcept
 {
     getMembers()->m_queueHasLostChunks.store(true, std::memory_order_relaxed);
+    incrementStatistic(getMembers()->m_statistics.m_lostChunks);
 }
 
 } // namespace popo
@@ -56,12 +56,15 @@ inline log::LogStream& operator<<(log::LogStream& stream, ChunkReceiveResult val
 /// The
 /// ChunkRceiver holds the ownership of the SharedChunks and does a bookkeeping which chunks are currently passed to the
 /// user side.
+/// Inline user-payloads from the queue are restored into the inline chunks of the ChunkReceiverData, which provides
+/// them with the same ChunkHeader based API as the SharedChunks.
 template <typename ChunkReceiverDataType>
 class ChunkReceiver : public ChunkQueuePopper<typename ChunkReceiverDataType::ChunkQueueData_t>
 {
   public:
     using MemberType_t = ChunkReceiverDataType;
     using Base_t = ChunkQueuePopper<typename ChunkReceiverDataType::ChunkQueueData_t>;
+    using QueueElement_t = typename Base_t::QueueElement_t;
 
     explicit ChunkReceiver(not_null<MemberType_t* const> chunkReceiverDataPtr) noexcept;
 
@@ -88,6 +91,8 @@ class ChunkReceiver : public ChunkQueuePopper<typename ChunkReceiverDataType::Ch
     void releaseAll() noexcept;
 
   private:
+    expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGetInline(const QueueElement_t& element) noexcept;
+
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 };
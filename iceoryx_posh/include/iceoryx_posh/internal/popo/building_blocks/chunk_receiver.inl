@@ -72,11 +72,16 @@ ChunkReceiver<ChunkReceiverDataType>::getMembers() noexcept
 template <typename ChunkReceiverDataType>
 inline expected<const mepoo::ChunkHeader*, ChunkReceiveResult> ChunkReceiver<ChunkReceiverDataType>::tryGet() noexcept
 {
-    auto popRet = this->tryPop();
+    auto popRet = this->tryPopElement();
 
     if (popRet.has_value())
     {
-        auto sharedChunk = *popRet;
+        if (popRet->isInline())
+        {
+            return tryGetInline(popRet.value());
+        }
+
+        auto sharedChunk = popRet->releaseToSharedChunk();
 
         // if the application holds too many chunks, don't provide more
         if (getMembers()->m_chunksInUse.insert(sharedChunk))
@@ -93,9 +98,31 @@ inline expected<const mepoo::ChunkHeader*, ChunkReceiveResult> ChunkReceiver<Chu
     return err(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
 }
 
+template <typename ChunkReceiverDataType>
+inline expected<const mepoo::ChunkHeader*, ChunkReceiveResult>
+ChunkReceiver<ChunkReceiverDataType>::tryGetInline(const QueueElement_t& element) noexcept
+{
+    auto inlineChunk = element.restoreInlineChunk(getMembers()->m_inlineChunks);
+    if (!inlineChunk.has_value())
+    {
+        return err(ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
+    }
+
+    return ok(const_cast<const mepoo::ChunkHeader*>(inlineChunk.value()));
+}
+
 template <typename ChunkReceiverDataType>
 inline void ChunkReceiver<ChunkReceiverDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
+    if (getMembers()->m_inlineChunks.contains(chunkHeader))
+    {
+        if (!getMembers()->m_inlineChunks.free(chunkHeader))
+        {
+            IOX_REPORT(PoshError::POPO__CHUNK_RECEIVER_INVALID_CHUNK_TO_RELEASE_FROM_USER, iox::er::RUNTIME_ERROR);
+        }
+        return;
+    }
+
     mepoo::SharedChunk chunk(nullptr);
     // d'tor of SharedChunk will release the memory, we do not have to touch the returned chunk
     if (!getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
@@ -108,6 +135,7 @@ template <typename ChunkReceiverDataType>
 inline void ChunkReceiver<ChunkReceiverDataType>::releaseAll() noexcept
 {
     getMembers()->m_chunksInUse.cleanup();
+    getMembers()->m_inlineChunks.freeAll();
     this->clear();
 }
 
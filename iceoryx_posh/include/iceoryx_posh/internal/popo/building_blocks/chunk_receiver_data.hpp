@@ -17,6 +17,7 @@
 #ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_RECEIVER_DATA_HPP
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_RECEIVER_DATA_HPP
 
+#include "iceoryx_posh/internal/mepoo/inline_chunk_pool.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/variant_queue.hpp"
@@ -43,6 +44,10 @@ struct ChunkReceiverData : public ChunkQueueDataType
     /// has to return one to not brake the contract. This is aligned with AUTOSAR Adaptive ara::com
     static constexpr uint32_t MAX_CHUNKS_IN_USE = MaxChunksHeldSimultaneously + 1U;
     UsedChunkList<MAX_CHUNKS_IN_USE> m_chunksInUse;
+
+    /// @brief the chunks which provide the inline user-payloads from the queue to the user
+    mepoo::InlineChunkPool<ChunkQueueDataType::QueueElement_t::INLINE_USER_PAYLOAD_CAPACITY, MAX_CHUNKS_IN_USE>
+        m_inlineChunks;
 };
 
 } // namespace popo
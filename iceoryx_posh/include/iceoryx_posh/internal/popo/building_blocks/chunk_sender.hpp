@@ -72,12 +72,16 @@ inline log::LogStream& operator<<(log::LogStream& stream, AllocationError value)
 /// For getting chunks of memory the MemoryManger is used. Together with the ChunkReceiver, they are the next
 /// abstraction layer on top of ChunkDistributor and ChunkQueuePopper. The ChunkSender holds the ownership of the
 /// SharedChunks and does a bookkeeping which chunks are currently passed to the user side.
+/// If inline user-payloads are enabled in the ChunkSenderData, small user-payloads are allocated from the inline chunks
+/// of the ChunkSenderData and copied into the queues by 'send' and 'pushToHistory'. Since these chunks are not shared,
+/// 'tryGetPreviousChunk' does not provide an inline chunk and 'sendToQueue' and 'sendToOneQueue' do not support them.
 template <typename ChunkSenderDataType>
 class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkDistributorData_t>
 {
   public:
     using MemberType_t = ChunkSenderDataType;
     using Base_t = ChunkDistributor<typename ChunkSenderDataType::ChunkDistributorData_t>;
+    using QueueElement_t = typename Base_t::QueueElement_t;
 
     explicit ChunkSender(not_null<MemberType_t* const> chunkSenderDataPtr) noexcept;
 
@@ -125,6 +129,17 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
                      const UniqueId uniqueQueueId,
                      const uint32_t lastKnownQueueIndex) noexcept;
 
+    /// @brief Send an allocated chunk to one of the connected ChunkQueuePopper
+    /// @param[in] chunkHeader, pointer to the ChunkHeader to send; the ownership of the pointer is transferred to this
+    /// method
+    /// @param[in] loadBalancingPolicy is the policy to select the ChunkQueuePopper
+    /// @param[in] routingKey is used to select the ChunkQueuePopper with LoadBalancingPolicy::CONSISTENT_HASH
+    /// @return true when successful, false otherwise
+    /// @note This method does not add the chunk to the history
+    bool sendToOneQueue(mepoo::ChunkHeader* const chunkHeader,
+                        const LoadBalancingPolicy loadBalancingPolicy,
+                        const uint64_t routingKey) noexcept;
+
     /// @brief Push an allocated chunk to the history without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to push to the history
     void pushToHistory(mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -145,6 +160,11 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @return true if there was a matching chunk with this header, false if not
     bool getChunkReadyForSend(const mepoo::ChunkHeader* const chunkHeader, mepoo::SharedChunk& chunk) noexcept;
 
+    /// @brief Copy the user-payload of the provided inline chunk into a queue element and free the inline chunk
+    /// @param[in] chunkHeader of the inline chunk that shall be send
+    /// @return the queue element with the user-payload or nullopt if the inline chunk was not allocated
+    optional<QueueElement_t> getInlineChunkReadyForSend(mepoo::ChunkHeader* const chunkHeader) noexcept;
+
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 };
@@ -110,12 +110,27 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
         mepoo::ChunkSettings::create(userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
     if (chunkSettingsResult.has_error())
     {
+        incrementStatistic(getMembers()->m_statistics.m_loanFailures);
         return err(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
     }
 
     const auto& chunkSettings = chunkSettingsResult.value();
     const uint64_t requiredChunkSize = chunkSettings.requiredChunkSize();
 
+    // small user-payloads are copied into the queues on send and need neither a mempool chunk nor the bookkeeping of
+    // the shared ownership
+    if (getMembers()->m_inlineUserPayload && MemberType_t::InlineChunkPool_t::fits(chunkSettings))
+    {
+        auto inlineChunk = getMembers()->m_inlineChunks.tryAllocate(chunkSettings);
+        if (!inlineChunk.has_value())
+        {
+            incrementStatistic(getMembers()->m_statistics.m_loanFailures);
+            return err(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
+        }
+        inlineChunk.value()->setOriginId(originId);
+        return ok(inlineChunk.value());
+    }
+
     auto& lastChunkUnmanaged = getMembers()->m_lastChunkUnmanaged;
     mepoo::ChunkHeader* lastChunkChunkHeader =
         lastChunkUnmanaged.isNotLogicalNullptrAndHasNoOtherOwners() ? lastChunkUnmanaged.getChunkHeader() : nullptr;
@@ -133,6 +148,7 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
         }
         else
         {
+            incrementStatistic(getMembers()->m_statistics.m_loanFailures);
             return err(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
         }
     }
@@ -144,6 +160,7 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
 
         if (getChunkResult.has_error())
         {
+            incrementStatistic(getMembers()->m_statistics.m_loanFailures);
             /// @todo iox-#1012 use error<E2>::from(E1); once available
             return err(into<AllocationError>(getChunkResult.error()));
         }
@@ -161,6 +178,7 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
         {
             // release the allocated chunk
             chunk = nullptr;
+            incrementStatistic(getMembers()->m_statistics.m_loanFailures);
             return err(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
         }
     }
@@ -169,6 +187,15 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
 template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
+    if (getMembers()->m_inlineChunks.contains(chunkHeader))
+    {
+        if (!getMembers()->m_inlineChunks.free(chunkHeader))
+        {
+            IOX_REPORT(PoshError::POPO__CHUNK_SENDER_INVALID_CHUNK_TO_FREE_FROM_USER, iox::er::RUNTIME_ERROR);
+        }
+        return;
+    }
+
     mepoo::SharedChunk chunk(nullptr);
     // d'tor of SharedChunk will release the memory, we do not have to touch the returned chunk
     if (!getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
@@ -180,6 +207,15 @@ inline void ChunkSender<ChunkSenderDataType>::release(const mepoo::ChunkHeader*
 template <typename ChunkSenderDataType>
 inline uint64_t ChunkSender<ChunkSenderDataType>::send(mepoo::ChunkHeader* const chunkHeader) noexcept
 {
+    if (getMembers()->m_inlineChunks.contains(chunkHeader))
+    {
+        uint64_t numberOfReceiverTheUserPayloadWasDelivered{0};
+        getInlineChunkReadyForSend(chunkHeader).and_then([&](auto& element) {
+            numberOfReceiverTheUserPayloadWasDelivered = this->deliverElementToAllStoredQueues(element);
+        });
+        return numberOfReceiverTheUserPayloadWasDelivered;
+    }
+
     uint64_t numberOfReceiverTheChunkWasDelivered{0};
     mepoo::SharedChunk chunk(nullptr);
     // BEGIN of critical section, chunk will be lost if the process terminates in this section
@@ -216,9 +252,38 @@ inline bool ChunkSender<ChunkSenderDataType>::sendToQueue(mepoo::ChunkHeader* co
     return false;
 }
 
+template <typename ChunkSenderDataType>
+inline bool ChunkSender<ChunkSenderDataType>::sendToOneQueue(mepoo::ChunkHeader* const chunkHeader,
+                                                             const LoadBalancingPolicy loadBalancingPolicy,
+                                                             const uint64_t routingKey) noexcept
+{
+    mepoo::SharedChunk chunk(nullptr);
+    // BEGIN of critical section, chunk will be lost if the process terminates in this section
+    if (getChunkReadyForSend(chunkHeader, chunk))
+    {
+        auto deliveryResult = this->deliverToOneOfStoredQueues(loadBalancingPolicy, routingKey, chunk);
+
+        getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+        getMembers()->m_lastChunkUnmanaged = chunk;
+
+        return !deliveryResult.has_error();
+    }
+    // END of critical section
+
+    return false;
+}
+
 template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::pushToHistory(mepoo::ChunkHeader* const chunkHeader) noexcept
 {
+    if (getMembers()->m_inlineChunks.contains(chunkHeader))
+    {
+        getInlineChunkReadyForSend(chunkHeader).and_then([&](auto& element) {
+            this->addElementToHistoryWithoutDelivery(element);
+        });
+        return;
+    }
+
     mepoo::SharedChunk chunk(nullptr);
     // BEGIN of critical section, chunk will be lost if the process terminates in this section
     if (getChunkReadyForSend(chunkHeader, chunk))
@@ -248,6 +313,7 @@ template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::releaseAll() noexcept
 {
     getMembers()->m_chunksInUse.cleanup();
+    getMembers()->m_inlineChunks.freeAll();
     this->cleanup();
     getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
 }
@@ -258,7 +324,13 @@ inline bool ChunkSender<ChunkSenderDataType>::getChunkReadyForSend(const mepoo::
 {
     if (getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
     {
-        chunk.getChunkHeader()->setSequenceNumber(getMembers()->m_sequenceNumber++);
+        auto sentChunkHeader = chunk.getChunkHeader();
+        sentChunkHeader->setSequenceNumber(getMembers()->m_sequenceNumber++);
+
+        auto& statistics = getMembers()->m_statistics;
+        incrementStatistic(statistics.m_sentChunks);
+        statistics.m_lastUserPayloadSize.store(sentChunkHeader->userPayloadSize(), std::memory_order_relaxed);
+        statistics.m_lastChunkSize.store(sentChunkHeader->chunkSize(), std::memory_order_relaxed);
         return true;
     }
     else
@@ -268,6 +340,33 @@ inline bool ChunkSender<ChunkSenderDataType>::getChunkReadyForSend(const mepoo::
     }
 }
 
+template <typename ChunkSenderDataType>
+inline optional<typename ChunkSender<ChunkSenderDataType>::QueueElement_t>
+ChunkSender<ChunkSenderDataType>::getInlineChunkReadyForSend(mepoo::ChunkHeader* const chunkHeader) noexcept
+{
+    // the inline chunk is only reused by the next allocation, therefore it can be read after it was returned to the
+    // pool
+    if (!getMembers()->m_inlineChunks.free(chunkHeader))
+    {
+        IOX_REPORT(PoshError::POPO__CHUNK_SENDER_INVALID_CHUNK_TO_SEND_FROM_USER, iox::er::RUNTIME_ERROR);
+        return nullopt;
+    }
+
+    chunkHeader->setSequenceNumber(getMembers()->m_sequenceNumber++);
+    auto element = QueueElement_t::fromInlineChunk(*chunkHeader);
+
+    auto& statistics = getMembers()->m_statistics;
+    incrementStatistic(statistics.m_sentChunks);
+    statistics.m_lastUserPayloadSize.store(chunkHeader->userPayloadSize(), std::memory_order_relaxed);
+    statistics.m_lastChunkSize.store(chunkHeader->chunkSize(), std::memory_order_relaxed);
+
+    // the previous chunk cannot be provided any longer since the user-payload of the inline chunk is only available
+    // in the queues
+    getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+
+    return element;
+}
+
 } // namespace popo
 } // namespace iox
 
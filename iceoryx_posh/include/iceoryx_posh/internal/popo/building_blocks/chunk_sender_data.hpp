@@ -18,6 +18,7 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_SENDER_DATA_HPP
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/inline_chunk_pool.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
@@ -39,12 +40,19 @@ struct ChunkSenderData : public ChunkDistributorDataType
                              const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
 
     using ChunkDistributorData_t = ChunkDistributorDataType;
+    using InlineChunkPool_t =
+        mepoo::InlineChunkPool<ChunkDistributorDataType::ChunkQueueData_t::QueueElement_t::INLINE_USER_PAYLOAD_CAPACITY,
+                               MaxChunksAllocatedSimultaneously>;
 
     const RelativePointer<mepoo::MemoryManager> m_memoryMgr;
     mepoo::MemoryInfo m_memoryInfo;
     UsedChunkList<MaxChunksAllocatedSimultaneously> m_chunksInUse;
     mepoo::SequenceNumber_t m_sequenceNumber{0U};
     mepoo::ShmSafeUnmanagedChunk m_lastChunkUnmanaged;
+    /// @brief the chunks for small user-payloads which are copied into the queues instead of being sent as chunk
+    InlineChunkPool_t m_inlineChunks;
+    /// @brief enables the allocation of small user-payloads from 'm_inlineChunks'
+    bool m_inlineUserPayload{false};
 };
 
 } // namespace popo
@@ -0,0 +1,114 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_STATISTICS_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_STATISTICS_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The statistics are placed on their own cache line to prevent false sharing with the members which are
+///        written by the other side of the communication, e.g. the read position of a queue
+constexpr uint64_t CHUNK_STATISTICS_ALIGNMENT{64U};
+
+/// @brief Monotonically increasing counters of a ChunkSender. They reside in shared memory and are updated with relaxed
+///        atomics on the hot path; RouDi reads them periodically to provide the port throughput introspection
+struct alignas(CHUNK_STATISTICS_ALIGNMENT) ChunkSenderStatistics
+{
+    /// @brief number of chunks which were sent
+    std::atomic<uint64_t> m_sentChunks{0U};
+    /// @brief number of chunks which were delivered to a queue; a chunk sent to multiple queues is counted per queue
+    std::atomic<uint64_t> m_deliveredChunks{0U};
+    /// @brief number of chunks which were dropped because of an overflow of a non-blocking queue
+    std::atomic<uint64_t> m_droppedChunks{0U};
+    /// @brief number of failed chunk allocations
+    std::atomic<uint64_t> m_loanFailures{0U};
+    /// @brief accumulated time the sender was blocked by a full queue with the BLOCK_PRODUCER policy
+    std::atomic<uint64_t> m_blockedTimeInNanoseconds{0U};
+    /// @brief user-payload size of the last sent chunk
+    std::atomic<uint64_t> m_lastUserPayloadSize{0U};
+    /// @brief size of the last sent chunk
+    std::atomic<uint64_t> m_lastChunkSize{0U};
+};
+
+/// @brief Monotonically increasing counters of a ChunkQueue. They are updated by the ChunkQueuePusher with relaxed
+///        atomics and can be written by multiple senders concurrently
+struct alignas(CHUNK_STATISTICS_ALIGNMENT) ChunkQueueStatistics
+{
+    /// @brief number of chunks which were pushed without an overflow
+    std::atomic<uint64_t> m_receivedChunks{0U};
+    /// @brief number of chunks which were lost due to an overflow
+    std::atomic<uint64_t> m_lostChunks{0U};
+};
+
+/// @brief Increments a statistics counter; the counters are only used for monitoring, therefore no ordering is required
+/// @param[in] counter to increment
+/// @param[in] value to add to the counter
+inline void incrementStatistic(std::atomic<uint64_t>& counter, const uint64_t value = 1U) noexcept
+{
+    counter.fetch_add(value, std::memory_order_relaxed);
+}
+
+/// @brief Measures the time a sender is blocked by a full queue and adds it to the statistics when it goes out of
+///        scope. The clock is only read when the sender actually blocks, hence the non-blocking path is not affected.
+class BlockedTimeRecorder
+{
+  public:
+    explicit BlockedTimeRecorder(ChunkSenderStatistics& statistics) noexcept
+        : m_statistics(statistics)
+    {
+    }
+
+    BlockedTimeRecorder(const BlockedTimeRecorder&) = delete;
+    BlockedTimeRecorder(BlockedTimeRecorder&&) = delete;
+    BlockedTimeRecorder& operator=(const BlockedTimeRecorder&) = delete;
+    BlockedTimeRecorder& operator=(BlockedTimeRecorder&&) = delete;
+
+    ~BlockedTimeRecorder() noexcept
+    {
+        if (m_isBlocked)
+        {
+            const auto blockedTime = std::chrono::steady_clock::now() - m_start;
+            incrementStatistic(m_statistics.m_blockedTimeInNanoseconds,
+                               static_cast<uint64_t>(
+                                   std::chrono::duration_cast<std::chrono::nanoseconds>(blockedTime).count()));
+        }
+    }
+
+    /// @brief Marks the beginning of the blocking; subsequent calls have no effect
+    void blocked() noexcept
+    {
+        if (!m_isBlocked)
+        {
+            m_isBlocked = true;
+            m_start = std::chrono::steady_clock::now();
+        }
+    }
+
+  private:
+    ChunkSenderStatistics& m_statistics;
+    bool m_isBlocked{false};
+    std::chrono::steady_clock::time_point m_start;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_STATISTICS_HPP
@@ -20,6 +20,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iox/algorithm.hpp"
+#include "iox/duration.hpp"
 
 namespace iox
 {
@@ -48,6 +49,12 @@ class ConditionListener
     ///         returns an empty vector.
     void destroy() volatile noexcept;
 
+    /// @brief Sets the time the wait calls busy poll for notifications before they block. A notification which
+    /// arrives within the budget is collected without the latency of a syscall and a scheduler wake-up, at the cost of
+    /// CPU time. The default of zero blocks immediately.
+    /// @param[in] budget the maximum time to busy poll per wait call
+    void setBusyPollBudget(const units::Duration budget) noexcept;
+
     /// @brief returns a sorted vector of indices of active notifications; blocking if ConditionVariableData was
     /// not notified unless destroy() was called before. The indices of active notifications are
     /// never empty unless destroy() was called, then it's always empty.
@@ -72,11 +79,12 @@ class ConditionListener
     void resetUnchecked(const uint64_t index) noexcept;
     void resetSemaphore() noexcept;
 
-    NotificationVector_t waitImpl(const function_ref<bool()> waitCall) noexcept;
+    NotificationVector_t waitImpl(const units::Duration busyPollBudget, const function_ref<bool()> waitCall) noexcept;
 
   private:
     ConditionVariableData* m_condVarDataPtr{nullptr};
     std::atomic_bool m_toBeDestroyed{false};
+    units::Duration m_busyPollBudget{units::Duration::fromNanoseconds(0U)};
 };
 
 } // namespace popo
@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iox/futex_semaphore.hpp"
 #include "iox/unnamed_semaphore.hpp"
 
 #include <atomic>
@@ -29,6 +30,14 @@ namespace popo
 {
 struct ConditionVariableData
 {
+#if defined(IOX_FUTEX_SEMAPHORE_AVAILABLE)
+    /// @brief The futex based semaphore skips the syscall in 'post' when the listener is not sleeping, which is the
+    /// common case for a listener which is busy processing or polling
+    using Semaphore_t = FutexSemaphore;
+#else
+    using Semaphore_t = UnnamedSemaphore;
+#endif
+
     ConditionVariableData() noexcept;
     explicit ConditionVariableData(const RuntimeName_t& runtimeName) noexcept;
 
@@ -38,7 +47,7 @@ struct ConditionVariableData
     ConditionVariableData& operator=(ConditionVariableData&& rhs) = delete;
     ~ConditionVariableData() noexcept = default;
 
-    optional<UnnamedSemaphore> m_semaphore;
+    optional<Semaphore_t> m_semaphore;
     RuntimeName_t m_runtimeName;
     std::atomic_bool m_toBeDestroyed{false};
     std::atomic_bool m_activeNotifications[MAX_NUMBER_OF_NOTIFIERS];
@@ -70,6 +70,12 @@ class UniquePortId : public NewType<UniquePortId,
     bool isValid() const noexcept;
 
   private:
+    template <uint64_t InlineUserPayloadCapacity>
+    friend class ChunkQueueElement;
+
+    /// @brief Restores an id from its underlying value, e.g. after it was transferred with an inline user-payload
+    UniquePortId(const ThisType::value_type value, newtype::internal::ProtectedConstructor_t) noexcept;
+
     // NOTE must be 'delete' instead of just leaving it out else the 'gMocks' will create compile errors
     UniquePortId() noexcept = delete;
 
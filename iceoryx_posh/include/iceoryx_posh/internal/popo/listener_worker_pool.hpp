@@ -0,0 +1,99 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_LISTENER_WORKER_POOL_HPP
+#define IOX_POSH_POPO_LISTENER_WORKER_POOL_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/popo/listener_options.hpp"
+#include "iox/detail/mpmc_lockfree_queue.hpp"
+#include "iox/function.hpp"
+#include "iox/optional.hpp"
+#include "iox/thread.hpp"
+#include "iox/unnamed_semaphore.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Executes the callbacks of the Listener on a pool of worker threads. Every worker owns a queue of ready
+///        events. Ready events are distributed round-robin over these queues and a worker without pending events
+///        steals them from the queues of the other workers. An event is never executed concurrently; when it is
+///        dispatched while its callback is running, it is executed once more after the callback has returned.
+class ListenerWorkerPool
+{
+  public:
+    using Execute_t = function<void(uint32_t)>;
+
+    static constexpr uint32_t MAX_NUMBER_OF_EVENTS = MAX_NUMBER_OF_EVENTS_PER_LISTENER;
+    static constexpr uint32_t MAX_NUMBER_OF_WORKERS = MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER;
+
+    /// @brief Creates the pool and starts one worker per entry in workerOptions
+    /// @param[in] workerOptions the scheduling options of every worker, must not be empty
+    /// @param[in] execute the callable which executes the event with the provided index
+    ListenerWorkerPool(const vector<ListenerWorkerOptions, MAX_NUMBER_OF_WORKERS>& workerOptions,
+                       const Execute_t& execute) noexcept;
+
+    /// @brief Stops all workers and waits until the callbacks which are currently executed have returned
+    ~ListenerWorkerPool() noexcept;
+
+    ListenerWorkerPool(const ListenerWorkerPool&) = delete;
+    ListenerWorkerPool(ListenerWorkerPool&&) = delete;
+    ListenerWorkerPool& operator=(const ListenerWorkerPool&) = delete;
+    ListenerWorkerPool& operator=(ListenerWorkerPool&&) = delete;
+
+    /// @brief Schedules the execution of the event with the provided index on one of the workers
+    /// @param[in] index of the event, must be smaller than MAX_NUMBER_OF_EVENTS
+    void dispatch(const uint32_t index) noexcept;
+
+    /// @brief Returns the number of workers
+    /// @return number of workers
+    uint64_t numberOfWorkers() const noexcept;
+
+  private:
+    enum class EventState : uint8_t
+    {
+        IDLE,
+        QUEUED,
+        RUNNING,
+        RUNNING_AND_DISPATCHED_AGAIN
+    };
+
+    void enqueue(const uint32_t index) noexcept;
+    uint32_t takeReadyEvent(const uint64_t workerIndex) noexcept;
+    void execute(const uint32_t index) noexcept;
+    void workerLoop(const uint64_t workerIndex) noexcept;
+
+  private:
+    using ReadyQueue_t = concurrent::MpmcLockFreeQueue<uint32_t, MAX_NUMBER_OF_EVENTS>;
+
+    Execute_t m_execute;
+    uint64_t m_numberOfWorkers{0U};
+    std::atomic<EventState> m_eventStates[MAX_NUMBER_OF_EVENTS];
+    ReadyQueue_t m_readyQueues[MAX_NUMBER_OF_WORKERS];
+    std::atomic<uint64_t> m_nextReadyQueue{0U};
+    optional<UnnamedSemaphore> m_readyEvents;
+    std::atomic_bool m_keepRunning{true};
+    optional<Thread> m_workers[MAX_NUMBER_OF_WORKERS];
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_LISTENER_WORKER_POOL_HPP
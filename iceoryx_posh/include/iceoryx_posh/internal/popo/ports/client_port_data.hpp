@@ -47,6 +47,7 @@ struct ClientPortData : public BasePortData
     ClientChunkReceiverData_t m_chunkReceiverData;
     std::atomic_bool m_connectRequested{false};
     std::atomic<ConnectionState> m_connectionState{ConnectionState::NOT_CONNECTED};
+    const LoadBalancingPolicy m_loadBalancingPolicy{LoadBalancingPolicy::ROUND_ROBIN};
 };
 
 } // namespace popo
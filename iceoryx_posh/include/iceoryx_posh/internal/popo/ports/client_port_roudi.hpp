@@ -31,7 +31,8 @@ namespace popo
 /// @brief The ClientPortRouDi provides the API for accessing a client port from the RouDi middleware daemon side.
 /// The client port is divided in the three parts ClientPortData, ClientPortRouDi and ClientPortUser.
 /// The ClientPortRouDi provides service discovery functionality that is based on CaPro messages. With this API the
-/// dynamic connections between clients and servers ports can be established.
+/// dynamic connections between clients and servers ports can be established. A client can be connected to multiple
+/// servers of the same service if the servers were created with ServerOptions::allowMultipleServers.
 /// @note This class is not thread-safe and must be guarded by a mutex if used in a multithreaded context.
 class ClientPortRouDi : public BasePort
 {
@@ -86,6 +87,10 @@ class ClientPortRouDi : public BasePort
     optional<capro::CaproMessage>
     handleCaProMessageForStateDisconnectRequested(const capro::CaproMessage& caProMessage) noexcept;
 
+    capro::CaproMessage createConnectMessage() noexcept;
+    void addServerRequestQueue(const capro::CaproMessage& caProMessage) noexcept;
+    void removeServerRequestQueue(const capro::CaproMessage& caProMessage) noexcept;
+
     ChunkSender<ClientChunkSenderData_t> m_chunkSender;
     ChunkReceiver<ClientChunkReceiverData_t> m_chunkReceiver;
 };
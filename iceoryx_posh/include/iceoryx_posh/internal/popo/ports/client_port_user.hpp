@@ -88,7 +88,8 @@ class ClientPortUser : public BasePort
     /// @param[in] requestHeader, pointer to the RequestHeader to free
     void releaseRequest(const RequestHeader* const requestHeader) noexcept;
 
-    /// @brief Send an allocated request chunk to the server port
+    /// @brief Send an allocated request chunk to the server port; if multiple server ports offer the service, one of
+    /// them is selected according to the ClientOptions::loadBalancingPolicy
     /// @param[in] requestHeader, pointer to the RequestHeader to send
     /// @return ClientSendError if sending was not successful
     expected<void, ClientSendError> sendRequest(RequestHeader* const requestHeader) noexcept;
@@ -31,7 +31,7 @@ namespace popo
 {
 struct ClientChunkDistributorConfig
 {
-    static constexpr uint32_t MAX_QUEUES = 1;
+    static constexpr uint32_t MAX_QUEUES = MAX_SERVERS_PER_CLIENT;
     static constexpr uint64_t MAX_HISTORY_CAPACITY = 1; // could be 0, but problem for the container then
 };
 
@@ -44,11 +44,13 @@ struct ServerChunkDistributorConfig
 struct ClientChunkQueueConfig
 {
     static constexpr uint64_t MAX_QUEUE_CAPACITY = MAX_RESPONSE_QUEUE_CAPACITY;
+    static constexpr uint64_t INLINE_USER_PAYLOAD_CAPACITY = 0U;
 };
 
 struct ServerChunkQueueConfig
 {
     static constexpr uint64_t MAX_QUEUE_CAPACITY = MAX_REQUEST_QUEUE_CAPACITY;
+    static constexpr uint64_t INLINE_USER_PAYLOAD_CAPACITY = 0U;
 };
 
 using ClientChunkQueueData_t = ChunkQueueData<ClientChunkQueueConfig, ThreadSafePolicy>;
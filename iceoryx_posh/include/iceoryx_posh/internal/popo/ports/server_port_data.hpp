@@ -20,6 +20,7 @@
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/internal/popo/ports/base_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_server_port_types.hpp"
 #include "iceoryx_posh/popo/server_options.hpp"
@@ -45,6 +46,14 @@ struct ServerPortData : public BasePortData
     std::atomic_bool m_offeringRequested{false};
     std::atomic_bool m_offered{false};
 
+    /// @brief if set, the access of the ServerPortUser to the chunks held by the user is serialized with the
+    /// m_requestProcessingLock in order to take requests and send responses from multiple threads concurrently
+    const bool m_concurrentRequestProcessing{false};
+    ThreadSafePolicy m_requestProcessingLock;
+
+    /// @brief if set, RouDi accepts further servers with the same service description which also set this option
+    const bool m_allowMultipleServers{false};
+
     static constexpr uint64_t HISTORY_REQUEST_OF_ZERO{0U};
 };
 
@@ -92,7 +92,8 @@ inline log::LogStream& operator<<(log::LogStream& stream, ServerSendError value)
 /// is divided in the three parts ServerPortData, ServerPortRouDi and ServerPortUser. The ServerPortUser
 /// uses the functionality of a ChunkSender and ChunReceiver for receiving requests and sending responses.
 /// Additionally it provides the offer / stopOffer API which controls whether the server is discoverable
-/// for client ports
+/// for client ports. If ServerOptions::concurrentRequestProcessing is set, requests can be taken and responses can be
+/// sent from multiple threads concurrently.
 class ServerPortUser : public BasePort
 {
   public:
@@ -173,6 +174,22 @@ class ServerPortUser : public BasePort
     bool isConditionVariableSet() const noexcept;
 
   private:
+    /// @brief Serializes the access to the chunks held by the user if the server is used by multiple threads
+    class RequestProcessingGuard
+    {
+      public:
+        explicit RequestProcessingGuard(const MemberType_t& serverPortData) noexcept;
+        ~RequestProcessingGuard() noexcept;
+
+        RequestProcessingGuard(const RequestProcessingGuard&) = delete;
+        RequestProcessingGuard(RequestProcessingGuard&&) = delete;
+        RequestProcessingGuard& operator=(const RequestProcessingGuard&) = delete;
+        RequestProcessingGuard& operator=(RequestProcessingGuard&&) = delete;
+
+      private:
+        const MemberType_t& m_serverPortData;
+    };
+
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
@@ -85,11 +85,74 @@ class PublisherImpl : public BasePublisherType, private PublisherInterface<T, H>
     PublisherImpl(PortType&& port) noexcept;
 
   private:
+    /// @brief inline user-payloads are copied into the queues and are therefore only used for trivially copyable types
+    static PublisherOptions withSupportedInlineUserPayload(const PublisherOptions& publisherOptions) noexcept;
+
     Sample<T, H> convertChunkHeaderToSample(mepoo::ChunkHeader* const header) noexcept;
 
     expected<Sample<T, H>, AllocationError> loanSample() noexcept;
 };
 
+/// @brief The PublisherImpl specialization for slices of T, i.e. 'Publisher<T[]>', which loans samples with a number of
+/// elements that is chosen for each sample instead of a worst-case sized type
+/// @note Not intended for public usage! Use the 'Publisher' instead!
+template <typename T, typename H, typename BasePublisherType>
+class PublisherImpl<T[], H, BasePublisherType> : public BasePublisherType, private PublisherInterface<T[], H>
+{
+    using DataTypeAssert = typename TypedPortApiTrait<T>::Assert;
+    using HeaderTypeAssert = typename TypedPortApiTrait<H>::Assert;
+
+  public:
+    explicit PublisherImpl(const capro::ServiceDescription& service,
+                           const PublisherOptions& publisherOptions = PublisherOptions());
+
+    virtual ~PublisherImpl() = default;
+
+    PublisherImpl(const PublisherImpl& other) = delete;
+    PublisherImpl& operator=(const PublisherImpl&) = delete;
+    PublisherImpl(PublisherImpl&& rhs) noexcept = delete;
+    PublisherImpl& operator=(PublisherImpl&& rhs) noexcept = delete;
+
+    ///
+    /// @brief loan Get a slice from loaned shared memory and construct each element with the given arguments.
+    /// @param numberOfElements The number of elements of the slice.
+    /// @param args Arguments used to construct each element.
+    /// @return An instance of the sample that resides in shared memory or an error if unable ot allocate memory to
+    /// loan.
+    /// @details The loaned sample is automatically released when it goes out of scope.
+    ///
+    template <typename... Args>
+    expected<Sample<T[], H>, AllocationError> loan(const uint64_t numberOfElements, Args&&... args) noexcept;
+
+    ///
+    /// @brief publish Publishes the given sample and then releases its loan.
+    /// @param sample The sample to publish.
+    ///
+    void publish(Sample<T[], H>&& sample) noexcept override;
+
+    ///
+    /// @brief publishCopyOf Copy the provided elements into a loaned shared memory chunk and publish it.
+    /// @param elements Pointer to the elements to copy.
+    /// @param numberOfElements The number of elements to copy.
+    /// @return Error if unable to allocate memory to loan.
+    ///
+    expected<void, AllocationError> publishCopyOf(const T* const elements, const uint64_t numberOfElements) noexcept;
+
+  protected:
+    using PortType = typename BasePublisherType::PortType;
+    using BasePublisherType::port;
+
+    PublisherImpl(PortType&& port) noexcept;
+
+  private:
+    /// @brief inline user-payloads are copied into the queues and are therefore only used for trivially copyable types
+    static PublisherOptions withSupportedInlineUserPayload(const PublisherOptions& publisherOptions) noexcept;
+
+    Sample<T[], H> convertChunkHeaderToSample(mepoo::ChunkHeader* const header) noexcept;
+
+    expected<Sample<T[], H>, AllocationError> loanSlice(const uint64_t numberOfElements) noexcept;
+};
+
 } // namespace popo
 } // namespace iox
 
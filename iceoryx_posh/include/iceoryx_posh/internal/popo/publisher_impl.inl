@@ -22,6 +22,8 @@
 #include "iceoryx_posh/internal/popo/publisher_impl.hpp"
 
 #include <cstdint>
+#include <limits>
+#include <type_traits>
 
 namespace iox
 {
@@ -30,10 +32,19 @@ namespace popo
 template <typename T, typename H, typename BasePublisherType>
 inline PublisherImpl<T, H, BasePublisherType>::PublisherImpl(const capro::ServiceDescription& service,
                                                              const PublisherOptions& publisherOptions)
-    : BasePublisherType(service, publisherOptions)
+    : BasePublisherType(service, withSupportedInlineUserPayload(publisherOptions))
 {
 }
 
+template <typename T, typename H, typename BasePublisherType>
+inline PublisherOptions PublisherImpl<T, H, BasePublisherType>::withSupportedInlineUserPayload(
+    const PublisherOptions& publisherOptions) noexcept
+{
+    auto supportedOptions = publisherOptions;
+    supportedOptions.inlineUserPayload = publisherOptions.inlineUserPayload && std::is_trivially_copyable<T>::value;
+    return supportedOptions;
+}
+
 template <typename T, typename H, typename BasePublisherType>
 inline PublisherImpl<T, H, BasePublisherType>::PublisherImpl(PortType&& port) noexcept
     : BasePublisherType(std::move(port))
@@ -111,6 +122,98 @@ PublisherImpl<T, H, BasePublisherType>::convertChunkHeaderToSample(mepoo::ChunkH
                         *this);
 }
 
+template <typename T, typename H, typename BasePublisherType>
+inline PublisherImpl<T[], H, BasePublisherType>::PublisherImpl(const capro::ServiceDescription& service,
+                                                               const PublisherOptions& publisherOptions)
+    : BasePublisherType(service, withSupportedInlineUserPayload(publisherOptions))
+{
+}
+
+template <typename T, typename H, typename BasePublisherType>
+inline PublisherOptions PublisherImpl<T[], H, BasePublisherType>::withSupportedInlineUserPayload(
+    const PublisherOptions& publisherOptions) noexcept
+{
+    auto supportedOptions = publisherOptions;
+    supportedOptions.inlineUserPayload = publisherOptions.inlineUserPayload && std::is_trivially_copyable<T>::value;
+    return supportedOptions;
+}
+
+template <typename T, typename H, typename BasePublisherType>
+inline PublisherImpl<T[], H, BasePublisherType>::PublisherImpl(PortType&& port) noexcept
+    : BasePublisherType(std::move(port))
+{
+}
+
+template <typename T, typename H, typename BasePublisherType>
+template <typename... Args>
+inline expected<Sample<T[], H>, AllocationError>
+PublisherImpl<T[], H, BasePublisherType>::loan(const uint64_t numberOfElements, Args&&... args) noexcept
+{
+    return loanSlice(numberOfElements).and_then([&](auto& sample) {
+        for (auto& element : sample)
+        {
+            new (&element) T(args...);
+        }
+    });
+}
+
+template <typename T, typename H, typename BasePublisherType>
+inline expected<void, AllocationError>
+PublisherImpl<T[], H, BasePublisherType>::publishCopyOf(const T* const elements,
+                                                        const uint64_t numberOfElements) noexcept
+{
+    return loanSlice(numberOfElements).and_then([&](auto& sample) {
+        for (uint64_t i = 0U; i < numberOfElements; ++i)
+        {
+            new (&sample.get()[i]) T(elements[i]);
+        }
+        sample.publish();
+    });
+}
+
+template <typename T, typename H, typename BasePublisherType>
+inline expected<Sample<T[], H>, AllocationError>
+PublisherImpl<T[], H, BasePublisherType>::loanSlice(const uint64_t numberOfElements) noexcept
+{
+    static constexpr uint32_t USER_HEADER_SIZE{std::is_same<H, mepoo::NoUserHeader>::value ? 0U : sizeof(H)};
+
+    if (numberOfElements > std::numeric_limits<uint64_t>::max() / sizeof(T))
+    {
+        return err(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
+    }
+
+    auto result = port().tryAllocateChunk(numberOfElements * sizeof(T), alignof(T), USER_HEADER_SIZE, alignof(H));
+    if (result.has_error())
+    {
+        return err(result.error());
+    }
+    else
+    {
+        return ok(convertChunkHeaderToSample(result.value()));
+    }
+}
+
+template <typename T, typename H, typename BasePublisherType>
+inline void PublisherImpl<T[], H, BasePublisherType>::publish(Sample<T[], H>&& sample) noexcept
+{
+    auto userPayload = sample.release(); // release the Samples ownership of the chunk before publishing
+    auto chunkHeader = mepoo::ChunkHeader::fromUserPayload(userPayload);
+    port().sendChunk(chunkHeader);
+}
+
+template <typename T, typename H, typename BasePublisherType>
+inline Sample<T[], H>
+PublisherImpl<T[], H, BasePublisherType>::convertChunkHeaderToSample(mepoo::ChunkHeader* const header) noexcept
+{
+    return Sample<T[], H>(iox::unique_ptr<T>(reinterpret_cast<T*>(header->userPayload()),
+                                             [this](T* userPayload) {
+                                                 auto* chunkHeader =
+                                                     iox::mepoo::ChunkHeader::fromUserPayload(userPayload);
+                                                 this->port().releaseChunk(chunkHeader);
+                                             }),
+                          *this);
+}
+
 } // namespace popo
 } // namespace iox
 
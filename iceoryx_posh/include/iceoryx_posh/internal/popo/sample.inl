@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iceoryx_posh/popo/sample.hpp"
+#include "iox/assertions.hpp"
 
 namespace iox
 {
@@ -38,6 +39,88 @@ void Sample<T, H>::publish() noexcept
         IOX_REPORT(PoshError::POSH__PUBLISHING_EMPTY_SAMPLE, iox::er::RUNTIME_ERROR);
     }
 }
+
+template <typename T, typename H>
+inline uint64_t Sample<T[], H>::size() const noexcept
+{
+    return BaseType::getChunkHeader()->userPayloadSize() / sizeof(T);
+}
+
+template <typename T, typename H>
+inline bool Sample<T[], H>::empty() const noexcept
+{
+    return size() == 0U;
+}
+
+template <typename T, typename H>
+inline T& Sample<T[], H>::operator[](const uint64_t index) noexcept
+{
+    IOX_ENFORCE(index < size(), "Out of bounds access");
+    return BaseType::get()[index];
+}
+
+template <typename T, typename H>
+inline const T& Sample<T[], H>::operator[](const uint64_t index) const noexcept
+{
+    IOX_ENFORCE(index < size(), "Out of bounds access");
+    return BaseType::get()[index];
+}
+
+template <typename T, typename H>
+inline T* Sample<T[], H>::begin() noexcept
+{
+    return BaseType::get();
+}
+
+template <typename T, typename H>
+inline const T* Sample<T[], H>::begin() const noexcept
+{
+    return BaseType::get();
+}
+
+template <typename T, typename H>
+inline T* Sample<T[], H>::end() noexcept
+{
+    return BaseType::get() + size();
+}
+
+template <typename T, typename H>
+inline const T* Sample<T[], H>::end() const noexcept
+{
+    return BaseType::get() + size();
+}
+
+template <typename T, typename H>
+template <typename S, typename>
+inline bool Sample<T[], H>::shrink(const uint64_t numberOfElements) noexcept
+{
+    const auto currentNumberOfElements = size();
+    if (numberOfElements > currentNumberOfElements)
+    {
+        return false;
+    }
+
+    for (uint64_t i = numberOfElements; i < currentNumberOfElements; ++i)
+    {
+        BaseType::get()[i].~T();
+    }
+    return BaseType::getChunkHeader()->shrinkUserPayloadSize(numberOfElements * sizeof(T));
+}
+
+template <typename T, typename H>
+template <typename S, typename>
+inline void Sample<T[], H>::publish() noexcept
+{
+    if (BaseType::m_members.smartChunkUniquePtr)
+    {
+        BaseType::m_members.producerRef.get().publish(std::move(*(this)));
+    }
+    else
+    {
+        IOX_LOG(ERROR, "Tried to publish empty Sample! Might be an already published or moved Sample!");
+        IOX_REPORT(PoshError::POSH__PUBLISHING_EMPTY_SAMPLE, iox::er::RUNTIME_ERROR);
+    }
+}
 } // namespace popo
 } // namespace iox
 
@@ -27,6 +27,7 @@ namespace popo
 {
 /// @brief The SubscriberImpl class implements the typed subscriber API
 /// @note Not intended for public usage! Use the 'Subscriber' instead!
+/// @note With a slice 'T[]' as data type, the subscriber takes the slices which are published by a 'Publisher<T[]>'
 template <typename T, typename H = iox::mepoo::NoUserHeader, typename BaseSubscriberType = BaseSubscriber<>>
 class SubscriberImpl : public BaseSubscriberType
 {
@@ -54,6 +55,18 @@ class SubscriberImpl : public BaseSubscriberType
     ///
     expected<Sample<const T, const H>, ChunkReceiveResult> take() noexcept;
 
+    ///
+    /// @brief Take the sample from the top of the receive queue and wait for it if the queue is empty.
+    /// @param[in] timeout the maximum time to wait for a sample
+    /// @param[in] busyPollBudget the part of the timeout which is spent with busy polling the receive queue before
+    /// the thread is put to sleep; this lowers the wake-up latency at the cost of CPU time
+    /// @return Either a sample or a ChunkReceiveResult; ChunkReceiveResult::NO_CHUNK_AVAILABLE when the timeout
+    /// has passed without a sample
+    ///
+    expected<Sample<const T, const H>, ChunkReceiveResult>
+    takeBlocking(const units::Duration timeout,
+                 const units::Duration busyPollBudget = units::Duration::fromNanoseconds(0U)) noexcept;
+
   protected:
     using PortType = typename BaseSubscriberType::PortType;
     using BaseSubscriberType::port;
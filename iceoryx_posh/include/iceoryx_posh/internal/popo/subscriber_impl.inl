@@ -19,6 +19,9 @@
 #define IOX_POSH_POPO_TYPED_SUBSCRIBER_IMPL_INL
 
 #include "iceoryx_posh/internal/popo/subscriber_impl.hpp"
+#include "iox/deadline_timer.hpp"
+
+#include <type_traits>
 
 namespace iox
 {
@@ -45,14 +48,37 @@ inline expected<Sample<const T, const H>, ChunkReceiveResult> SubscriberImpl<T,
     {
         return err(result.error());
     }
-    auto userPayloadPtr = static_cast<const T*>(result.value()->userPayload());
-    auto samplePtr = iox::unique_ptr<const T>(userPayloadPtr, [this](const T* userPayload) {
+    // for a slice 'T[]' the sample refers to the first element of the slice
+    using Element_t = std::remove_extent_t<T>;
+    auto userPayloadPtr = static_cast<const Element_t*>(result.value()->userPayload());
+    auto samplePtr = iox::unique_ptr<const Element_t>(userPayloadPtr, [this](const Element_t* userPayload) {
         auto* chunkHeader = iox::mepoo::ChunkHeader::fromUserPayload(userPayload);
         this->port().releaseChunk(chunkHeader);
     });
     return ok<Sample<const T, const H>>(std::move(samplePtr));
 }
 
+template <typename T, typename H, typename BaseSubscriberType>
+inline expected<Sample<const T, const H>, ChunkReceiveResult>
+SubscriberImpl<T, H, BaseSubscriberType>::takeBlocking(const units::Duration timeout,
+                                                       const units::Duration busyPollBudget) noexcept
+{
+    deadline_timer deadline(timeout);
+    while (true)
+    {
+        auto result = take();
+        if (!result.has_error() || result.error() != ChunkReceiveResult::NO_CHUNK_AVAILABLE || deadline.hasExpired())
+        {
+            return result;
+        }
+
+        if (!BaseSubscriberType::waitForData(deadline.remainingTime(), busyPollBudget))
+        {
+            return err(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+        }
+    }
+}
+
 template <typename T, typename H, typename BaseSubscriberType>
 inline SubscriberImpl<T, H, BaseSubscriberType>::~SubscriberImpl() noexcept
 {
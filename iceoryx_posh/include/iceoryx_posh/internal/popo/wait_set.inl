@@ -402,6 +402,12 @@ WaitSet<Capacity>::waitAndReturnTriggeredTriggers(const WaitFunction& wait) noex
     return createVectorWithTriggeredTriggers();
 }
 
+template <uint64_t Capacity>
+inline void WaitSet<Capacity>::setBusyPollBudget(const units::Duration budget) noexcept
+{
+    m_conditionListener.setBusyPollBudget(budget);
+}
+
 template <uint64_t Capacity>
 inline uint64_t WaitSet<Capacity>::size() const noexcept
 {
@@ -0,0 +1,54 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_INTROSPECTION_FINGERPRINT_HPP
+#define IOX_POSH_ROUDI_INTROSPECTION_FINGERPRINT_HPP
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Accumulates the values of an introspection topic into a 64 bit FNV-1a hash. The introspection compares the
+/// fingerprint of a prepared topic with the one of the previously sent topic and does not send unchanged data again.
+class Fingerprint
+{
+  public:
+    /// @brief adds an integral value to the fingerprint
+    /// @param[in] value to add
+    /// @return reference to the fingerprint for chaining
+    Fingerprint& add(const uint64_t value) noexcept;
+
+    /// @brief adds a floating point value with its bit pattern to the fingerprint
+    /// @param[in] value to add
+    /// @return reference to the fingerprint for chaining
+    Fingerprint& add(const double value) noexcept;
+
+    /// @brief returns the hash of all values which were added
+    uint64_t value() const noexcept;
+
+  private:
+    static constexpr uint64_t FNV_OFFSET_BASIS{14695981039346656037U};
+    static constexpr uint64_t FNV_PRIME{1099511628211U};
+
+    uint64_t m_value{FNV_OFFSET_BASIS};
+};
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_INTROSPECTION_FINGERPRINT_HPP
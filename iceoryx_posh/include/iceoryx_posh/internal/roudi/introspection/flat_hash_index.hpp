@@ -0,0 +1,121 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_INTROSPECTION_FLAT_HASH_INDEX_HPP
+#define IOX_POSH_ROUDI_INTROSPECTION_FLAT_HASH_INDEX_HPP
+
+#include "iox/optional.hpp"
+#include "iox/uninitialized_array.hpp"
+
+#include <cstdint>
+#include <limits>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Returns the number of slots of a FlatHashIndex, i.e. the smallest power of two which is at least twice the
+/// capacity
+constexpr uint64_t flatHashIndexNumberOfSlots(const uint64_t capacity) noexcept
+{
+    uint64_t slots{1U};
+    while (slots < 2U * capacity)
+    {
+        slots <<= 1U;
+    }
+    return slots;
+}
+
+/// @brief Maps hash values to the positions of elements in a fixed capacity container, e.g. the
+/// FixedPositionContainer, without allocating memory. The keys themselves are not stored; elements with the same key
+/// have the same hash value and the user distinguishes colliding keys by comparing them with the elements at the
+/// returned positions. Therefore the index can be used as map for unique keys as well as multimap.
+/// The entries are stored with open addressing and linear probing in a contiguous array which has at least twice the
+/// capacity, in order to keep the probe sequences short. Erased entries are removed by shifting the following entries
+/// of the probe sequence back, therefore the lookup does not degrade over time like with tombstones.
+/// @tparam Capacity is the maximum number of entries, i.e. the capacity of the corresponding container
+template <uint64_t Capacity>
+class FlatHashIndex
+{
+  public:
+    FlatHashIndex() noexcept;
+
+    FlatHashIndex(const FlatHashIndex&) = delete;
+    FlatHashIndex(FlatHashIndex&&) = delete;
+    FlatHashIndex& operator=(const FlatHashIndex&) = delete;
+    FlatHashIndex& operator=(FlatHashIndex&&) = delete;
+
+    ~FlatHashIndex() noexcept = default;
+
+    /// @brief Adds an entry; the same hash value can be added multiple times with different positions
+    /// @param[in] hash of the key of the element
+    /// @param[in] position of the element in the container
+    /// @return true if the entry was added, false if the index is full
+    bool insert(const uint64_t hash, const uint64_t position) noexcept;
+
+    /// @brief Removes the entry with the provided hash value and position
+    /// @param[in] hash of the key of the element
+    /// @param[in] position of the element in the container
+    /// @return true if the entry was removed, false if it is not contained in the index
+    bool erase(const uint64_t hash, const uint64_t position) noexcept;
+
+    /// @brief Returns the position of the first entry with the provided hash value for which the predicate is true
+    /// @param[in] hash of the key which is searched for
+    /// @param[in] predicate with the signature 'bool(uint64_t position)' which compares the key of the element at the
+    /// position with the key which is searched for
+    /// @return the position of the element or nullopt if there is no such element
+    template <typename Predicate>
+    optional<uint64_t> findIf(const uint64_t hash, const Predicate& predicate) const noexcept;
+
+    /// @brief Calls the provided callable with the positions of all entries with the provided hash value; since
+    /// different keys can have the same hash value, the callable must compare the keys
+    /// @param[in] hash of the key which is searched for
+    /// @param[in] callable with the signature 'void(uint64_t position)'; it must not modify the index
+    template <typename Callable>
+    void forEach(const uint64_t hash, const Callable& callable) const noexcept;
+
+    /// @brief Returns the number of entries in the index
+    uint64_t size() const noexcept;
+
+  private:
+    using Position_t = uint32_t;
+    static constexpr Position_t EMPTY{std::numeric_limits<Position_t>::max()};
+
+    static_assert(Capacity > 0U, "The capacity must be greater than zero");
+    static_assert(Capacity < EMPTY, "The capacity exceeds the range of the position type");
+
+    static constexpr uint64_t NUMBER_OF_SLOTS{flatHashIndexNumberOfSlots(Capacity)};
+    static constexpr uint64_t SLOT_MASK{NUMBER_OF_SLOTS - 1U};
+
+    struct Slot
+    {
+        uint64_t hash{0U};
+        Position_t position{EMPTY};
+    };
+
+    static uint64_t homeSlot(const uint64_t hash) noexcept;
+
+  private:
+    UninitializedArray<Slot, NUMBER_OF_SLOTS> m_slots;
+    uint64_t m_size{0U};
+};
+
+} // namespace roudi
+} // namespace iox
+
+#include "iceoryx_posh/internal/roudi/introspection/flat_hash_index.inl"
+
+#endif // IOX_POSH_ROUDI_INTROSPECTION_FLAT_HASH_INDEX_HPP
@@ -0,0 +1,140 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_INTROSPECTION_FLAT_HASH_INDEX_INL
+#define IOX_POSH_ROUDI_INTROSPECTION_FLAT_HASH_INDEX_INL
+
+#include "iceoryx_posh/internal/roudi/introspection/flat_hash_index.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+template <uint64_t Capacity>
+inline FlatHashIndex<Capacity>::FlatHashIndex() noexcept
+{
+    for (uint64_t i = 0U; i < NUMBER_OF_SLOTS; ++i)
+    {
+        m_slots[i] = Slot();
+    }
+}
+
+template <uint64_t Capacity>
+inline uint64_t FlatHashIndex<Capacity>::homeSlot(const uint64_t hash) noexcept
+{
+    // the multiplication with the golden ratio spreads hash values which differ only in the upper bits, like the
+    // unique port ids of different RouDi instances, over the whole table
+    constexpr uint64_t GOLDEN_RATIO{0x9E3779B97F4A7C15U};
+    constexpr uint64_t HALF_WIDTH{32U};
+    const uint64_t mixed = hash * GOLDEN_RATIO;
+    return (mixed ^ (mixed >> HALF_WIDTH)) & SLOT_MASK;
+}
+
+template <uint64_t Capacity>
+inline bool FlatHashIndex<Capacity>::insert(const uint64_t hash, const uint64_t position) noexcept
+{
+    if (m_size >= Capacity || position >= EMPTY)
+    {
+        return false;
+    }
+
+    auto slot = homeSlot(hash);
+    while (m_slots[slot].position != EMPTY)
+    {
+        slot = (slot + 1U) & SLOT_MASK;
+    }
+
+    m_slots[slot].hash = hash;
+    m_slots[slot].position = static_cast<Position_t>(position);
+    ++m_size;
+    return true;
+}
+
+template <uint64_t Capacity>
+inline bool FlatHashIndex<Capacity>::erase(const uint64_t hash, const uint64_t position) noexcept
+{
+    auto slot = homeSlot(hash);
+    while (m_slots[slot].position != EMPTY
+           && (m_slots[slot].hash != hash || m_slots[slot].position != static_cast<Position_t>(position)))
+    {
+        slot = (slot + 1U) & SLOT_MASK;
+    }
+
+    if (m_slots[slot].position == EMPTY)
+    {
+        return false;
+    }
+
+    // the following entries of the probe sequence are moved into the gap, unless their home slot lies after the gap;
+    // this keeps every entry reachable from its home slot without leaving tombstones behind
+    auto gap = slot;
+    auto next = (gap + 1U) & SLOT_MASK;
+    while (m_slots[next].position != EMPTY)
+    {
+        const auto home = homeSlot(m_slots[next].hash);
+        const bool isHomeBetweenGapAndNext =
+            (gap <= next) ? (gap < home && home <= next) : (gap < home || home <= next);
+        if (!isHomeBetweenGapAndNext)
+        {
+            m_slots[gap] = m_slots[next];
+            gap = next;
+        }
+        next = (next + 1U) & SLOT_MASK;
+    }
+
+    m_slots[gap] = Slot();
+    --m_size;
+    return true;
+}
+
+template <uint64_t Capacity>
+template <typename Predicate>
+inline optional<uint64_t> FlatHashIndex<Capacity>::findIf(const uint64_t hash,
+                                                          const Predicate& predicate) const noexcept
+{
+    for (auto slot = homeSlot(hash); m_slots[slot].position != EMPTY; slot = (slot + 1U) & SLOT_MASK)
+    {
+        if (m_slots[slot].hash == hash && predicate(static_cast<uint64_t>(m_slots[slot].position)))
+        {
+            return static_cast<uint64_t>(m_slots[slot].position);
+        }
+    }
+    return nullopt;
+}
+
+template <uint64_t Capacity>
+template <typename Callable>
+inline void FlatHashIndex<Capacity>::forEach(const uint64_t hash, const Callable& callable) const noexcept
+{
+    for (auto slot = homeSlot(hash); m_slots[slot].position != EMPTY; slot = (slot + 1U) & SLOT_MASK)
+    {
+        if (m_slots[slot].hash == hash)
+        {
+            callable(static_cast<uint64_t>(m_slots[slot].position));
+        }
+    }
+}
+
+template <uint64_t Capacity>
+inline uint64_t FlatHashIndex<Capacity>::size() const noexcept
+{
+    return m_size;
+}
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_INTROSPECTION_FLAT_HASH_INDEX_INL
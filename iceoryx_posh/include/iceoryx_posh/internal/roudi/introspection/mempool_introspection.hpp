@@ -18,6 +18,7 @@
 #define IOX_POSH_ROUDI_INTROSPECTION_MEMPOOL_INTROSPECTION_HPP
 
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/roudi/introspection/fingerprint.hpp"
 #include "iceoryx_posh/internal/roudi/port_manager.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iox/detail/periodic_task.hpp"
@@ -34,7 +35,7 @@ namespace roudi
 ///        It is recommended to use the MemPoolIntrospectionType alias which sets
 ///        the intended template parameters required for the actual introspection.
 ///        The class sends snapshots of the mempool usage to the introspection
-///        client if subscribed.
+///        client if subscribed and the usage changed since the last snapshot.
 template <typename MemoryManager, typename SegmentManager, typename PublisherPort>
 class MemPoolIntrospection
 {
@@ -85,10 +86,16 @@ class MemPoolIntrospection
     /// @brief copy data fro internal struct into interface struct
     void copyMemPoolInfo(const MemoryManager& memoryManager, MemPoolInfoContainer& dest) noexcept;
 
+    static uint64_t fingerprintOf(const MemPoolIntrospectionInfoContainer& sample) noexcept;
+
   private:
+    optional<uint64_t> m_lastFingerprint;
     units::Duration m_sendInterval{units::Duration::fromSeconds(1U)};
-    concurrent::detail::PeriodicTask<function<void()>> m_publishingTask{
-        concurrent::detail::PeriodicTaskManualStart, "MemPoolIntr", *this, &MemPoolIntrospection::send};
+    concurrent::detail::PeriodicTask<function<void()>> m_publishingTask{concurrent::detail::PeriodicTaskManualStart,
+                                                                        concurrent::TimerService::getInstance(),
+                                                                        "MemPoolIntr",
+                                                                        *this,
+                                                                        &MemPoolIntrospection::send};
 };
 
 /// @brief typedef for the templated mempool introspection class that is used by RouDi for the
@@ -143,8 +143,40 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
             IOX_REPORT(PoshError::MEPOO__INTROSPECTION_CONTAINER_FULL, iox::er::RUNTIME_ERROR);
         }
 
+        // the last snapshot is still in the history of the publisher when the usage did not change
+        const auto fingerprint = fingerprintOf(*sample);
+        if (m_lastFingerprint.has_value() && m_lastFingerprint.value() == fingerprint)
+        {
+            sample->~MemPoolIntrospectionInfoContainer();
+            m_publisherPort.releaseChunk(maybeChunkHeader.value());
+            return;
+        }
+
         m_publisherPort.sendChunk(maybeChunkHeader.value());
+        m_lastFingerprint.emplace(fingerprint);
+    }
+}
+
+template <typename MemoryManager, typename SegmentManager, typename PublisherPort>
+inline uint64_t MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::fingerprintOf(
+    const MemPoolIntrospectionInfoContainer& sample) noexcept
+{
+    // the group names belong to the segments, which do not change during the runtime of RouDi
+    Fingerprint fingerprint;
+    fingerprint.add(sample.size());
+    for (const auto& segment : sample)
+    {
+        fingerprint.add(static_cast<uint64_t>(segment.m_id)).add(segment.m_mempoolInfo.size());
+        for (const auto& mempool : segment.m_mempoolInfo)
+        {
+            fingerprint.add(static_cast<uint64_t>(mempool.m_usedChunks))
+                .add(static_cast<uint64_t>(mempool.m_minFreeChunks))
+                .add(static_cast<uint64_t>(mempool.m_numChunks))
+                .add(mempool.m_chunkSize)
+                .add(mempool.m_chunkPayloadSize);
+        }
     }
+    return fingerprint.value();
 }
 
 // copy data fro internal struct into interface struct
@@ -19,17 +19,19 @@
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
+#include "iceoryx_posh/internal/roudi/introspection/fingerprint.hpp"
+#include "iceoryx_posh/internal/roudi/introspection/flat_hash_index.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iox/assertions.hpp"
+#include "iox/attributes.hpp"
 #include "iox/detail/periodic_task.hpp"
 #include "iox/fixed_position_container.hpp"
 #include "iox/function.hpp"
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
 
-#include <map>
-
 namespace iox
 {
 namespace roudi
@@ -39,6 +41,10 @@ namespace roudi
 ///        the intended template parameter required for the actual introspection.
 ///        The class manages a thread that periodically updates a field with port
 ///        introspection data to which clients may subscribe.
+///        Topics are only sent when their data changed. Added and removed ports are
+///        sent as PortIntrospectionDeltaTopic; the full PortIntrospectionFieldTopic is
+///        sent after PORT_INTROSPECTION_DELTAS_PER_SNAPSHOT deltas, when the changes do
+///        not fit into a delta and once the ports stopped changing.
 template <typename PublisherPort, typename SubscriberPort>
 class PortIntrospection
 {
@@ -51,6 +57,7 @@ class PortIntrospection
     };
 
     using PortIntrospectionTopic = PortIntrospectionFieldTopic;
+    using PortIntrospectionDelta = PortIntrospectionDeltaTopic;
     using PortThroughputIntrospectionTopic = PortThroughputIntrospectionFieldTopic;
 
     class PortData
@@ -76,16 +83,22 @@ class PortIntrospection
                 : portData(&portData)
                 , process(portData.m_runtimeName)
                 , service(portData.m_serviceDescription)
+                , uniqueId(portData.m_uniqueId)
             {
             }
 
             typename PublisherPort::MemberType_t* portData{nullptr};
             RuntimeName_t process;
             capro::ServiceDescription service;
+            popo::UniquePortId uniqueId{popo::InvalidPortId};
 
-            /// map from indices to ConnectionContainer indices
-            std::map<int, ConnectionContainerIndexType> connectionMap;
             int index{-1};
+
+            /// number of sent chunks at the last throughput update
+            uint64_t lastSentChunks{0U};
+
+            /// true until the publisher was sent with a port topic or delta
+            bool isPendingInDelta{true};
         };
 
         struct SubscriberInfo
@@ -96,12 +109,17 @@ class PortIntrospection
                 : portData(&portData)
                 , process(portData.m_runtimeName)
                 , service(portData.m_serviceDescription)
+                , uniqueId(portData.m_uniqueId)
             {
             }
 
             typename SubscriberPort::MemberType_t* portData{nullptr};
             RuntimeName_t process;
             capro::ServiceDescription service;
+            popo::UniquePortId uniqueId{popo::InvalidPortId};
+
+            /// true until the subscriber was sent with a port topic or delta
+            bool isPendingInDelta{true};
         };
 
         struct ConnectionInfo
@@ -124,6 +142,10 @@ class PortIntrospection
             iox::optional<PublisherContainerIndexType> publisherInfoIndex;
             ConnectionState state{ConnectionState::DEFAULT};
 
+            /// number of received and lost chunks at the last throughput update
+            uint64_t lastReceivedChunks{0U};
+            uint64_t lastLostChunks{0U};
+
             bool isConnected() const noexcept
             {
                 return publisherInfoIndex.has_value() && state == ConnectionState::CONNECTED;
@@ -175,6 +197,14 @@ class PortIntrospection
         /// @param[out] topic data structure to be prepared for sending
         void prepareTopic(PortIntrospectionTopic& topic) noexcept;
 
+        /// @brief prepare the delta with the ports which were added and removed since the last port topic or delta
+        /// @param[out] topic data structure to be prepared for sending
+        /// @return false if the changes do not fit into the delta; the port topic has to be sent instead
+        bool prepareTopic(PortIntrospectionDelta& topic) noexcept;
+
+        /// @brief prepare the throughput topic from the statistics of all tracked ports; the rates are computed
+        ///        from the change of the statistics since the previous call
+        /// @param[out] topic data structure to be prepared for sending
         void prepareTopic(PortThroughputIntrospectionTopic& topic) noexcept;
 
         void prepareTopic(SubscriberPortChangingIntrospectionFieldTopic& topic) noexcept;
@@ -198,7 +228,7 @@ class PortIntrospection
                                                         capro::CaproMessageType messageType) noexcept;
 
         /// @brief indicates whether the logical object state has changed (i.e. the data is new)
-        /// @return returns true if the data is new(e.g. new connections were established), false otherwise
+        /// @return returns true if ports were added or removed since the last port topic or delta, false otherwise
         bool isNew() const noexcept;
 
         /// @brief sets the internal flag indicating new data
@@ -209,20 +239,51 @@ class PortIntrospection
         using PublisherContainer = FixedPositionContainer<PublisherInfo, MAX_PUBLISHERS>;
         using ConnectionContainer = FixedPositionContainer<ConnectionInfo, MAX_SUBSCRIBERS>;
 
-        /// @brief inner map maps from unique port IDs to indices in the PublisherContainer
-        std::map<capro::ServiceDescription, std::map<popo::UniquePortId, PublisherContainerIndexType>> m_publisherMap;
+        static uint64_t hashOf(const capro::ServiceDescription& service) noexcept;
+        static uint64_t hashOf(const popo::UniquePortId& uniqueId) noexcept;
+
+        static PublisherPortData toPublisherPortData(const PublisherInfo& publisherInfo) noexcept;
+        static SubscriberPortData toSubscriberPortData(const SubscriberInfo& subscriberInfo) noexcept;
+
+        /// @brief marks all ports as sent and starts a new generation; requires the internal mutex
+        uint64_t startNextGeneration() noexcept;
 
-        /// inner map maps from unique port IDs to indices in the ConnectionContainer
-        std::map<capro::ServiceDescription, std::map<popo::UniquePortId, ConnectionContainerIndexType>> m_connectionMap;
+        optional<PublisherContainerIndexType> findPublisher(const capro::ServiceDescription& service,
+                                                            const popo::UniquePortId& uniqueId) const noexcept;
+        optional<ConnectionContainerIndexType> findConnection(const capro::ServiceDescription& service,
+                                                              const popo::UniquePortId& uniqueId) const noexcept;
 
-        /// @note we avoid allocating the objects on the heap but can still use a map
-        /// to locate/remove them fast(er)
-        /// max number needs to be a compile time constant
+        /// @brief calls the callable with the iterator of each publisher with the provided service
+        template <typename Callable>
+        void forEachPublisherOf(const capro::ServiceDescription& service, const Callable& callable) noexcept;
+
+        /// @brief calls the callable with the iterator of each connection whose subscriber has the provided service
+        template <typename Callable>
+        void forEachConnectionOf(const capro::ServiceDescription& service, const Callable& callable) noexcept;
+
+      private:
+        /// @note the port infos are stored in place and the indices map unique port ids and services to their
+        /// positions in the containers; neither requires heap memory and the topics are prepared with a linear pass
+        /// over the containers
         PublisherContainer m_publisherContainer;
         ConnectionContainer m_connectionContainer;
 
+        FlatHashIndex<MAX_PUBLISHERS> m_publishersByUniqueId;
+        FlatHashIndex<MAX_PUBLISHERS> m_publishersByService;
+        FlatHashIndex<MAX_SUBSCRIBERS> m_connectionsByUniqueId;
+        FlatHashIndex<MAX_SUBSCRIBERS> m_connectionsByService;
+
+        /// @note the ids of ports which were removed after they were sent; a port which is added and removed between
+        /// two deltas is not part of any delta
+        vector<uint64_t, MAX_PORT_INTROSPECTION_DELTA_ENTRIES> m_removedPublisherPortIDs;
+        vector<uint64_t, MAX_PORT_INTROSPECTION_DELTA_ENTRIES> m_removedSubscriberPortIDs;
+        bool m_hasTooManyRemovedPorts{false};
+        uint64_t m_generation{0U};
+
         std::atomic<bool> m_newData;
         std::mutex m_mutex;
+
+        std::chrono::steady_clock::time_point m_lastThroughputUpdate;
     };
 
     // end of helper classes
@@ -275,10 +336,13 @@ class PortIntrospection
 
     /// @brief register publisher port used to send introspection
     /// @param[in] publisherPort publisher port to be registered
+    /// @param[in] publisherPortDelta publisher port for the PortIntrospectionDeltaTopic; its history capacity should
+    /// be PORT_INTROSPECTION_DELTAS_PER_SNAPSHOT to provide all deltas after the last port topic to new subscribers
     /// @return true if registration was successful, false otherwise
     bool registerPublisherPort(PublisherPort&& publisherPortGeneric,
                                PublisherPort&& publisherPortThroughput,
-                               PublisherPort&& publisherPortSubscriberPortsData) noexcept;
+                               PublisherPort&& publisherPortSubscriberPortsData,
+                               PublisherPort&& publisherPortDelta) noexcept;
 
     /// @brief set the time interval used to send new introspection data
     /// @param[in] interval duration between two send invocations
@@ -295,26 +359,45 @@ class PortIntrospection
     /// @brief sends the port data; this is used from the unittests
     void sendPortData() noexcept;
 
-    /// @brief sends the throughput data; this is used from the unittests
+    /// @brief sends the ports which were added and removed since the last port data or delta; this is used from the
+    /// unittests
+    /// @return false if the delta was not sent, e.g. since the changes do not fit into it
+    bool sendPortDelta() noexcept;
+
+    /// @brief sends the throughput data if it changed since it was sent the last time; this is used from the unittests
     void sendThroughputData() noexcept;
 
-    /// @brief sends the subscriberport changing data, this is used from the unittests
+    /// @brief sends the subscriberport changing data if it changed since it was sent the last time, this is used from
+    /// the unittests
     void sendSubscriberPortsData() noexcept;
 
-    /// @brief calls the three specific send functions from above, this is used from the periodic task
+    /// @brief calls the specific send functions from above for the changed data, this is used from the periodic task
     void send() noexcept;
 
   protected:
     optional<PublisherPort> m_publisherPort;
     optional<PublisherPort> m_publisherPortThroughput;
     optional<PublisherPort> m_publisherPortSubscriberPortsData;
+    optional<PublisherPort> m_publisherPortDelta;
+
+  private:
+    static uint64_t fingerprintOf(const PortThroughputIntrospectionTopic& topic) noexcept;
+    static uint64_t fingerprintOf(const SubscriberPortChangingIntrospectionFieldTopic& topic) noexcept;
 
   private:
     PortData m_portData;
 
+    /// @note only accessed by the publishing task
+    uint32_t m_deltasSinceLastPortData{0U};
+    optional<uint64_t> m_lastThroughputFingerprint;
+    optional<uint64_t> m_lastSubscriberPortsFingerprint;
+
     units::Duration m_sendInterval{units::Duration::fromSeconds(1U)};
-    concurrent::detail::PeriodicTask<function<void()>> m_publishingTask{
-        concurrent::detail::PeriodicTaskManualStart, "PortIntr", *this, &PortIntrospection::send};
+    concurrent::detail::PeriodicTask<function<void()>> m_publishingTask{concurrent::detail::PeriodicTaskManualStart,
+                                                                        concurrent::TimerService::getInstance(),
+                                                                        "PortIntr",
+                                                                        *this,
+                                                                        &PortIntrospection::send};
 };
 
 /// @brief typedef for the templated port introspection class that is used by RouDi for the
@@ -31,6 +31,7 @@ inline PortIntrospection<PublisherPort, SubscriberPort>::PortIntrospection() noe
 template <typename PublisherPort, typename SubscriberPort>
 inline PortIntrospection<PublisherPort, SubscriberPort>::PortData::PortData() noexcept
     : m_newData(true)
+    , m_lastThroughputUpdate(std::chrono::steady_clock::now())
 {
 }
 
@@ -57,9 +58,10 @@ template <typename PublisherPort, typename SubscriberPort>
 inline bool PortIntrospection<PublisherPort, SubscriberPort>::registerPublisherPort(
     PublisherPort&& publisherPortGeneric,
     PublisherPort&& publisherPortThroughput,
-    PublisherPort&& publisherPortSubscriberPortsData) noexcept
+    PublisherPort&& publisherPortSubscriberPortsData,
+    PublisherPort&& publisherPortDelta) noexcept
 {
-    if (m_publisherPort || m_publisherPortThroughput || m_publisherPortSubscriberPortsData)
+    if (m_publisherPort || m_publisherPortThroughput || m_publisherPortSubscriberPortsData || m_publisherPortDelta)
     {
         return false;
     }
@@ -67,6 +69,7 @@ inline bool PortIntrospection<PublisherPort, SubscriberPort>::registerPublisherP
     m_publisherPort.emplace(std::move(publisherPortGeneric));
     m_publisherPortThroughput.emplace(std::move(publisherPortThroughput));
     m_publisherPortSubscriberPortsData.emplace(std::move(publisherPortSubscriberPortsData));
+    m_publisherPortDelta.emplace(std::move(publisherPortDelta));
 
     return true;
 }
@@ -77,6 +80,7 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::run() noexcept
     IOX_ENFORCE(m_publisherPort.has_value(), "Port must be initialized");
     IOX_ENFORCE(m_publisherPortThroughput.has_value(), "Port must be initialized");
     IOX_ENFORCE(m_publisherPortSubscriberPortsData.has_value(), "Port must be initialized");
+    IOX_ENFORCE(m_publisherPortDelta.has_value(), "Port must be initialized");
 
     // this is a field, there needs to be a sample before activate is called
     sendPortData();
@@ -85,6 +89,7 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::run() noexcept
     m_publisherPort->offer();
     m_publisherPortThroughput->offer();
     m_publisherPortSubscriberPortsData->offer();
+    m_publisherPortDelta->offer();
 
     m_publishingTask.start(m_sendInterval);
 }
@@ -94,6 +99,14 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::send() noexcept
 {
     if (m_portData.isNew())
     {
+        if (m_deltasSinceLastPortData >= PORT_INTROSPECTION_DELTAS_PER_SNAPSHOT || !sendPortDelta())
+        {
+            sendPortData();
+        }
+    }
+    else if (m_deltasSinceLastPortData > 0U)
+    {
+        // subscribers of the port data only are up to date again one interval after the last change
         sendPortData();
     }
     sendThroughputData();
@@ -115,7 +128,35 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::sendPortData() noe
         m_portData.prepareTopic(*sample); // requires internal mutex (blocks
                                           // further introspection events)
         m_publisherPort->sendChunk(maybeChunkHeader.value());
+        m_deltasSinceLastPortData = 0U;
+    }
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline bool PortIntrospection<PublisherPort, SubscriberPort>::sendPortDelta() noexcept
+{
+    auto maybeChunkHeader = m_publisherPortDelta->tryAllocateChunk(sizeof(PortIntrospectionDeltaTopic),
+                                                                   alignof(PortIntrospectionDeltaTopic),
+                                                                   CHUNK_NO_USER_HEADER_SIZE,
+                                                                   CHUNK_NO_USER_HEADER_ALIGNMENT);
+    if (maybeChunkHeader.has_error())
+    {
+        return false;
+    }
+
+    auto delta = static_cast<PortIntrospectionDeltaTopic*>(maybeChunkHeader.value()->userPayload());
+    new (delta) PortIntrospectionDeltaTopic();
+
+    if (!m_portData.prepareTopic(*delta))
+    {
+        delta->~PortIntrospectionDeltaTopic();
+        m_publisherPortDelta->releaseChunk(maybeChunkHeader.value());
+        return false;
     }
+
+    m_publisherPortDelta->sendChunk(maybeChunkHeader.value());
+    ++m_deltasSinceLastPortData;
+    return true;
 }
 
 template <typename PublisherPort, typename SubscriberPort>
@@ -133,7 +174,17 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::sendThroughputData
 
         m_portData.prepareTopic(*throughputSample); // requires internal mutex (blocks
         // further introspection events)
+
+        const auto fingerprint = fingerprintOf(*throughputSample);
+        if (m_lastThroughputFingerprint.has_value() && m_lastThroughputFingerprint.value() == fingerprint)
+        {
+            throughputSample->~PortThroughputIntrospectionFieldTopic();
+            m_publisherPortThroughput->releaseChunk(maybeChunkHeader.value());
+            return;
+        }
+
         m_publisherPortThroughput->sendChunk(maybeChunkHeader.value());
+        m_lastThroughputFingerprint.emplace(fingerprint);
     }
 }
 
@@ -153,8 +204,71 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::sendSubscriberPort
 
         m_portData.prepareTopic(*subscriberPortChangingDataSample); // requires internal mutex (blocks
         // further introspection events)
+
+        const auto fingerprint = fingerprintOf(*subscriberPortChangingDataSample);
+        if (m_lastSubscriberPortsFingerprint.has_value() && m_lastSubscriberPortsFingerprint.value() == fingerprint)
+        {
+            subscriberPortChangingDataSample->~SubscriberPortChangingIntrospectionFieldTopic();
+            m_publisherPortSubscriberPortsData->releaseChunk(maybeChunkHeader.value());
+            return;
+        }
+
         m_publisherPortSubscriberPortsData->sendChunk(maybeChunkHeader.value());
+        m_lastSubscriberPortsFingerprint.emplace(fingerprint);
+    }
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline uint64_t
+PortIntrospection<PublisherPort, SubscriberPort>::fingerprintOf(const PortThroughputIntrospectionTopic& topic) noexcept
+{
+    // the rates are zero when the counters did not change, therefore an idle port does not change the fingerprint
+    Fingerprint fingerprint;
+    fingerprint.add(topic.m_throughputList.size());
+    for (const auto& throughput : topic.m_throughputList)
+    {
+        fingerprint.add(throughput.m_publisherPortID)
+            .add(throughput.m_sampleSize)
+            .add(throughput.m_chunkSize)
+            .add(throughput.m_chunksPerMinute)
+            .add(throughput.m_lastSendIntervalInNanoseconds)
+            .add(static_cast<uint64_t>(throughput.m_isField))
+            .add(throughput.m_sentChunks)
+            .add(throughput.m_deliveredChunks)
+            .add(throughput.m_droppedChunks)
+            .add(throughput.m_loanFailures)
+            .add(throughput.m_blockedTimeInNanoseconds);
+    }
+    fingerprint.add(topic.m_subscriberThroughputList.size());
+    for (const auto& throughput : topic.m_subscriberThroughputList)
+    {
+        fingerprint.add(throughput.m_subscriberPortID)
+            .add(throughput.m_publisherPortID)
+            .add(throughput.m_receivedChunks)
+            .add(throughput.m_lostChunks)
+            .add(throughput.m_receivedChunksPerMinute)
+            .add(throughput.m_lostChunksPerMinute)
+            .add(throughput.m_queueSize)
+            .add(throughput.m_queueCapacity);
+    }
+    return fingerprint.value();
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline uint64_t PortIntrospection<PublisherPort, SubscriberPort>::fingerprintOf(
+    const SubscriberPortChangingIntrospectionFieldTopic& topic) noexcept
+{
+    Fingerprint fingerprint;
+    fingerprint.add(topic.subscriberPortChangingDataList.size());
+    for (const auto& subscriberData : topic.subscriberPortChangingDataList)
+    {
+        fingerprint.add(subscriberData.subscriberPortID)
+            .add(subscriberData.fifoSize)
+            .add(subscriberData.fifoCapacity)
+            .add(static_cast<uint64_t>(subscriberData.subscriptionState))
+            .add(static_cast<uint64_t>(subscriberData.propagationScope));
     }
+    return fingerprint.value();
 }
 
 template <typename PublisherPort, typename SubscriberPort>
@@ -174,6 +288,99 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::stop() noexcept
     m_publishingTask.stop();
 }
 
+template <typename PublisherPort, typename SubscriberPort>
+inline uint64_t
+PortIntrospection<PublisherPort, SubscriberPort>::PortData::hashOf(const capro::ServiceDescription& service) noexcept
+{
+    // FNV-1a over the three strings of the service description; the string sizes separate the strings
+    constexpr uint64_t FNV_OFFSET_BASIS{14695981039346656037U};
+    constexpr uint64_t FNV_PRIME{1099511628211U};
+    uint64_t hash{FNV_OFFSET_BASIS};
+    auto hashString = [&](const capro::IdString_t& string) {
+        const auto* characters = string.c_str();
+        for (uint64_t i = 0U; i < string.size(); ++i)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) bounded by the string size
+            hash ^= static_cast<uint8_t>(characters[i]);
+            hash *= FNV_PRIME;
+        }
+        hash ^= string.size();
+        hash *= FNV_PRIME;
+    };
+    hashString(service.getServiceIDString());
+    hashString(service.getInstanceIDString());
+    hashString(service.getEventIDString());
+    return hash;
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline uint64_t
+PortIntrospection<PublisherPort, SubscriberPort>::PortData::hashOf(const popo::UniquePortId& uniqueId) noexcept
+{
+    // the unique port ids are already distinct; the FlatHashIndex spreads them over its slots
+    return static_cast<uint64_t>(uniqueId);
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline optional<typename PortIntrospection<PublisherPort, SubscriberPort>::PortData::PublisherContainerIndexType>
+PortIntrospection<PublisherPort, SubscriberPort>::PortData::findPublisher(
+    const capro::ServiceDescription& service, const popo::UniquePortId& uniqueId) const noexcept
+{
+    auto position = m_publishersByUniqueId.findIf(hashOf(uniqueId), [&](const uint64_t position) {
+        auto publisherInfo = m_publisherContainer.iter_from_index(static_cast<PublisherContainerIndexType>(position));
+        return publisherInfo->uniqueId == uniqueId && publisherInfo->service == service;
+    });
+    if (!position.has_value())
+    {
+        return nullopt;
+    }
+    return static_cast<PublisherContainerIndexType>(position.value());
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline optional<typename PortIntrospection<PublisherPort, SubscriberPort>::PortData::ConnectionContainerIndexType>
+PortIntrospection<PublisherPort, SubscriberPort>::PortData::findConnection(
+    const capro::ServiceDescription& service, const popo::UniquePortId& uniqueId) const noexcept
+{
+    auto position = m_connectionsByUniqueId.findIf(hashOf(uniqueId), [&](const uint64_t position) {
+        auto connection = m_connectionContainer.iter_from_index(static_cast<ConnectionContainerIndexType>(position));
+        return connection->subscriberInfo.uniqueId == uniqueId && connection->subscriberInfo.service == service;
+    });
+    if (!position.has_value())
+    {
+        return nullopt;
+    }
+    return static_cast<ConnectionContainerIndexType>(position.value());
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+template <typename Callable>
+inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::forEachPublisherOf(
+    const capro::ServiceDescription& service, const Callable& callable) noexcept
+{
+    m_publishersByService.forEach(hashOf(service), [&](const uint64_t position) {
+        auto publisherInfo = m_publisherContainer.iter_from_index(static_cast<PublisherContainerIndexType>(position));
+        if (publisherInfo->service == service)
+        {
+            callable(publisherInfo);
+        }
+    });
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+template <typename Callable>
+inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::forEachConnectionOf(
+    const capro::ServiceDescription& service, const Callable& callable) noexcept
+{
+    m_connectionsByService.forEach(hashOf(service), [&](const uint64_t position) {
+        auto connection = m_connectionContainer.iter_from_index(static_cast<ConnectionContainerIndexType>(position));
+        if (connection->subscriberInfo.service == service)
+        {
+            callable(connection);
+        }
+    });
+}
+
 template <typename PublisherPort, typename SubscriberPort>
 inline bool PortIntrospection<PublisherPort, SubscriberPort>::PortData::updateConnectionState(
     const capro::CaproMessage& message) noexcept
@@ -183,21 +390,18 @@ inline bool PortIntrospection<PublisherPort, SubscriberPort>::PortData::updateCo
 
     std::lock_guard<std::mutex> lock(m_mutex);
 
-    auto iter = m_connectionMap.find(service);
-    if (iter == m_connectionMap.end())
-    {
-        return false; // no corresponding capro Id ...
-    }
-
-    auto& innerConnectionMap = iter->second;
+    bool hasConnections{false};
+    forEachConnectionOf(service, [&](auto connection) {
+        connection->state = getNextState<iox::build::CommunicationPolicy>(connection->state, messageType);
+        hasConnections = true;
+    });
 
-    for (auto& pair : innerConnectionMap)
+    if (!hasConnections)
     {
-        auto connection = m_connectionContainer.iter_from_index(pair.second);
-        connection->state = getNextState<iox::build::CommunicationPolicy>(connection->state, messageType);
+        return false; // no corresponding capro Id ...
     }
 
-    setNew(true);
+    // the connection state is not part of the port topic, therefore it does not have to be sent again
     return true;
 }
 
@@ -210,24 +414,15 @@ inline bool PortIntrospection<PublisherPort, SubscriberPort>::PortData::updateSu
 
     std::lock_guard<std::mutex> lock(m_mutex);
 
-    auto iter = m_connectionMap.find(service);
-    if (iter == m_connectionMap.end())
+    auto connectionIndex = findConnection(service, id);
+    if (!connectionIndex.has_value())
     {
-        return false; // no corresponding capro Id ...
+        return false; // no corresponding capro Id or unique port id ...
     }
 
-    auto& innerConnectionMap = iter->second;
-
-    auto iterInnerMap = innerConnectionMap.find(id);
-    if (iterInnerMap == innerConnectionMap.end())
-    {
-        return false;
-    }
-
-    auto connection = m_connectionContainer.iter_from_index(iterInnerMap->second);
+    auto connection = m_connectionContainer.iter_from_index(connectionIndex.value());
     connection->state = getNextState<iox::build::CommunicationPolicy>(connection->state, messageType);
 
-    setNew(true);
     return true;
 }
 
@@ -237,54 +432,27 @@ inline bool PortIntrospection<PublisherPort, SubscriberPort>::PortData::addPubli
 {
     std::lock_guard<std::mutex> lock(m_mutex);
 
-    auto service = port.m_serviceDescription;
-    auto uniqueId = port.m_uniqueId;
+    const auto& service = port.m_serviceDescription;
+    const auto& uniqueId = port.m_uniqueId;
 
-    auto publisherInfo = m_publisherContainer.emplace(PublisherInfo(port));
-    if (publisherInfo == m_publisherContainer.end())
+    if (findPublisher(service, uniqueId).has_value())
     {
         return false;
     }
 
-    auto iter = m_publisherMap.find(service);
-    if (iter == m_publisherMap.end())
-    {
-        // service is new, create new map
-        std::map<popo::UniquePortId, PublisherContainerIndexType> innerPublisherMap;
-        innerPublisherMap.insert(std::make_pair(uniqueId, publisherInfo.to_index()));
-        m_publisherMap.insert(std::make_pair(service, innerPublisherMap));
-    }
-    else
+    auto publisherInfo = m_publisherContainer.emplace(PublisherInfo(port));
+    if (publisherInfo == m_publisherContainer.end())
     {
-        // service exists, add new entry
-        auto& innerPublisherMap = iter->second;
-        auto iter = innerPublisherMap.find(uniqueId);
-        if (iter == innerPublisherMap.end())
-        {
-            innerPublisherMap.insert(std::make_pair(uniqueId, publisherInfo.to_index()));
-        }
-        else
-        {
-            return false;
-        }
+        return false;
     }
 
-    // connect publisher to all subscribers with the same Id
+    // the indices have the capacity of the container, therefore the insertion cannot fail
+    const auto publisherIndex = publisherInfo.to_index();
+    IOX_DISCARD_RESULT(m_publishersByUniqueId.insert(hashOf(uniqueId), publisherIndex));
+    IOX_DISCARD_RESULT(m_publishersByService.insert(hashOf(service), publisherIndex));
 
-    // find corresponding subscribers
-    auto connIter = m_connectionMap.find(service);
-    if (connIter != m_connectionMap.end())
-    {
-        auto& innerConnectionMap = connIter->second;
-        for (auto& pair : innerConnectionMap)
-        {
-            auto connection = m_connectionContainer.iter_from_index(pair.second);
-            if (service == connection->subscriberInfo.service)
-            {
-                connection->publisherInfoIndex = publisherInfo.to_index();
-            }
-        }
-    }
+    // connect publisher to all subscribers with the same Id
+    forEachConnectionOf(service, [&](auto connection) { connection->publisherInfoIndex = publisherIndex; });
 
     setNew(true);
     return true;
@@ -296,58 +464,29 @@ inline bool PortIntrospection<PublisherPort, SubscriberPort>::PortData::addSubsc
 {
     std::lock_guard<std::mutex> lock(m_mutex);
 
-    auto service = portData.m_serviceDescription;
-    auto uniqueId = portData.m_uniqueId;
+    const auto& service = portData.m_serviceDescription;
+    const auto& uniqueId = portData.m_uniqueId;
 
-    auto connection = m_connectionContainer.emplace(ConnectionInfo(portData));
-    if (connection == m_connectionContainer.end())
+    if (findConnection(service, uniqueId).has_value())
     {
         return false;
     }
 
-    auto iter = m_connectionMap.find(service);
-
-    if (iter == m_connectionMap.end())
-    {
-        // service is new, create new map
-        std::map<popo::UniquePortId, ConnectionContainerIndexType> innerConnectionMap;
-        innerConnectionMap.insert(std::make_pair(uniqueId, connection.to_index()));
-        m_connectionMap.insert(std::make_pair(service, innerConnectionMap));
-    }
-    else
+    auto connection = m_connectionContainer.emplace(ConnectionInfo(portData));
+    if (connection == m_connectionContainer.end())
     {
-        // service exists, add new entry
-        auto& innerConnectionMap = iter->second;
-        auto iter = innerConnectionMap.find(uniqueId);
-        if (iter == innerConnectionMap.end())
-        {
-            innerConnectionMap.insert(std::make_pair(uniqueId, connection.to_index()));
-        }
-        else
-        {
-            return false;
-        }
+        return false;
     }
 
-    auto sendIter = m_publisherMap.find(service);
-    if (sendIter != m_publisherMap.end())
-    {
-        auto& innerPublisherMap = sendIter->second;
-        for (auto& iter : innerPublisherMap)
-        {
-            auto publisherInfo = m_publisherContainer.iter_from_index(iter.second);
-            // set corresponding publisher info if exists
-            if (publisherInfo != m_publisherContainer.end())
-            {
-                connection->publisherInfoIndex = publisherInfo.to_index();
-            }
-            else
-            {
-                connection->publisherInfoIndex.reset();
-            }
-        }
-    }
+    // the indices have the capacity of the container, therefore the insertion cannot fail
+    const auto connectionIndex = connection.to_index();
+    IOX_DISCARD_RESULT(m_connectionsByUniqueId.insert(hashOf(uniqueId), connectionIndex));
+    IOX_DISCARD_RESULT(m_connectionsByService.insert(hashOf(service), connectionIndex));
+
+    // set corresponding publisher info if exists
+    forEachPublisherOf(service, [&](auto publisherInfo) { connection->publisherInfoIndex = publisherInfo.to_index(); });
 
+    setNew(true);
     return true;
 }
 
@@ -357,33 +496,32 @@ PortIntrospection<PublisherPort, SubscriberPort>::PortData::removePublisher(cons
 {
     std::lock_guard<std::mutex> lock(m_mutex);
 
-    auto iter = m_publisherMap.find(port.getCaProServiceDescription());
-    if (iter == m_publisherMap.end())
-    {
-        return false;
-    }
-
-    auto& innerPublisherMap = iter->second;
-    auto iterInnerMap = innerPublisherMap.find(port.getUniqueID());
-    if (iterInnerMap == innerPublisherMap.end())
+    const auto service = port.getCaProServiceDescription();
+    auto publisherIndex = findPublisher(service, port.getUniqueID());
+    if (!publisherIndex.has_value())
     {
         return false;
     }
-    auto m_publisherIndex = iterInnerMap->second;
-    auto publisher = m_publisherContainer.iter_from_index(m_publisherIndex);
+    auto publisher = m_publisherContainer.iter_from_index(publisherIndex.value());
 
     // disconnect publisher from all its subscribers
-    for (auto& pair : publisher->connectionMap)
-    {
-        auto connIter = m_connectionContainer.iter_from_index(pair.second);
-        if (connIter != m_connectionContainer.end())
+    forEachConnectionOf(service, [&](auto connection) {
+        if (connection->publisherInfoIndex.has_value()
+            && connection->publisherInfoIndex.value() == publisherIndex.value())
         {
-            connIter->publisherInfoIndex.reset();       // publisher is disconnected
-            connIter->state = ConnectionState::DEFAULT; // connection state is now default
+            connection->publisherInfoIndex.reset();       // publisher is disconnected
+            connection->state = ConnectionState::DEFAULT; // connection state is now default
         }
+    });
+
+    if (!publisher->isPendingInDelta
+        && !m_removedPublisherPortIDs.push_back(static_cast<uint64_t>(publisher->uniqueId)))
+    {
+        m_hasTooManyRemovedPorts = true;
     }
 
-    innerPublisherMap.erase(iterInnerMap);
+    IOX_DISCARD_RESULT(m_publishersByUniqueId.erase(hashOf(publisher->uniqueId), publisherIndex.value()));
+    IOX_DISCARD_RESULT(m_publishersByService.erase(hashOf(service), publisherIndex.value()));
     m_publisherContainer.erase(publisher);
     setNew(true); // indicates we have to send new data because
                   // something changed
@@ -397,39 +535,24 @@ PortIntrospection<PublisherPort, SubscriberPort>::PortData::removeSubscriber(con
 {
     std::lock_guard<std::mutex> lock(m_mutex);
 
-    auto iter = m_connectionMap.find(port.getCaProServiceDescription());
-    if (iter == m_connectionMap.end())
-    {
-        return false; // not found and therefore not removed
-    }
-
-    auto& innerConnectionMap = iter->second;
-    auto mapIter = innerConnectionMap.find(port.getUniqueID());
-
-    if (mapIter == innerConnectionMap.end())
+    const auto service = port.getCaProServiceDescription();
+    auto connectionIndex = findConnection(service, port.getUniqueID());
+    if (!connectionIndex.has_value())
     {
         return false; // not found and therefore not removed
     }
+    auto connection = m_connectionContainer.iter_from_index(connectionIndex.value());
 
-    // remove subscriber in corresponding publisher
-    auto connectionIndex = mapIter->second;
-    auto connection = m_connectionContainer.iter_from_index(connectionIndex);
-    auto publisherInfoIndex = connection->publisherInfoIndex;
-
-    if (publisherInfoIndex.has_value())
+    const auto& subscriberInfo = connection->subscriberInfo;
+    if (!subscriberInfo.isPendingInDelta
+        && !m_removedSubscriberPortIDs.push_back(static_cast<uint64_t>(subscriberInfo.uniqueId)))
     {
-        auto publisherInfo = m_publisherContainer.iter_from_index(publisherInfoIndex.value());
-        if (publisherInfo != m_publisherContainer.end())
-        {
-            auto connIter = publisherInfo->connectionMap.find(connectionIndex);
-            if (connIter != publisherInfo->connectionMap.end())
-            {
-                publisherInfo->connectionMap.erase(connIter);
-            }
-        }
+        m_hasTooManyRemovedPorts = true;
     }
 
-    innerConnectionMap.erase(mapIter);
+    IOX_DISCARD_RESULT(
+        m_connectionsByUniqueId.erase(hashOf(connection->subscriberInfo.uniqueId), connectionIndex.value()));
+    IOX_DISCARD_RESULT(m_connectionsByService.erase(hashOf(service), connectionIndex.value()));
     m_connectionContainer.erase(connection);
 
     setNew(true);
@@ -529,6 +652,55 @@ PortIntrospection<PublisherPort, SubscriberPort>::PortData::getNextState(Connect
     return nextState;
 }
 
+template <typename PublisherPort, typename SubscriberPort>
+inline PublisherPortData PortIntrospection<PublisherPort, SubscriberPort>::PortData::toPublisherPortData(
+    const PublisherInfo& publisherInfo) noexcept
+{
+    PublisherPortData publisherData;
+    publisherData.m_publisherPortID = static_cast<uint64_t>(publisherInfo.uniqueId);
+    publisherData.m_sourceInterface = publisherInfo.service.getSourceInterface();
+    publisherData.m_name = publisherInfo.process;
+
+    publisherData.m_caproInstanceID = publisherInfo.service.getInstanceIDString();
+    publisherData.m_caproServiceID = publisherInfo.service.getServiceIDString();
+    publisherData.m_caproEventMethodID = publisherInfo.service.getEventIDString();
+    return publisherData;
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline SubscriberPortData PortIntrospection<PublisherPort, SubscriberPort>::PortData::toSubscriberPortData(
+    const SubscriberInfo& subscriberInfo) noexcept
+{
+    SubscriberPortData subscriberData;
+    subscriberData.m_subscriberPortID = static_cast<uint64_t>(subscriberInfo.uniqueId);
+    subscriberData.m_name = subscriberInfo.process;
+
+    subscriberData.m_caproInstanceID = subscriberInfo.service.getInstanceIDString();
+    subscriberData.m_caproServiceID = subscriberInfo.service.getServiceIDString();
+    subscriberData.m_caproEventMethodID = subscriberInfo.service.getEventIDString();
+    return subscriberData;
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline uint64_t PortIntrospection<PublisherPort, SubscriberPort>::PortData::startNextGeneration() noexcept
+{
+    for (auto& publisherInfo : m_publisherContainer)
+    {
+        publisherInfo.isPendingInDelta = false;
+    }
+    for (auto& connection : m_connectionContainer)
+    {
+        connection.subscriberInfo.isPendingInDelta = false;
+    }
+    m_removedPublisherPortIDs.clear();
+    m_removedSubscriberPortIDs.clear();
+    m_hasTooManyRemovedPorts = false;
+
+    // needs to be done while holding the lock
+    setNew(false);
+    return ++m_generation;
+}
+
 template <typename PublisherPort, typename SubscriberPort>
 inline void
 PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(PortIntrospectionTopic& topic) noexcept
@@ -538,63 +710,142 @@ PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(PortInt
     std::lock_guard<std::mutex> lock(m_mutex); // we need to lock the internal data structs
 
     int32_t index{0};
-    for (auto& pub : m_publisherMap)
+    for (auto& publisherInfo : m_publisherContainer)
     {
-        auto& innerPublisherMap = pub.second;
-        for (auto& pair : innerPublisherMap)
-        {
-            auto m_publisherIndex = pair.second;
-            if (m_publisherIndex >= 0)
-            {
-                auto publisherInfo = m_publisherContainer.iter_from_index(m_publisherIndex);
-                PublisherPortData publisherData;
-                PublisherPort port(publisherInfo->portData);
-                publisherData.m_publisherPortID = static_cast<uint64_t>(port.getUniqueID());
-                publisherData.m_sourceInterface = publisherInfo->service.getSourceInterface();
-                publisherData.m_name = publisherInfo->process;
+        m_publisherList.emplace_back(toPublisherPortData(publisherInfo));
+        publisherInfo.index = index++;
+    }
 
-                publisherData.m_caproInstanceID = publisherInfo->service.getInstanceIDString();
-                publisherData.m_caproServiceID = publisherInfo->service.getServiceIDString();
-                publisherData.m_caproEventMethodID = publisherInfo->service.getEventIDString();
+    auto& m_subscriberList = topic.m_subscriberList;
+    for (const auto& connection : m_connectionContainer)
+    {
+        m_subscriberList.emplace_back(toSubscriberPortData(connection.subscriberInfo));
+    }
 
-                m_publisherList.emplace_back(publisherData);
-                publisherInfo->index = index++;
-            }
-        }
+    // an unchanged topic keeps its generation, therefore the deltas of the generation can still be applied to it
+    topic.m_generation = isNew() ? startNextGeneration() : m_generation;
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline bool
+PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(PortIntrospectionDelta& topic) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_hasTooManyRemovedPorts)
+    {
+        return false;
     }
 
-    auto& m_subscriberList = topic.m_subscriberList;
-    for (auto& connPair : m_connectionMap)
+    for (const auto& publisherInfo : m_publisherContainer)
     {
-        for (auto& pair : connPair.second)
+        if (publisherInfo.isPendingInDelta && !topic.m_addedPublishers.push_back(toPublisherPortData(publisherInfo)))
         {
-            auto connectionIndex = pair.second;
-            if (connectionIndex >= 0)
-            {
-                auto connection = m_connectionContainer.iter_from_index(connectionIndex);
-                SubscriberPortData subscriberData;
-                auto& subscriberInfo = connection->subscriberInfo;
-
-                subscriberData.m_name = subscriberInfo.process;
+            return false;
+        }
+    }
 
-                subscriberData.m_caproInstanceID = subscriberInfo.service.getInstanceIDString();
-                subscriberData.m_caproServiceID = subscriberInfo.service.getServiceIDString();
-                subscriberData.m_caproEventMethodID = subscriberInfo.service.getEventIDString();
-                m_subscriberList.emplace_back(subscriberData);
-            }
+    for (const auto& connection : m_connectionContainer)
+    {
+        if (connection.subscriberInfo.isPendingInDelta
+            && !topic.m_addedSubscribers.push_back(toSubscriberPortData(connection.subscriberInfo)))
+        {
+            return false;
         }
     }
 
-    // needs to be done while holding the lock
-    setNew(false);
+    topic.m_removedPublisherPortIDs = m_removedPublisherPortIDs;
+    topic.m_removedSubscriberPortIDs = m_removedSubscriberPortIDs;
+
+    topic.m_baseGeneration = m_generation;
+    topic.m_generation = startNextGeneration();
+    return true;
 }
 
 template <typename PublisherPort, typename SubscriberPort>
-inline void
-PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(PortThroughputIntrospectionTopic& topic
-                                                                         [[maybe_unused]]) noexcept
+inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(
+    PortThroughputIntrospectionTopic& topic) noexcept
 {
-    /// @todo iox-#402 re-add port throughput
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto now = std::chrono::steady_clock::now();
+    const auto intervalInNanoseconds = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_lastThroughputUpdate).count());
+    m_lastThroughputUpdate = now;
+
+    constexpr double NANOSECONDS_PER_MINUTE{60.0 * 1000.0 * 1000.0 * 1000.0};
+    auto perMinute = [&](const uint64_t numberOfChunks) -> double {
+        return (intervalInNanoseconds == 0U)
+                   ? 0.0
+                   : static_cast<double>(numberOfChunks) * NANOSECONDS_PER_MINUTE
+                         / static_cast<double>(intervalInNanoseconds);
+    };
+
+    for (auto& publisherInfo : m_publisherContainer)
+    {
+        if (publisherInfo.portData == nullptr)
+        {
+            continue;
+        }
+
+        const auto& chunkSenderData = publisherInfo.portData->m_chunkSenderData;
+        const auto& statistics = chunkSenderData.m_statistics;
+        PublisherPort port(publisherInfo.portData);
+
+        PortThroughputData throughputData;
+        throughputData.m_publisherPortID = static_cast<uint64_t>(port.getUniqueID());
+        throughputData.m_sampleSize = statistics.m_lastUserPayloadSize.load(std::memory_order_relaxed);
+        throughputData.m_chunkSize = statistics.m_lastChunkSize.load(std::memory_order_relaxed);
+        throughputData.m_isField = chunkSenderData.m_historyCapacity > 0U;
+        throughputData.m_sentChunks = statistics.m_sentChunks.load(std::memory_order_relaxed);
+        throughputData.m_deliveredChunks = statistics.m_deliveredChunks.load(std::memory_order_relaxed);
+        throughputData.m_droppedChunks = statistics.m_droppedChunks.load(std::memory_order_relaxed);
+        throughputData.m_loanFailures = statistics.m_loanFailures.load(std::memory_order_relaxed);
+        throughputData.m_blockedTimeInNanoseconds =
+            statistics.m_blockedTimeInNanoseconds.load(std::memory_order_relaxed);
+
+        const auto sentChunksInInterval = throughputData.m_sentChunks - publisherInfo.lastSentChunks;
+        publisherInfo.lastSentChunks = throughputData.m_sentChunks;
+        throughputData.m_chunksPerMinute = perMinute(sentChunksInInterval);
+        throughputData.m_lastSendIntervalInNanoseconds =
+            (sentChunksInInterval == 0U) ? 0U : intervalInNanoseconds / sentChunksInInterval;
+
+        topic.m_throughputList.emplace_back(throughputData);
+    }
+
+    for (auto& connection : m_connectionContainer)
+    {
+        SubscriberThroughputData subscriberData;
+        subscriberData.m_subscriberPortID = static_cast<uint64_t>(connection.subscriberInfo.uniqueId);
+        auto subscriberPortData = connection.subscriberInfo.portData;
+        if (subscriberPortData != nullptr)
+        {
+            auto& chunkQueueData = subscriberPortData->m_chunkReceiverData;
+            const auto& statistics = chunkQueueData.m_statistics;
+            subscriberData.m_receivedChunks = statistics.m_receivedChunks.load(std::memory_order_relaxed);
+            subscriberData.m_lostChunks = statistics.m_lostChunks.load(std::memory_order_relaxed);
+            subscriberData.m_queueSize = chunkQueueData.m_queue.size();
+            subscriberData.m_queueCapacity = chunkQueueData.m_queue.capacity();
+        }
+
+        if (connection.publisherInfoIndex.has_value())
+        {
+            auto publisherInfo = m_publisherContainer.iter_from_index(connection.publisherInfoIndex.value());
+            if (publisherInfo != m_publisherContainer.end() && publisherInfo->portData != nullptr)
+            {
+                PublisherPort port(publisherInfo->portData);
+                subscriberData.m_publisherPortID = static_cast<uint64_t>(port.getUniqueID());
+            }
+        }
+
+        subscriberData.m_receivedChunksPerMinute =
+            perMinute(subscriberData.m_receivedChunks - connection.lastReceivedChunks);
+        subscriberData.m_lostChunksPerMinute = perMinute(subscriberData.m_lostChunks - connection.lastLostChunks);
+        connection.lastReceivedChunks = subscriberData.m_receivedChunks;
+        connection.lastLostChunks = subscriberData.m_lostChunks;
+
+        topic.m_subscriberThroughputList.emplace_back(subscriberData);
+    }
 }
 
 template <typename PublisherPort, typename SubscriberPort>
@@ -602,35 +853,28 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareT
     SubscriberPortChangingIntrospectionFieldTopic& topic) noexcept
 {
     std::lock_guard<std::mutex> lock(m_mutex);
-    for (auto& connPair : m_connectionMap)
+    for (const auto& connection : m_connectionContainer)
     {
-        for (auto& pair : connPair.second)
+        const auto& subscriberInfo = connection.subscriberInfo;
+        SubscriberPortChangingData subscriberData;
+        subscriberData.subscriberPortID = static_cast<uint64_t>(subscriberInfo.uniqueId);
+        if (subscriberInfo.portData != nullptr)
         {
-            auto connectionIndex = pair.second;
-            if (connectionIndex >= 0)
-            {
-                auto connection = m_connectionContainer.iter_from_index(connectionIndex);
-                auto& subscriberInfo = connection->subscriberInfo;
-                SubscriberPortChangingData subscriberData;
-                if (subscriberInfo.portData != nullptr)
-                {
-                    SubscriberPort port(subscriberInfo.portData);
-                    subscriberData.subscriptionState = port.getSubscriptionState();
-
-                    // subscriberData.fifoCapacity = port .getDeliveryFiFoCapacity();
-                    // subscriberData.fifoSize = port.getDeliveryFiFoSize();
-                    subscriberData.propagationScope = port.getCaProServiceDescription().getScope();
-                }
-                else
-                {
-                    subscriberData.fifoCapacity = 0u;
-                    subscriberData.fifoSize = 0u;
-                    subscriberData.subscriptionState = iox::SubscribeState::NOT_SUBSCRIBED;
-                    subscriberData.propagationScope = capro::Scope::INVALID;
-                }
-                topic.subscriberPortChangingDataList.push_back(subscriberData);
-            }
+            SubscriberPort port(subscriberInfo.portData);
+            subscriberData.subscriptionState = port.getSubscriptionState();
+
+            subscriberData.fifoCapacity = subscriberInfo.portData->m_chunkReceiverData.m_queue.capacity();
+            subscriberData.fifoSize = subscriberInfo.portData->m_chunkReceiverData.m_queue.size();
+            subscriberData.propagationScope = port.getCaProServiceDescription().getScope();
+        }
+        else
+        {
+            subscriberData.fifoCapacity = 0u;
+            subscriberData.fifoSize = 0u;
+            subscriberData.subscriptionState = iox::SubscribeState::NOT_SUBSCRIBED;
+            subscriberData.propagationScope = capro::Scope::INVALID;
         }
+        topic.subscriberPortChangingDataList.push_back(subscriberData);
     }
 }
 
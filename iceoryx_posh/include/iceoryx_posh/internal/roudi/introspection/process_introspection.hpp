@@ -92,8 +92,11 @@ class ProcessIntrospection
     std::mutex m_mutex;
 
     units::Duration m_sendInterval{units::Duration::fromSeconds(1U)};
-    concurrent::detail::PeriodicTask<function<void()>> m_publishingTask{
-        concurrent::detail::PeriodicTaskManualStart, "ProcessIntr", *this, &ProcessIntrospection::send};
+    concurrent::detail::PeriodicTask<function<void()>> m_publishingTask{concurrent::detail::PeriodicTaskManualStart,
+                                                                        concurrent::TimerService::getInstance(),
+                                                                        "ProcessIntr",
+                                                                        *this,
+                                                                        &ProcessIntrospection::send};
 };
 
 /// @brief typedef for the templated process introspection class that is used by RouDi for the
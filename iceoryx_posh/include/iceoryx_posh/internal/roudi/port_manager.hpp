@@ -125,12 +125,56 @@ class PortManager
     void deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcept;
 
   protected:
+    /// @brief Maximum number of ports of one kind which are shut down together before their CaPro messages are
+    /// distributed to the peer ports with a single pass over the peer port container
+    static constexpr uint64_t PORT_DESTRUCTION_BATCH_CAPACITY{64U};
+
+    /// @brief A port which was shut down but not yet removed and the CaPro message it emitted while shutting down
+    template <typename PortData>
+    struct PortDestruction
+    {
+        PortData* portData{nullptr};
+        optional<capro::CaproMessage> message;
+    };
+
+    template <typename PortData>
+    using PortDestructionBatch = vector<PortDestruction<PortData>, PORT_DESTRUCTION_BATCH_CAPACITY>;
+
+    using PublisherPortDestructionBatch = PortDestructionBatch<PublisherPortRouDiType::MemberType_t>;
+    using SubscriberPortDestructionBatch = PortDestructionBatch<SubscriberPortType::MemberType_t>;
+    using ClientPortDestructionBatch = PortDestructionBatch<popo::ClientPortData>;
+    using ServerPortDestructionBatch = PortDestructionBatch<popo::ServerPortData>;
+
     void makeAllPublisherPortsToStopOffer() noexcept;
 
     void destroyPublisherPort(PublisherPortRouDiType::MemberType_t* const publisherPortData) noexcept;
 
+    /// @brief Stops the offer of a publisher port and adds it to a batch of publisher ports to destroy; if the batch
+    /// is full, the ports in the batch are destroyed beforehand
+    /// @param[in] publisherPortData of the publisher port to shut down
+    /// @param[in] batch the publisher port is added to
+    void prepareDestructionOfPublisherPort(PublisherPortRouDiType::MemberType_t* const publisherPortData,
+                                           PublisherPortDestructionBatch& batch) noexcept;
+
+    /// @brief Distributes the STOP_OFFER messages of all publisher ports in the batch with a single pass over the
+    /// subscriber ports, removes the publisher ports from the port pool and clears the batch
+    /// @param[in] batch of publisher ports to destroy
+    void destroyPublisherPorts(PublisherPortDestructionBatch& batch) noexcept;
+
     void destroySubscriberPort(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept;
 
+    /// @brief Unsubscribes a subscriber port and adds it to a batch of subscriber ports to destroy; if the batch is
+    /// full, the ports in the batch are destroyed beforehand
+    /// @param[in] subscriberPortData of the subscriber port to shut down
+    /// @param[in] batch the subscriber port is added to
+    void prepareDestructionOfSubscriberPort(SubscriberPortType::MemberType_t* const subscriberPortData,
+                                            SubscriberPortDestructionBatch& batch) noexcept;
+
+    /// @brief Distributes the UNSUB messages of all subscriber ports in the batch with a single pass over the
+    /// publisher ports, removes the subscriber ports from the port pool and clears the batch
+    /// @param[in] batch of subscriber ports to destroy
+    void destroySubscriberPorts(SubscriberPortDestructionBatch& batch) noexcept;
+
     void handlePublisherPorts() noexcept;
 
     void doDiscoveryForPublisherPort(PublisherPortRouDiType& publisherPort) noexcept;
@@ -141,6 +185,18 @@ class PortManager
 
     void destroyClientPort(popo::ClientPortData* const clientPortData) noexcept;
 
+    /// @brief Disconnects a client port and adds it to a batch of client ports to destroy; if the batch is full, the
+    /// ports in the batch are destroyed beforehand
+    /// @param[in] clientPortData of the client port to shut down
+    /// @param[in] batch the client port is added to
+    void prepareDestructionOfClientPort(popo::ClientPortData* const clientPortData,
+                                        ClientPortDestructionBatch& batch) noexcept;
+
+    /// @brief Distributes the DISCONNECT messages of all client ports in the batch with a single pass over the server
+    /// ports, removes the client ports from the port pool and clears the batch
+    /// @param[in] batch of client ports to destroy
+    void destroyClientPorts(ClientPortDestructionBatch& batch) noexcept;
+
     void handleClientPorts() noexcept;
 
     void doDiscoveryForClientPort(popo::ClientPortRouDi& clientPort) noexcept;
@@ -149,6 +205,18 @@ class PortManager
 
     void destroyServerPort(popo::ServerPortData* const clientPortData) noexcept;
 
+    /// @brief Stops the offer of a server port and adds it to a batch of server ports to destroy; if the batch is
+    /// full, the ports in the batch are destroyed beforehand
+    /// @param[in] serverPortData of the server port to shut down
+    /// @param[in] batch the server port is added to
+    void prepareDestructionOfServerPort(popo::ServerPortData* const serverPortData,
+                                        ServerPortDestructionBatch& batch) noexcept;
+
+    /// @brief Distributes the STOP_OFFER messages of all server ports in the batch with a single pass over the client
+    /// ports, removes the server ports from the port pool and clears the batch
+    /// @param[in] batch of server ports to destroy
+    void destroyServerPorts(ServerPortDestructionBatch& batch) noexcept;
+
     void handleServerPorts() noexcept;
 
     void doDiscoveryForServerPort(popo::ServerPortRouDi& serverPort) noexcept;
@@ -163,16 +231,38 @@ class PortManager
     bool sendToAllMatchingPublisherPorts(const capro::CaproMessage& message,
                                          SubscriberPortType& subscriberSource) noexcept;
 
+    /// @brief Sends a CaPro message of a subscriber port to a publisher port if they are compatible
+    /// @return true if the publisher port is compatible with the subscriber port, false otherwise
+    bool sendToPublisherPort(const capro::CaproMessage& message,
+                             SubscriberPortType& subscriberSource,
+                             PublisherPortRouDiType& publisherPort) noexcept;
+
     void sendToAllMatchingSubscriberPorts(const capro::CaproMessage& message,
                                           PublisherPortRouDiType& publisherSource) noexcept;
 
+    /// @brief Sends a CaPro message of a publisher port to a subscriber port if they are compatible
+    void sendToSubscriberPort(const capro::CaproMessage& message,
+                              PublisherPortRouDiType& publisherSource,
+                              SubscriberPortType& subscriberPort) noexcept;
+
     bool isCompatibleClientServer(const popo::ServerPortRouDi& server,
                                   const popo::ClientPortRouDi& client) const noexcept;
 
     void sendToAllMatchingClientPorts(const capro::CaproMessage& message, popo::ServerPortRouDi& serverSource) noexcept;
 
+    /// @brief Sends a CaPro message of a server port to a client port if they are compatible
+    void sendToClientPort(const capro::CaproMessage& message,
+                          popo::ServerPortRouDi& serverSource,
+                          popo::ClientPortRouDi& clientPort) noexcept;
+
     bool sendToAllMatchingServerPorts(const capro::CaproMessage& message, popo::ClientPortRouDi& clientSource) noexcept;
 
+    /// @brief Sends a CaPro message of a client port to a server port if they are compatible
+    /// @return true if the server port is compatible with the client port, false otherwise
+    bool sendToServerPort(const capro::CaproMessage& message,
+                          popo::ClientPortRouDi& clientSource,
+                          popo::ServerPortRouDi& serverPort) noexcept;
+
     void sendToAllMatchingInterfacePorts(const capro::CaproMessage& message) noexcept;
 
     void addPublisherToServiceRegistry(const capro::ServiceDescription& service) noexcept;
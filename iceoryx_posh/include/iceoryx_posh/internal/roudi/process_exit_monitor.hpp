@@ -0,0 +1,88 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_PROCESS_EXIT_MONITOR_HPP
+#define IOX_POSH_ROUDI_PROCESS_EXIT_MONITOR_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/duration.hpp"
+#include "iox/vector.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Detects the termination of processes immediately by waiting on a process file descriptor (pidfd) for each
+/// added process. Process file descriptors are only available on Linux 5.3 and newer; everywhere else 'isAvailable'
+/// returns false and the heartbeat based process monitoring has to be used.
+/// @note 'add' and 'remove' must not be called concurrently with each other but they can be called concurrently with
+/// 'waitForTerminatedProcesses'
+class ProcessExitMonitor
+{
+  public:
+    /// @brief the maximum number of terminated processes which are reported by a single call to
+    /// 'waitForTerminatedProcesses'; further terminated processes are reported by the next call
+    static constexpr uint64_t MAX_TERMINATED_PROCESSES_PER_WAIT{16U};
+
+    using TerminatedProcesses_t = vector<uint32_t, MAX_TERMINATED_PROCESSES_PER_WAIT>;
+
+    ProcessExitMonitor() noexcept;
+    ~ProcessExitMonitor() noexcept;
+
+    ProcessExitMonitor(const ProcessExitMonitor&) = delete;
+    ProcessExitMonitor(ProcessExitMonitor&&) = delete;
+    ProcessExitMonitor& operator=(const ProcessExitMonitor&) = delete;
+    ProcessExitMonitor& operator=(ProcessExitMonitor&&) = delete;
+
+    /// @brief Checks whether the operating system supports process file descriptors
+    /// @return true if processes can be monitored, false otherwise
+    bool isAvailable() const noexcept;
+
+    /// @brief Starts to monitor a process
+    /// @param[in] pid of the process to monitor
+    /// @return true if the process is monitored, false if no process file descriptor could be acquired, e.g. because
+    /// the process does not exist or the monitor is not available
+    bool add(const uint32_t pid) noexcept;
+
+    /// @brief Stops to monitor a process; does nothing if the process is not monitored
+    /// @param[in] pid of the process which shall not be monitored anymore
+    void remove(const uint32_t pid) noexcept;
+
+    /// @brief Waits until at least one of the monitored processes has terminated or the timeout has passed. Each
+    /// terminated process is reported only once, even if it is not removed from the monitor.
+    /// @param[in] timeout is the maximum time to wait
+    /// @return the pids of the terminated processes; empty if the timeout has passed
+    TerminatedProcesses_t waitForTerminatedProcesses(const units::Duration timeout) noexcept;
+
+  private:
+    static constexpr int32_t INVALID_FD{-1};
+
+    struct MonitoredProcess
+    {
+        uint32_t pid{0U};
+        int32_t pidFd{INVALID_FD};
+    };
+
+    int32_t m_epollFd{INVALID_FD};
+    vector<MonitoredProcess, MAX_PROCESS_NUMBER> m_monitoredProcesses;
+};
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_PROCESS_EXIT_MONITOR_HPP
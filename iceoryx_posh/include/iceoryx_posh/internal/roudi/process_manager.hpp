@@ -21,6 +21,7 @@
 #include "iceoryx_posh/internal/roudi/introspection/process_introspection.hpp"
 #include "iceoryx_posh/internal/roudi/port_manager.hpp"
 #include "iceoryx_posh/internal/roudi/process.hpp"
+#include "iceoryx_posh/internal/roudi/process_exit_monitor.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_user.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/roudi/heartbeat_pool.hpp"
@@ -148,6 +149,16 @@ class ProcessManager : public ProcessManagerInterface
 
     void initIntrospection(ProcessIntrospectionType* processIntrospection) noexcept;
 
+    /// @brief Enables the immediate detection of terminated processes. Monitored processes which register afterwards
+    /// are additionally added to the ProcessExitMonitor; the heartbeat monitoring stays active as fallback.
+    /// @param[in] processExitMonitor which is used to detect terminated processes; must outlive the ProcessManager
+    void initProcessExitMonitor(ProcessExitMonitor* processExitMonitor) noexcept;
+
+    /// @brief Removes the process with the given pid and its resources after the ProcessExitMonitor reported its
+    /// termination; does nothing if no process with the pid is registered
+    /// @param[in] pid of the terminated process
+    void handleTerminatedProcess(const uint32_t pid) noexcept;
+
     void run() noexcept;
 
     popo::PublisherPortData* addIntrospectionPublisherPort(const capro::ServiceDescription& service) noexcept;
@@ -229,6 +240,7 @@ class ProcessManager : public ProcessManagerInterface
     segment_id_underlying_t m_mgmtSegmentId{UntypedRelativePointer::NULL_POINTER_ID};
     ProcessList_t m_processList;
     ProcessIntrospectionType* m_processIntrospection{nullptr};
+    ProcessExitMonitor* m_processExitMonitor{nullptr};
     version::CompatibilityCheckLevel m_compatibilityCheckLevel;
     HeartbeatPool* m_heartbeatPool;
 };
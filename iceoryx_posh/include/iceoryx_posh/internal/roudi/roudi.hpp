@@ -102,6 +102,8 @@ class RouDi
 
     void monitorAndDiscoveryUpdate() noexcept;
 
+    void monitorProcessExits() noexcept;
+
     ScopeGuard m_unregisterRelativePtr{[] { UntypedRelativePointer::unregisterAll(); }};
     const config::RouDiConfig m_roudiConfig;
     std::atomic_bool m_runMonitoringAndDiscoveryThread;
@@ -110,6 +112,9 @@ class RouDi
     popo::UserTrigger m_discoveryLoopTrigger;
     optional<UnnamedSemaphore> m_discoveryFinishedSemaphore;
 
+    /// @note must outlive the process manager which holds a pointer to it
+    ProcessExitMonitor m_processExitMonitor;
+
     const units::Duration m_runtimeMessagesThreadTimeout{100_ms};
 
   protected:
@@ -128,6 +133,7 @@ class RouDi
 
   private:
     std::thread m_monitoringAndDiscoveryThread;
+    std::thread m_processExitMonitoringThread;
     std::thread m_handleRuntimeMessageThread;
 
   protected:
@@ -0,0 +1,94 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_RUNTIME_PORT_INDEX_HPP
+#define IOX_POSH_ROUDI_RUNTIME_PORT_INDEX_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/attributes.hpp"
+#include "iox/uninitialized_array.hpp"
+#include "iox/vector.hpp"
+
+#include <cstdint>
+#include <limits>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Keeps track of the ports of one kind which are owned by each runtime, in order to find all ports of a
+/// runtime without searching through the whole port pool. The ports of a runtime are stored in a singly linked list
+/// which is threaded through a pool of nodes; the runtime name is taken from the 'm_runtimeName' member of the first
+/// port in the list, therefore no runtime names need to be stored.
+/// @tparam T is the port data type which must have a 'm_runtimeName' member
+/// @tparam Capacity is the maximum number of ports, i.e. the capacity of the corresponding port container
+template <typename T, uint64_t Capacity>
+class RuntimePortIndex
+{
+  public:
+    RuntimePortIndex() noexcept;
+
+    RuntimePortIndex(const RuntimePortIndex&) = delete;
+    RuntimePortIndex(RuntimePortIndex&&) = delete;
+    RuntimePortIndex& operator=(const RuntimePortIndex&) = delete;
+    RuntimePortIndex& operator=(RuntimePortIndex&&) = delete;
+
+    ~RuntimePortIndex() noexcept = default;
+
+    /// @brief Adds a port to the ports of the runtime stored in its 'm_runtimeName' member
+    /// @param[in] port to add; must not already be contained in the index
+    /// @return true if the port was added, false if the index is full
+    bool add(T* const port) noexcept;
+
+    /// @brief Removes a port from the index; does nothing if the port is not contained in the index
+    /// @param[in] port to remove
+    void remove(const T* const port) noexcept;
+
+    /// @brief Calls the provided callable with each port of a runtime
+    /// @param[in] runtimeName of the runtime whose ports shall be visited
+    /// @param[in] callable with the signature 'void(T*)'; it is allowed to remove the port it is called with and the
+    /// already visited ports from the index but no other ports
+    template <typename Callable>
+    void forEachPortOf(const RuntimeName_t& runtimeName, const Callable& callable) noexcept;
+
+    /// @brief Returns the number of ports in the index
+    uint64_t size() const noexcept;
+
+  private:
+    using Index_t = uint32_t;
+    static constexpr Index_t INVALID_INDEX{std::numeric_limits<Index_t>::max()};
+
+    static_assert(Capacity < INVALID_INDEX, "The capacity exceeds the range of the index type");
+
+    /// @brief returns the position of the list of the runtime in 'm_runtimes' or 'm_runtimes.size()' if the runtime
+    /// has no ports in the index
+    uint64_t findRuntime(const RuntimeName_t& runtimeName) const noexcept;
+
+  private:
+    UninitializedArray<T*, Capacity> m_ports;
+    UninitializedArray<Index_t, Capacity> m_next;
+    Index_t m_freeHead{0U};
+    uint64_t m_size{0U};
+    /// @brief the first node of the list of each runtime which owns at least one port
+    vector<Index_t, Capacity> m_runtimes;
+};
+
+} // namespace roudi
+} // namespace iox
+
+#include "iceoryx_posh/internal/roudi/runtime_port_index.inl"
+
+#endif // IOX_POSH_ROUDI_RUNTIME_PORT_INDEX_HPP
@@ -0,0 +1,147 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_RUNTIME_PORT_INDEX_INL
+#define IOX_POSH_ROUDI_RUNTIME_PORT_INDEX_INL
+
+#include "iceoryx_posh/internal/roudi/runtime_port_index.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+template <typename T, uint64_t Capacity>
+inline RuntimePortIndex<T, Capacity>::RuntimePortIndex() noexcept
+{
+    for (Index_t i = 0U; i < Capacity; ++i)
+    {
+        m_next[i] = i + 1U;
+    }
+    m_next[Capacity - 1U] = INVALID_INDEX;
+}
+
+template <typename T, uint64_t Capacity>
+inline bool RuntimePortIndex<T, Capacity>::add(T* const port) noexcept
+{
+    if (m_freeHead == INVALID_INDEX)
+    {
+        return false;
+    }
+
+    const auto node = m_freeHead;
+    m_freeHead = m_next[node];
+    m_ports[node] = port;
+
+    const auto runtime = findRuntime(port->m_runtimeName);
+    if (runtime == m_runtimes.size())
+    {
+        m_next[node] = INVALID_INDEX;
+        IOX_DISCARD_RESULT(m_runtimes.push_back(node));
+    }
+    else
+    {
+        m_next[node] = m_runtimes[runtime];
+        m_runtimes[runtime] = node;
+    }
+
+    ++m_size;
+    return true;
+}
+
+template <typename T, uint64_t Capacity>
+inline void RuntimePortIndex<T, Capacity>::remove(const T* const port) noexcept
+{
+    const auto runtime = findRuntime(port->m_runtimeName);
+    if (runtime == m_runtimes.size())
+    {
+        return;
+    }
+
+    auto previous = INVALID_INDEX;
+    for (auto node = m_runtimes[runtime]; node != INVALID_INDEX; node = m_next[node])
+    {
+        if (m_ports[node] != port)
+        {
+            previous = node;
+            continue;
+        }
+
+        if (previous != INVALID_INDEX)
+        {
+            m_next[previous] = m_next[node];
+        }
+        else if (m_next[node] != INVALID_INDEX)
+        {
+            m_runtimes[runtime] = m_next[node];
+        }
+        else
+        {
+            // this was the last port of the runtime; the order of the runtimes does not matter
+            m_runtimes[runtime] = m_runtimes.back();
+            m_runtimes.pop_back();
+        }
+
+        m_next[node] = m_freeHead;
+        m_freeHead = node;
+        --m_size;
+        return;
+    }
+}
+
+template <typename T, uint64_t Capacity>
+template <typename Callable>
+inline void RuntimePortIndex<T, Capacity>::forEachPortOf(const RuntimeName_t& runtimeName,
+                                                         const Callable& callable) noexcept
+{
+    const auto runtime = findRuntime(runtimeName);
+    if (runtime == m_runtimes.size())
+    {
+        return;
+    }
+
+    auto node = m_runtimes[runtime];
+    while (node != INVALID_INDEX)
+    {
+        // the callable might remove the current port, therefore the next node must be acquired beforehand
+        const auto current = node;
+        node = m_next[node];
+        callable(m_ports[current]);
+    }
+}
+
+template <typename T, uint64_t Capacity>
+inline uint64_t RuntimePortIndex<T, Capacity>::size() const noexcept
+{
+    return m_size;
+}
+
+template <typename T, uint64_t Capacity>
+inline uint64_t RuntimePortIndex<T, Capacity>::findRuntime(const RuntimeName_t& runtimeName) const noexcept
+{
+    for (uint64_t i = 0U; i < m_runtimes.size(); ++i)
+    {
+        if (m_ports[m_runtimes[i]]->m_runtimeName == runtimeName)
+        {
+            return i;
+        }
+    }
+    return m_runtimes.size();
+}
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_RUNTIME_PORT_INDEX_INL
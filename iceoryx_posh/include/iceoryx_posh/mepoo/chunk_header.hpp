@@ -31,7 +31,11 @@ namespace popo
 {
 template <typename T>
 class ChunkSender;
-}
+template <uint64_t InlineUserPayloadCapacity>
+class ChunkQueueElement;
+template <typename T, typename H>
+class Sample;
+} // namespace popo
 
 namespace mepoo
 {
@@ -143,11 +147,20 @@ struct ChunkHeader
   private:
     template <typename T>
     friend class popo::ChunkSender;
+    template <uint64_t InlineUserPayloadCapacity>
+    friend class popo::ChunkQueueElement;
+    template <typename T, typename H>
+    friend class popo::Sample;
 
     void setOriginId(const popo::UniquePortId originId) noexcept;
 
     void setSequenceNumber(const uint64_t sequenceNumber) noexcept;
 
+    /// @brief Reduces the user-payload size, e.g. when a slice with less elements than loaned is published
+    /// @param[in] userPayloadSize is the new user-payload size
+    /// @return true if the user-payload size was reduced, false if the new size exceeds the current one
+    bool shrinkUserPayloadSize(const uint64_t userPayloadSize) noexcept;
+
     uint64_t overflowSafeUsedSizeOfChunk() const noexcept;
 
   private:
@@ -50,6 +50,10 @@ struct ClientOptions
     /// @note Corresponds with ServerOptions::requestQueueFullPolicy
     ConsumerTooSlowPolicy serverTooSlowPolicy{ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
 
+    /// @brief The policy which selects the server a request is sent to when multiple servers offer the service
+    /// @note Corresponds with ServerOptions::allowMultipleServers
+    LoadBalancingPolicy loadBalancingPolicy{LoadBalancingPolicy::ROUND_ROBIN};
+
     /// @brief serialization of the ClientOptions
     Serialization serialize() const noexcept;
     /// @brief deserialization of the ClientOptions
@@ -18,7 +18,9 @@
 #define IOX_POSH_POPO_LISTENER_HPP
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/listener_worker_pool.hpp"
 #include "iceoryx_posh/popo/enum_trigger_type.hpp"
+#include "iceoryx_posh/popo/listener_options.hpp"
 #include "iceoryx_posh/popo/notification_attorney.hpp"
 #include "iceoryx_posh/popo/notification_callback.hpp"
 #include "iceoryx_posh/popo/trigger_handle.hpp"
@@ -79,7 +81,8 @@ enum class ListenerError
 
 /// @brief The Listener is a class which reacts to registered events by
 ///        executing a corresponding callback concurrently. This is achieved via
-///        an encapsulated thread inside this class.
+///        an encapsulated thread inside this class. Optionally, the callbacks can be executed by a pool of
+///        worker threads, see ListenerOptions.
 /// @note  The Listener is threadsafe and can be used without any restrictions concurrently.
 /// @attention Calling detachEvent for the same event from multiple threads is supported but
 ///            can cause a race condition if you attach the same event again concurrently from
@@ -102,6 +105,12 @@ class Listener
 {
   public:
     Listener() noexcept;
+
+    /// @brief Creates a Listener which executes the callbacks of the attached events on the worker threads
+    ///        configured in the options. With an empty list of workers it behaves like the default Listener.
+    /// @param[in] options the options of the Listener
+    explicit Listener(const ListenerOptions& options) noexcept;
+
     Listener(const Listener&) = delete;
     Listener(Listener&&) = delete;
     ~Listener() noexcept;
@@ -168,6 +177,7 @@ class Listener
 
   protected:
     Listener(ConditionVariableData& conditionVariableData) noexcept;
+    Listener(ConditionVariableData& conditionVariableData, const ListenerOptions& options) noexcept;
 
   private:
     class Event_t;
@@ -214,6 +224,7 @@ class Listener
     std::atomic_bool m_wasDtorCalled{false};
     ConditionVariableData* m_conditionVariableData = nullptr;
     ConditionListener m_conditionListener;
+    optional<ListenerWorkerPool> m_workerPool;
 };
 
 } // namespace popo
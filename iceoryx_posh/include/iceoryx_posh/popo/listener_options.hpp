@@ -0,0 +1,70 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_LISTENER_OPTIONS_HPP
+#define IOX_POSH_POPO_LISTENER_OPTIONS_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/detail/posix_scheduler.hpp"
+#include "iox/duration.hpp"
+#include "iox/optional.hpp"
+#include "iox/thread.hpp"
+#include "iox/vector.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief This struct is used to configure a worker thread of the Listener
+struct ListenerWorkerOptions
+{
+    /// @brief The CPU cores the worker is pinned to, bit n represents CPU core n. With the default of 0 the affinity
+    ///        of the thread which creates the Listener is inherited.
+    uint64_t cpuAffinityMask{0U};
+
+    /// @brief The scheduler of the worker, e.g. iox::detail::Scheduler::FIFO. If not set the scheduling of the thread
+    ///        which creates the Listener is inherited.
+    optional<iox::detail::Scheduler> scheduler;
+
+    /// @brief The priority of the worker, it is only applied when a scheduler is set
+    int32_t priority{0};
+};
+
+/// @brief This struct is used to configure the Listener
+struct ListenerOptions
+{
+    /// @brief The worker threads which execute the callbacks of the attached events. If empty, the callbacks are
+    ///        executed by the single thread of the Listener which also waits for the events.
+    /// @note Callbacks of different events are executed concurrently by the workers but one and the same event is
+    ///       never executed concurrently.
+    vector<ListenerWorkerOptions, MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER> workerThreads;
+
+    /// @brief The time the Listener busy polls for events before it blocks. This lowers the latency of events which
+    ///        arrive within the budget but the Listener thread burns CPU time while polling. With the default of zero
+    ///        the Listener blocks immediately.
+    units::Duration busyPollBudget{units::Duration::fromNanoseconds(0U)};
+
+    /// @brief The CPU affinity and the scheduling of the thread of the Listener which waits for the events. With the
+    ///        defaults the affinity and the scheduling of the thread which creates the Listener are inherited.
+    ThreadSchedulingParameters threadSchedulingParameters;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_LISTENER_OPTIONS_HPP
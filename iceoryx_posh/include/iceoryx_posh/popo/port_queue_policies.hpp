@@ -41,6 +41,18 @@ enum class QueueFullPolicy : uint8_t
     DISCARD_OLDEST_DATA
 };
 
+/// @brief Used by clients to select one of multiple servers of a service to which a request is sent
+enum class LoadBalancingPolicy : uint8_t
+{
+    /// Sends the requests to the servers in turn
+    ROUND_ROBIN,
+    /// Sends the request to the server with the least requests in its queue
+    LEAST_QUEUED,
+    /// Sends all requests with the same routing key to the same server; when a server is added or removed only the
+    /// routing keys of this server are moved to another server
+    CONSISTENT_HASH
+};
+
 } // namespace popo
 } // namespace iox
 #endif // IOX_POSH_POPO_PORT_QUEUE_POLICIES_HPP
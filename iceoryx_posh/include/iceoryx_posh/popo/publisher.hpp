@@ -30,7 +30,7 @@ namespace iox
 namespace popo
 {
 /// @brief The Publisher class for the publish-subscribe messaging pattern in iceoryx.
-/// @param[in] T user payload type
+/// @param[in] T user payload type; a slice type 'T[]' loans samples with a variable number of elements of T
 /// @param[in] H user header type
 template <typename T, typename H = mepoo::NoUserHeader>
 class Publisher : public PublisherImpl<T, H>
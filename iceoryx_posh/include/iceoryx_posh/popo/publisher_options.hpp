@@ -45,6 +45,11 @@ struct PublisherOptions
     /// @brief The option whether the publisher should block when the subscriber queue is full
     ConsumerTooSlowPolicy subscriberTooSlowPolicy{ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
 
+    /// @brief The option whether user-payloads up to MAX_INLINE_USER_PAYLOAD_SIZE are copied into the subscriber queues
+    /// instead of being allocated in a mempool chunk; this has no effect if the inline path is disabled by the build
+    /// or the sample type is not trivially copyable
+    bool inlineUserPayload{false};
+
     /// @brief serialization of the PublisherOptions
     Serialization serialize() const noexcept;
     /// @brief deserialization of the PublisherOptions
@@ -52,7 +52,7 @@ class RpcBaseHeader
     ///            - members are rearranged
     ///            - semantic meaning of a member changes
     ///        in any of RpcBaseHeader, RequestHeader or ResponseHeader!
-    static constexpr uint8_t RPC_HEADER_VERSION{1U};
+    static constexpr uint8_t RPC_HEADER_VERSION{2U};
 
     static constexpr uint32_t UNKNOWN_CLIENT_QUEUE_INDEX{std::numeric_limits<uint32_t>::max()};
     static constexpr int64_t START_SEQUENCE_ID{0};
@@ -112,8 +112,21 @@ class RequestHeader : public RpcBaseHeader
     /// order
     void setSequenceId(const int64_t sequenceId) noexcept;
 
+    /// @brief Sets the routing key which is used to select the server when multiple servers offer the service and
+    /// the client uses LoadBalancingPolicy::CONSISTENT_HASH
+    /// @param[in] routingKey is a custom key; requests with the same key are sent to the same server as long as the
+    /// set of servers does not change
+    void setRoutingKey(const uint64_t routingKey) noexcept;
+
+    /// @brief Obtains the routing key of the request
+    /// @return the routing key of the request
+    uint64_t getRoutingKey() const noexcept;
+
     static RequestHeader* fromPayload(void* const payload) noexcept;
     static const RequestHeader* fromPayload(const void* const payload) noexcept;
+
+  private:
+    uint64_t m_routingKey{0U};
 };
 
 class ResponseHeader : public RpcBaseHeader
@@ -71,6 +71,81 @@ class Sample : public SmartChunk<PublisherInterface<T, H>, T, H>
     using BaseType::m_members;
 };
 
+/// @brief The Sample specialization for slices with a number of elements of type T which is chosen when the sample is
+/// loaned. The number of elements is derived from the user-payload size of the chunk.
+template <typename T, typename H>
+class Sample<T[], H> : public SmartChunk<PublisherInterface<T[], H>, T, H>
+{
+    using BaseType = SmartChunk<PublisherInterface<T[], H>, T, H>;
+
+  public:
+    template <typename T1, typename T2>
+    using ForPublisherOnly = typename BaseType::template ForProducerOnly<T1, T2>;
+
+    /// @brief Constructor for a Sample used by the publisher/subscriber
+    /// @tparam S is a dummy template parameter to enable the constructor only for non-const T
+    /// @param smartChunkUniquePtr is a 'rvalue' to a 'iox::unique_ptr<T>' with to the first element of the slice
+    /// @param producer (for publisher only) is a reference to the publisher to be able to use publisher specific
+    /// methods
+    using BaseType::BaseType;
+
+    /// @brief Retrieve the user-header of the underlying memory chunk loaned to the sample.
+    /// @return The user-header of the underlying memory chunk.
+    using BaseType::getUserHeader;
+
+    /// @brief The number of elements of the slice
+    /// @return the number of elements
+    uint64_t size() const noexcept;
+
+    /// @brief Checks if the slice has no elements
+    /// @return true if the slice is empty, otherwise false
+    bool empty() const noexcept;
+
+    /// @brief Access to the element at the provided index
+    /// @param[in] index of the element; terminates if the index is out of bounds
+    /// @return a reference to the element
+    T& operator[](const uint64_t index) noexcept;
+
+    /// @brief Read-only access to the element at the provided index
+    /// @param[in] index of the element; terminates if the index is out of bounds
+    /// @return a const reference to the element
+    const T& operator[](const uint64_t index) const noexcept;
+
+    /// @brief Iterators to the elements of the slice
+    T* begin() noexcept;
+    const T* begin() const noexcept;
+    T* end() noexcept;
+    const T* end() const noexcept;
+
+    /// @brief Reduces the number of elements of the slice before it is published, which reduces the user-payload
+    /// size of the chunk and therefore the bytes the subscribers touch. The removed elements are destroyed.
+    /// @details Only available for non-const type T.
+    /// @param[in] numberOfElements is the new number of elements
+    /// @return true if the slice was shrunk, false if numberOfElements exceeds the current size
+    template <typename S = T, typename = ForPublisherOnly<S, T>>
+    bool shrink(const uint64_t numberOfElements) noexcept;
+
+    /// @brief Publish the sample via the publisher from which it was loaned and automatically
+    /// release ownership to it.
+    /// @details Only available for non-const type T.
+    template <typename S = T, typename = ForPublisherOnly<S, T>>
+    void publish() noexcept;
+
+  private:
+    template <typename, typename, typename>
+    friend class PublisherImpl;
+
+    /// @note the slice provides access to its elements via operator[] and the iterators
+    using BaseType::operator->;
+    using BaseType::operator*;
+
+    /// @note used by the publisher to release the chunk ownership from the 'Sample' after publishing the chunk and
+    /// therefore preventing the invocation of the custom deleter
+    using BaseType::release;
+
+    using BaseType::m_members;
+};
+
 } // namespace popo
 } // namespace iox
 
@@ -50,6 +50,22 @@ struct ServerOptions
     /// @note Corresponds with ClientOptions::responseQueueFullPolicy
     ConsumerTooSlowPolicy clientTooSlowPolicy{ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
 
+    /// @brief The option whether the server can be used by multiple threads concurrently, e.g. to take requests and
+    /// send the responses from a pool of worker threads. The requests are taken from the shared request queue and the
+    /// responses are routed to the clients via the ResponseHeader like with a single thread.
+    /// @note The number of requests and responses held by all threads together is limited by
+    /// MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY and MAX_RESPONSES_ALLOCATED_SIMULTANEOUSLY
+    /// @note A thread which is blocked in 'send' due to ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER also blocks the other
+    /// threads from taking requests
+    bool concurrentRequestProcessing{false};
+
+    /// @brief The option whether further servers with the same service description may be created. This allows to
+    /// scale a service horizontally by running multiple server instances; a client distributes its requests to the
+    /// servers according to ClientOptions::loadBalancingPolicy.
+    /// @note All servers of a service must set this option, otherwise the creation of a further server fails
+    /// @note A response is always sent by the server which received the request
+    bool allowMultipleServers{false};
+
     /// @brief serialization of the ServerOptions
     Serialization serialize() const noexcept;
     /// @brief deserialization of the ServerOptions
@@ -30,7 +30,7 @@ namespace iox
 namespace popo
 {
 /// @brief The Subscriber class for the publish-subscribe messaging pattern in iceoryx.
-/// @param[in] T user payload type
+/// @param[in] T user payload type; a slice type 'T[]' takes samples with a variable number of elements of T
 /// @param[in] H user header type
 template <typename T, typename H = mepoo::NoUserHeader>
 class Subscriber : public SubscriberImpl<T, H>
@@ -206,6 +206,11 @@ class WaitSet
     /// @return NotificationInfoVector of NotificationInfos that have been triggered
     NotificationInfoVector wait() noexcept;
 
+    /// @brief Sets the time 'wait' and 'timedWait' busy poll for a notification before they block. This lowers the
+    /// wake-up latency when notifications arrive shortly after the wait call but burns CPU time while polling.
+    /// @param[in] budget the maximum time to busy poll per wait call; the default of zero blocks immediately
+    void setBusyPollBudget(const units::Duration budget) noexcept;
+
     /// @brief Returns the amount of stored Trigger inside of the WaitSet
     uint64_t size() const noexcept;
 
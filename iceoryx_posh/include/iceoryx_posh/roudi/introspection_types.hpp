@@ -72,7 +72,11 @@ struct PortData
     capro::IdString_t m_caproEventMethodID;
 };
 
-using SubscriberPortData = PortData;
+/// @brief container for subscriber port introspection data.
+struct SubscriberPortData : public PortData
+{
+    uint64_t m_subscriberPortID{0};
+};
 
 /// @brief container for publisher port introspection data.
 struct PublisherPortData : public PortData
@@ -84,27 +88,77 @@ struct PublisherPortData : public PortData
 /// @brief the topic for the port introspection that a user can subscribe to
 struct PortIntrospectionFieldTopic
 {
+    /// @brief is incremented with every change of the port lists which is published; a PortIntrospectionDeltaTopic
+    /// with the same base generation can be applied to the topic
+    uint64_t m_generation{0};
     vector<SubscriberPortData, MAX_SUBSCRIBERS> m_subscriberList;
     vector<PublisherPortData, MAX_PUBLISHERS> m_publisherList;
 };
 
+const capro::ServiceDescription IntrospectionPortDeltaService(INTROSPECTION_SERVICE_ID, "RouDi_ID", "PortDelta");
+
+/// @brief the maximum number of added and of removed ports of each kind in a PortIntrospectionDeltaTopic; when more
+/// ports change within one send interval, the PortIntrospectionFieldTopic is sent instead
+constexpr uint32_t MAX_PORT_INTROSPECTION_DELTA_ENTRIES{32U};
+/// @brief the PortIntrospectionFieldTopic is sent at the latest after this number of consecutive deltas; this is also
+/// the history capacity of the delta publisher, therefore a new subscriber receives the last
+/// PortIntrospectionFieldTopic and all deltas which were sent after it
+constexpr uint32_t PORT_INTROSPECTION_DELTAS_PER_SNAPSHOT{8U};
+static_assert(PORT_INTROSPECTION_DELTAS_PER_SNAPSHOT <= MAX_PUBLISHER_HISTORY,
+              "The deltas after the last PortIntrospectionFieldTopic must fit into the publisher history");
+
+/// @brief the changes of the port lists which turn the PortIntrospectionFieldTopic with the generation
+/// 'm_baseGeneration' into the one with the generation 'm_generation'; removed ports are identified by their port id
+struct PortIntrospectionDeltaTopic
+{
+    uint64_t m_baseGeneration{0};
+    uint64_t m_generation{0};
+    vector<SubscriberPortData, MAX_PORT_INTROSPECTION_DELTA_ENTRIES> m_addedSubscribers;
+    vector<uint64_t, MAX_PORT_INTROSPECTION_DELTA_ENTRIES> m_removedSubscriberPortIDs;
+    vector<PublisherPortData, MAX_PORT_INTROSPECTION_DELTA_ENTRIES> m_addedPublishers;
+    vector<uint64_t, MAX_PORT_INTROSPECTION_DELTA_ENTRIES> m_removedPublisherPortIDs;
+};
+
 const capro::ServiceDescription
     IntrospectionPortThroughputService(INTROSPECTION_SERVICE_ID, "RouDi_ID", "PortThroughput");
 
+/// @brief throughput of a publisher port; the rates refer to the last introspection interval, the counters are
+/// accumulated since the creation of the port
 struct PortThroughputData
 {
     uint64_t m_publisherPortID{0};
     uint64_t m_sampleSize{0};
     uint64_t m_chunkSize{0};
     double m_chunksPerMinute{0};
+    /// @brief average time between two sent chunks in the last introspection interval
     uint64_t m_lastSendIntervalInNanoseconds{0};
     bool m_isField{false};
+    uint64_t m_sentChunks{0};
+    uint64_t m_deliveredChunks{0};
+    uint64_t m_droppedChunks{0};
+    uint64_t m_loanFailures{0};
+    uint64_t m_blockedTimeInNanoseconds{0};
+};
+
+/// @brief throughput of a subscriber port; the rates refer to the last introspection interval, the counters are
+/// accumulated since the creation of the port
+struct SubscriberThroughputData
+{
+    uint64_t m_subscriberPortID{0};
+    uint64_t m_publisherPortID{0};
+    uint64_t m_receivedChunks{0};
+    uint64_t m_lostChunks{0};
+    double m_receivedChunksPerMinute{0};
+    double m_lostChunksPerMinute{0};
+    uint64_t m_queueSize{0};
+    uint64_t m_queueCapacity{0};
 };
 
 /// @brief the topic for the port throughput that a user can subscribe to
 struct PortThroughputIntrospectionFieldTopic
 {
     vector<PortThroughputData, MAX_PUBLISHERS> m_throughputList;
+    vector<SubscriberThroughputData, MAX_SUBSCRIBERS> m_subscriberThroughputList;
 };
 
 const capro::ServiceDescription
@@ -112,7 +166,7 @@ const capro::ServiceDescription
 
 struct SubscriberPortChangingData
 {
-    // index used to identify subscriber is same as in PortIntrospectionFieldTopic->subscriberList
+    uint64_t subscriberPortID{0};
     uint64_t fifoSize{0};
     uint64_t fifoCapacity{0};
     iox::SubscribeState subscriptionState{iox::SubscribeState::NOT_SUBSCRIBED};
@@ -28,6 +28,7 @@
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_multi_producer.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_single_producer.hpp"
 #include "iceoryx_posh/internal/roudi/port_pool_data.hpp"
+#include "iceoryx_posh/internal/roudi/runtime_port_index.hpp"
 #include "iceoryx_posh/popo/client_options.hpp"
 #include "iceoryx_posh/popo/publisher_options.hpp"
 #include "iceoryx_posh/popo/server_options.hpp"
@@ -159,8 +160,60 @@ class PortPool
     /// @note after this call the provided ConditionVariableData is no longer available for usage
     void removeConditionVariableData(const popo::ConditionVariableData* const conditionVariableData) noexcept;
 
+    /// @brief Calls the provided callable with each PublisherPortData of a runtime without searching the whole pool
+    /// @param[in] runtimeName of the runtime whose ports shall be visited
+    /// @param[in] callable with the signature 'void(PublisherPortRouDiType::MemberType_t*)'; it is allowed to remove
+    /// the port it is called with and the already visited ports of the runtime
+    template <typename Callable>
+    void forEachPublisherPortOf(const RuntimeName_t& runtimeName, const Callable& callable) noexcept;
+
+    /// @brief Calls the provided callable with each SubscriberPortData of a runtime without searching the whole pool
+    /// @param[in] runtimeName of the runtime whose ports shall be visited
+    /// @param[in] callable with the signature 'void(SubscriberPortType::MemberType_t*)'; it is allowed to remove the
+    /// port it is called with and the already visited ports of the runtime
+    template <typename Callable>
+    void forEachSubscriberPortOf(const RuntimeName_t& runtimeName, const Callable& callable) noexcept;
+
+    /// @brief Calls the provided callable with each ClientPortData of a runtime without searching the whole pool
+    /// @param[in] runtimeName of the runtime whose ports shall be visited
+    /// @param[in] callable with the signature 'void(popo::ClientPortData*)'; it is allowed to remove the port it is
+    /// called with and the already visited ports of the runtime
+    template <typename Callable>
+    void forEachClientPortOf(const RuntimeName_t& runtimeName, const Callable& callable) noexcept;
+
+    /// @brief Calls the provided callable with each ServerPortData of a runtime without searching the whole pool
+    /// @param[in] runtimeName of the runtime whose ports shall be visited
+    /// @param[in] callable with the signature 'void(popo::ServerPortData*)'; it is allowed to remove the port it is
+    /// called with and the already visited ports of the runtime
+    template <typename Callable>
+    void forEachServerPortOf(const RuntimeName_t& runtimeName, const Callable& callable) noexcept;
+
+    /// @brief Calls the provided callable with each InterfacePortData of a runtime without searching the whole pool
+    /// @param[in] runtimeName of the runtime whose ports shall be visited
+    /// @param[in] callable with the signature 'void(popo::InterfacePortData*)'; it is allowed to remove the port it is
+    /// called with and the already visited ports of the runtime
+    template <typename Callable>
+    void forEachInterfacePortOf(const RuntimeName_t& runtimeName, const Callable& callable) noexcept;
+
+    /// @brief Calls the provided callable with each ConditionVariableData of a runtime without searching the whole
+    /// pool
+    /// @param[in] runtimeName of the runtime whose condition variables shall be visited
+    /// @param[in] callable with the signature 'void(popo::ConditionVariableData*)'; it is allowed to remove the
+    /// condition variable it is called with and the already visited condition variables of the runtime
+    template <typename Callable>
+    void forEachConditionVariableDataOf(const RuntimeName_t& runtimeName, const Callable& callable) noexcept;
+
   private:
     PortPoolData* m_portPoolData;
+
+    // the indices live in the local memory of RouDi since only RouDi adds and removes ports; they read the runtime
+    // name from the ports, therefore a port must be removed from its index before it is destroyed
+    RuntimePortIndex<PublisherPortRouDiType::MemberType_t, MAX_PUBLISHERS> m_publisherPortIndex;
+    RuntimePortIndex<SubscriberPortType::MemberType_t, MAX_SUBSCRIBERS> m_subscriberPortIndex;
+    RuntimePortIndex<popo::ClientPortData, MAX_CLIENTS> m_clientPortIndex;
+    RuntimePortIndex<popo::ServerPortData, MAX_SERVERS> m_serverPortIndex;
+    RuntimePortIndex<popo::InterfacePortData, MAX_INTERFACE_NUMBER> m_interfacePortIndex;
+    RuntimePortIndex<popo::ConditionVariableData, MAX_NUMBER_OF_CONDITION_VARIABLES> m_conditionVariableIndex;
 };
 
 } // namespace roudi
@@ -68,6 +68,43 @@ inline iox::popo::SubscriberPortData* PortPool::constructSubscriber(const capro:
 
     return port.to_ptr();
 }
+
+template <typename Callable>
+inline void PortPool::forEachPublisherPortOf(const RuntimeName_t& runtimeName, const Callable& callable) noexcept
+{
+    m_publisherPortIndex.forEachPortOf(runtimeName, callable);
+}
+
+template <typename Callable>
+inline void PortPool::forEachSubscriberPortOf(const RuntimeName_t& runtimeName, const Callable& callable) noexcept
+{
+    m_subscriberPortIndex.forEachPortOf(runtimeName, callable);
+}
+
+template <typename Callable>
+inline void PortPool::forEachClientPortOf(const RuntimeName_t& runtimeName, const Callable& callable) noexcept
+{
+    m_clientPortIndex.forEachPortOf(runtimeName, callable);
+}
+
+template <typename Callable>
+inline void PortPool::forEachServerPortOf(const RuntimeName_t& runtimeName, const Callable& callable) noexcept
+{
+    m_serverPortIndex.forEachPortOf(runtimeName, callable);
+}
+
+template <typename Callable>
+inline void PortPool::forEachInterfacePortOf(const RuntimeName_t& runtimeName, const Callable& callable) noexcept
+{
+    m_interfacePortIndex.forEachPortOf(runtimeName, callable);
+}
+
+template <typename Callable>
+inline void PortPool::forEachConditionVariableDataOf(const RuntimeName_t& runtimeName,
+                                                     const Callable& callable) noexcept
+{
+    m_conditionVariableIndex.forEachPortOf(runtimeName, callable);
+}
 } // namespace roudi
 } // namespace iox
 
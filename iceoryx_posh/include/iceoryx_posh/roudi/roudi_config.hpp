@@ -18,6 +18,7 @@
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/version/compatibility_check_level.hpp"
+#include "iox/thread.hpp"
 
 #include <cstdint>
 
@@ -56,6 +57,19 @@ struct RouDiConfig
     /// @brief the number of memory chunks used for discovery
     uint32_t discoveryChunkCount{10};
 
+    /// @brief The CPU affinity and the scheduling of the thread which monitors the processes and runs the discovery
+    ThreadSchedulingParameters monitoringAndDiscoveryThread;
+    /// @brief The CPU affinity and the scheduling of the thread which processes the IPC messages of the runtimes
+    ThreadSchedulingParameters runtimeMessagesThread;
+    /// @brief The CPU affinity and the scheduling of the thread which waits for process exits in the 'pidfd'
+    /// monitoring mode
+    ThreadSchedulingParameters processExitMonitorThread;
+    /// @brief The CPU affinity and the scheduling of the thread of the TimerService which publishes the introspection
+    ThreadSchedulingParameters timerServiceThread;
+    /// @brief Locks all current and future pages of RouDi, including the mapped shared memory, into RAM to prevent
+    /// page faults and swapping; this requires the CAP_IPC_LOCK capability or a sufficient RLIMIT_MEMLOCK
+    bool lockMemory{false};
+
     RouDiConfig& setDefaults() noexcept;
     RouDiConfig& optimize() noexcept;
 };
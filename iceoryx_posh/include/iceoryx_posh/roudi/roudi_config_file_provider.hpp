@@ -46,6 +46,9 @@ enum class RouDiConfigFileParseError
     MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED,
     MEMPOOL_WITHOUT_CHUNK_SIZE,
     MEMPOOL_WITHOUT_CHUNK_COUNT,
+    INVALID_THREAD_CPU_AFFINITY,
+    INVALID_THREAD_SCHEDULER,
+    INVALID_THREAD_PRIORITY,
     EXCEPTION_IN_PARSER
 };
 
@@ -58,6 +61,9 @@ constexpr const char* ROUDI_CONFIG_FILE_PARSE_ERROR_STRINGS[] = {"FILE_OPEN_FAIL
                                                                  "MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED",
                                                                  "MEMPOOL_WITHOUT_CHUNK_SIZE",
                                                                  "MEMPOOL_WITHOUT_CHUNK_COUNT",
+                                                                 "INVALID_THREAD_CPU_AFFINITY",
+                                                                 "INVALID_THREAD_SCHEDULER",
+                                                                 "INVALID_THREAD_PRIORITY",
                                                                  "EXCEPTION_IN_PARSER"};
 
 /// @brief Base class for a config file provider.
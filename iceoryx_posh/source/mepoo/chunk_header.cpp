@@ -221,6 +221,16 @@ void ChunkHeader::setSequenceNumber(const uint64_t sequenceNumber) noexcept
     m_sequenceNumber = sequenceNumber;
 }
 
+bool ChunkHeader::shrinkUserPayloadSize(const uint64_t userPayloadSize) noexcept
+{
+    if (userPayloadSize > m_userPayloadSize)
+    {
+        return false;
+    }
+    m_userPayloadSize = userPayloadSize;
+    return true;
+}
+
 uint64_t ChunkHeader::overflowSafeUsedSizeOfChunk() const noexcept
 {
     return static_cast<uint64_t>(m_userPayloadOffset) + static_cast<uint64_t>(m_userPayloadSize);
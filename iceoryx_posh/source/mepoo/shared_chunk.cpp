@@ -143,5 +143,27 @@ ChunkManagement* SharedChunk::release() noexcept
     return returnValue;
 }
 
+void SharedChunk::acquireReferences(const uint64_t numberOfReferences) noexcept
+{
+    if ((m_chunkManagement != nullptr) && (numberOfReferences > 0U))
+    {
+        m_chunkManagement->m_referenceCounter.fetch_add(numberOfReferences, std::memory_order_relaxed);
+    }
+}
+
+SharedChunk SharedChunk::adoptAcquiredReference() const noexcept
+{
+    return SharedChunk(m_chunkManagement);
+}
+
+void SharedChunk::releaseAcquiredReferences(const uint64_t numberOfReferences) noexcept
+{
+    // the counter cannot drop to zero since this SharedChunk still holds its own reference
+    if ((m_chunkManagement != nullptr) && (numberOfReferences > 0U))
+    {
+        m_chunkManagement->m_referenceCounter.fetch_sub(numberOfReferences, std::memory_order_relaxed);
+    }
+}
+
 } // namespace mepoo
 } // namespace iox
@@ -17,6 +17,9 @@
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iox/detail/busy_poll.hpp"
+
+#include <algorithm>
 
 namespace iox
 {
@@ -55,9 +58,14 @@ bool ConditionListener::wasNotified() const noexcept
     return getMembers()->m_wasNotified.load(std::memory_order_relaxed);
 }
 
+void ConditionListener::setBusyPollBudget(const units::Duration budget) noexcept
+{
+    m_busyPollBudget = budget;
+}
+
 ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 {
-    return waitImpl([this]() -> bool {
+    return waitImpl(m_busyPollBudget, [this]() -> bool {
         if (this->getMembers()->m_semaphore->wait().has_error())
         {
             IOX_REPORT_FATAL(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT);
@@ -69,8 +77,10 @@ ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 
 ConditionListener::NotificationVector_t ConditionListener::timedWait(const units::Duration& timeToWait) noexcept
 {
-    return waitImpl([this, timeToWait]() -> bool {
-        if (this->getMembers()->m_semaphore->timedWait(timeToWait).has_error())
+    // the busy polling is part of the time to wait
+    const auto busyPollBudget = std::min(m_busyPollBudget, timeToWait);
+    return waitImpl(busyPollBudget, [this, timeToWait, busyPollBudget]() -> bool {
+        if (this->getMembers()->m_semaphore->timedWait(timeToWait - busyPollBudget).has_error())
         {
             IOX_REPORT_FATAL(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT);
         }
@@ -78,13 +88,15 @@ ConditionListener::NotificationVector_t ConditionListener::timedWait(const units
     });
 }
 
-ConditionListener::NotificationVector_t ConditionListener::waitImpl(const function_ref<bool()> waitCall) noexcept
+ConditionListener::NotificationVector_t ConditionListener::waitImpl(const units::Duration busyPollBudget,
+                                                                    const function_ref<bool()> waitCall) noexcept
 {
     using Type_t = iox::BestFittingType_t<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
     NotificationVector_t activeNotifications;
 
     resetSemaphore();
     bool doReturnAfterNotificationCollection = false;
+    bool hasBusyPolled = busyPollBudget == units::Duration::fromNanoseconds(0U);
     while (!m_toBeDestroyed.load(std::memory_order_relaxed))
     {
         for (Type_t i = 0U; i < MAX_NUMBER_OF_NOTIFIERS; i++)
@@ -100,6 +112,19 @@ ConditionListener::NotificationVector_t ConditionListener::waitImpl(const functi
             return activeNotifications;
         }
 
+        // busy poll only once per call, since 'm_wasNotified' might still be set from an already collected
+        // notification and the loop would never block
+        if (!hasBusyPolled)
+        {
+            hasBusyPolled = true;
+            if (detail::busyPoll(busyPollBudget, [this] {
+                    return wasNotified() || m_toBeDestroyed.load(std::memory_order_relaxed);
+                }))
+            {
+                continue;
+            }
+        }
+
         doReturnAfterNotificationCollection = !waitCall();
     }
 
@@ -30,9 +30,13 @@ ConditionVariableData::ConditionVariableData() noexcept
 ConditionVariableData::ConditionVariableData(const RuntimeName_t& runtimeName) noexcept
     : m_runtimeName(runtimeName)
 {
+#if defined(IOX_FUTEX_SEMAPHORE_AVAILABLE)
+    m_semaphore.emplace();
+#else
     UnnamedSemaphoreBuilder().initialValue(0U).isInterProcessCapable(true).create(m_semaphore).or_else([](auto) {
         IOX_REPORT_FATAL(PoshError::POPO__CONDITION_VARIABLE_DATA_FAILED_TO_CREATE_SEMAPHORE);
     });
+#endif
 
     for (auto& id : m_activeNotifications)
     {
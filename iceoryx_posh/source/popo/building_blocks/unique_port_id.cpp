@@ -46,6 +46,11 @@ UniquePortId::UniquePortId(InvalidPortId_t) noexcept
 {
 }
 
+UniquePortId::UniquePortId(const ThisType::value_type value, newtype::internal::ProtectedConstructor_t) noexcept
+    : ThisType(newtype::internal::ProtectedConstructor, value)
+{
+}
+
 bool UniquePortId::isValid() const noexcept
 {
     return UniquePortId(InvalidPortId) != *this;
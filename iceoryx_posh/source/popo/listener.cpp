@@ -16,6 +16,7 @@
 
 #include "iceoryx_posh/popo/listener.hpp"
 #include "iox/assertions.hpp"
+#include "iox/attributes.hpp"
 
 namespace iox
 {
@@ -26,11 +27,30 @@ Listener::Listener() noexcept
 {
 }
 
+Listener::Listener(const ListenerOptions& options) noexcept
+    : Listener(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable(), options)
+{
+}
+
 Listener::Listener(ConditionVariableData& conditionVariable) noexcept
+    : Listener(conditionVariable, ListenerOptions())
+{
+}
+
+Listener::Listener(ConditionVariableData& conditionVariable, const ListenerOptions& options) noexcept
     : m_conditionVariableData(&conditionVariable)
     , m_conditionListener(conditionVariable)
 {
-    m_thread = std::thread(&Listener::threadLoop, this);
+    m_conditionListener.setBusyPollBudget(options.busyPollBudget);
+    if (!options.workerThreads.empty())
+    {
+        m_workerPool.emplace(options.workerThreads, [this](auto index) { m_events[index]->executeCallback(); });
+    }
+    m_thread = std::thread([this, schedulingParameters = options.threadSchedulingParameters] {
+        // a failure is already logged and the Listener continues with the inherited scheduling
+        IOX_DISCARD_RESULT(setThreadSchedulingParameters(schedulingParameters));
+        threadLoop();
+    });
 }
 
 Listener::~Listener() noexcept
@@ -39,6 +59,7 @@ Listener::~Listener() noexcept
     m_conditionListener.destroy();
 
     m_thread.join();
+    m_workerPool.reset();
     m_conditionVariableData->m_toBeDestroyed.store(true, std::memory_order_relaxed);
 }
 
@@ -55,7 +76,14 @@ void Listener::threadLoop() noexcept
 
         for (auto& id : activateNotificationIds)
         {
-            m_events[id]->executeCallback();
+            if (m_workerPool)
+            {
+                m_workerPool->dispatch(id);
+            }
+            else
+            {
+                m_events[id]->executeCallback();
+            }
         }
     }
 }
@@ -0,0 +1,197 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/listener_worker_pool.hpp"
+#include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iox/assertions.hpp"
+#include "iox/logging.hpp"
+
+namespace iox
+{
+namespace popo
+{
+constexpr uint32_t ListenerWorkerPool::MAX_NUMBER_OF_EVENTS;
+constexpr uint32_t ListenerWorkerPool::MAX_NUMBER_OF_WORKERS;
+
+ListenerWorkerPool::ListenerWorkerPool(const vector<ListenerWorkerOptions, MAX_NUMBER_OF_WORKERS>& workerOptions,
+                                       const Execute_t& execute) noexcept
+    : m_execute(execute)
+    , m_numberOfWorkers(workerOptions.size())
+{
+    IOX_ENFORCE(!workerOptions.empty(), "The ListenerWorkerPool requires at least one worker");
+
+    for (auto& state : m_eventStates)
+    {
+        state.store(EventState::IDLE, std::memory_order_relaxed);
+    }
+
+    if (UnnamedSemaphoreBuilder().initialValue(0U).isInterProcessCapable(false).create(m_readyEvents).has_error())
+    {
+        IOX_REPORT_FATAL(PoshError::POPO__LISTENER_WORKER_POOL_SEMAPHORE_CORRUPTED);
+        return;
+    }
+
+    for (uint64_t i = 0U; i < m_numberOfWorkers; ++i)
+    {
+        ThreadName_t name = "Listener-W";
+        static_assert(MAX_NUMBER_OF_WORKERS <= 10U, "The worker index must be representable by a single digit");
+        name.append(TruncateToCapacity, static_cast<char>('0' + i));
+
+        const auto& options = workerOptions[i];
+        if (ThreadBuilder()
+                .name(name)
+                .cpuAffinityMask(options.cpuAffinityMask)
+                .scheduler(options.scheduler)
+                .priority(options.priority)
+                .create(m_workers[i], [this, i] { workerLoop(i); })
+                .has_error())
+        {
+            IOX_LOG(ERROR, "Unable to create the Listener worker thread '" << name << "'");
+            IOX_REPORT_FATAL(PoshError::POPO__LISTENER_UNABLE_TO_CREATE_WORKER_THREAD);
+        }
+    }
+}
+
+ListenerWorkerPool::~ListenerWorkerPool() noexcept
+{
+    m_keepRunning.store(false, std::memory_order_relaxed);
+    for (uint64_t i = 0U; i < m_numberOfWorkers; ++i)
+    {
+        if (m_readyEvents->post().has_error())
+        {
+            IOX_REPORT_FATAL(PoshError::POPO__LISTENER_WORKER_POOL_SEMAPHORE_CORRUPTED);
+        }
+    }
+
+    for (auto& worker : m_workers)
+    {
+        worker.reset();
+    }
+}
+
+uint64_t ListenerWorkerPool::numberOfWorkers() const noexcept
+{
+    return m_numberOfWorkers;
+}
+
+void ListenerWorkerPool::dispatch(const uint32_t index) noexcept
+{
+    IOX_ENFORCE(index < MAX_NUMBER_OF_EVENTS, "Event index out of bounds");
+
+    auto& state = m_eventStates[index];
+    auto currentState = state.load(std::memory_order_acquire);
+    while (true)
+    {
+        switch (currentState)
+        {
+        case EventState::IDLE:
+            if (state.compare_exchange_weak(
+                    currentState, EventState::QUEUED, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                enqueue(index);
+                return;
+            }
+            break;
+        case EventState::RUNNING:
+            if (state.compare_exchange_weak(currentState,
+                                            EventState::RUNNING_AND_DISPATCHED_AGAIN,
+                                            std::memory_order_acq_rel,
+                                            std::memory_order_acquire))
+            {
+                return;
+            }
+            break;
+        case EventState::QUEUED:
+            // the pending execution has not yet started and will observe the reason of this dispatch
+            [[fallthrough]];
+        case EventState::RUNNING_AND_DISPATCHED_AGAIN:
+            return;
+        }
+    }
+}
+
+void ListenerWorkerPool::enqueue(const uint32_t index) noexcept
+{
+    // every event is enqueued at most once at a time, therefore the queues can never be exhausted
+    const auto startQueue = m_nextReadyQueue.fetch_add(1U, std::memory_order_relaxed);
+    bool wasPushed = false;
+    for (uint64_t i = 0U; i < m_numberOfWorkers && !wasPushed; ++i)
+    {
+        wasPushed = m_readyQueues[(startQueue + i) % m_numberOfWorkers].tryPush(index);
+    }
+    IOX_ENFORCE(wasPushed, "Enqueuing a ready event into the Listener worker pool");
+
+    if (m_readyEvents->post().has_error())
+    {
+        IOX_REPORT_FATAL(PoshError::POPO__LISTENER_WORKER_POOL_SEMAPHORE_CORRUPTED);
+    }
+}
+
+uint32_t ListenerWorkerPool::takeReadyEvent(const uint64_t workerIndex) noexcept
+{
+    // the semaphore was decremented by this worker, hence there is at least one event which is not yet claimed by
+    // another worker; it is either in the own queue or has to be stolen from the queue of another worker
+    while (true)
+    {
+        for (uint64_t i = 0U; i < m_numberOfWorkers; ++i)
+        {
+            auto index = m_readyQueues[(workerIndex + i) % m_numberOfWorkers].pop();
+            if (index.has_value())
+            {
+                return index.value();
+            }
+        }
+    }
+}
+
+void ListenerWorkerPool::execute(const uint32_t index) noexcept
+{
+    auto& state = m_eventStates[index];
+    state.store(EventState::RUNNING, std::memory_order_release);
+
+    m_execute(index);
+
+    auto expectedState = EventState::RUNNING;
+    if (!state.compare_exchange_strong(
+            expectedState, EventState::IDLE, std::memory_order_acq_rel, std::memory_order_acquire))
+    {
+        // the event was dispatched again while its callback was running
+        state.store(EventState::QUEUED, std::memory_order_release);
+        enqueue(index);
+    }
+}
+
+void ListenerWorkerPool::workerLoop(const uint64_t workerIndex) noexcept
+{
+    while (true)
+    {
+        if (m_readyEvents->wait().has_error())
+        {
+            IOX_REPORT_FATAL(PoshError::POPO__LISTENER_WORKER_POOL_SEMAPHORE_CORRUPTED);
+            return;
+        }
+
+        if (!m_keepRunning.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        execute(takeReadyEvent(workerIndex));
+    }
+}
+
+} // namespace popo
+} // namespace iox
@@ -18,6 +18,7 @@
 #include "iceoryx_posh/internal/popo/ports/client_port_roudi.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iox/assertions.hpp"
+#include "iox/attributes.hpp"
 
 namespace iox
 {
@@ -125,18 +126,15 @@ ClientPortRouDi::handleCaProMessageForStateNotConnected(const capro::CaproMessag
     switch (caProMessage.m_type)
     {
     case capro::CaproMessageType::CONNECT:
-    {
         getMembers()->m_connectionState.store(ConnectionState::CONNECT_REQUESTED, std::memory_order_relaxed);
-
-        capro::CaproMessage caproMessage(capro::CaproMessageType::CONNECT,
-                                         BasePort::getMembers()->m_serviceDescription);
-        caproMessage.m_chunkQueueData = static_cast<void*>(&getMembers()->m_chunkReceiverData);
-        caproMessage.m_historyCapacity = 0;
-
-        return make_optional<capro::CaproMessage>(caproMessage);
-    }
+        return createConnectMessage();
     case capro::CaproMessageType::OFFER:
         return nullopt;
+    case capro::CaproMessageType::ACK:
+        [[fallthrough]];
+    case capro::CaproMessageType::NACK:
+        // further servers of the service respond to the DISCONNECT after the first response was already handled
+        return nullopt;
     default:
         // handle capro protocol violation outside of switch statement
         break;
@@ -152,12 +150,7 @@ ClientPortRouDi::handleCaProMessageForStateConnectRequested(const capro::CaproMe
     switch (caProMessage.m_type)
     {
     case capro::CaproMessageType::ACK:
-        IOX_ENFORCE(caProMessage.m_chunkQueueData != nullptr, "Invalid request queue passed to client");
-        m_chunkSender
-            .tryAddQueue(static_cast<ServerChunkQueueData_t*>(caProMessage.m_chunkQueueData),
-                         caProMessage.m_historyCapacity)
-            .expect("Adding server request queue to client");
-
+        addServerRequestQueue(caProMessage);
         getMembers()->m_connectionState.store(ConnectionState::CONNECTED, std::memory_order_relaxed);
         return nullopt;
     case capro::CaproMessageType::NACK:
@@ -178,19 +171,18 @@ ClientPortRouDi::handleCaProMessageForStateWaitForOffer(const capro::CaproMessag
     switch (caProMessage.m_type)
     {
     case capro::CaproMessageType::OFFER:
-    {
         getMembers()->m_connectionState.store(ConnectionState::CONNECT_REQUESTED, std::memory_order_relaxed);
-
-        capro::CaproMessage caproMessage(capro::CaproMessageType::CONNECT,
-                                         BasePort::getMembers()->m_serviceDescription);
-        caproMessage.m_chunkQueueData = static_cast<void*>(&getMembers()->m_chunkReceiverData);
-        caproMessage.m_historyCapacity = 0;
-
-        return make_optional<capro::CaproMessage>(caproMessage);
-    }
+        return createConnectMessage();
     case capro::CaproMessageType::DISCONNECT:
         getMembers()->m_connectionState.store(ConnectionState::NOT_CONNECTED, std::memory_order_relaxed);
         return nullopt;
+    case capro::CaproMessageType::ACK:
+        // a further server of the service accepted the CONNECT after a previous one rejected it
+        addServerRequestQueue(caProMessage);
+        getMembers()->m_connectionState.store(ConnectionState::CONNECTED, std::memory_order_relaxed);
+        return nullopt;
+    case capro::CaproMessageType::NACK:
+        return nullopt;
     default:
         // handle capro protocol violation outside of switch statement
         break;
@@ -206,8 +198,19 @@ ClientPortRouDi::handleCaProMessageForStateConnected(const capro::CaproMessage&
     switch (caProMessage.m_type)
     {
     case capro::CaproMessageType::STOP_OFFER:
-        getMembers()->m_connectionState.store(ConnectionState::WAIT_FOR_OFFER, std::memory_order_relaxed);
-        m_chunkSender.removeAllQueues();
+        removeServerRequestQueue(caProMessage);
+        if (!m_chunkSender.hasStoredQueues())
+        {
+            getMembers()->m_connectionState.store(ConnectionState::WAIT_FOR_OFFER, std::memory_order_relaxed);
+        }
+        return nullopt;
+    case capro::CaproMessageType::OFFER:
+        // a further server of the service is available; connect to it as well
+        return createConnectMessage();
+    case capro::CaproMessageType::ACK:
+        addServerRequestQueue(caProMessage);
+        return nullopt;
+    case capro::CaproMessageType::NACK:
         return nullopt;
     case capro::CaproMessageType::DISCONNECT:
     {
@@ -248,6 +251,42 @@ ClientPortRouDi::handleCaProMessageForStateDisconnectRequested(const capro::Capr
     return nullopt;
 }
 
+capro::CaproMessage ClientPortRouDi::createConnectMessage() noexcept
+{
+    capro::CaproMessage caproMessage(capro::CaproMessageType::CONNECT, BasePort::getMembers()->m_serviceDescription);
+    caproMessage.m_chunkQueueData = static_cast<void*>(&getMembers()->m_chunkReceiverData);
+    caproMessage.m_historyCapacity = 0;
+
+    return caproMessage;
+}
+
+void ClientPortRouDi::addServerRequestQueue(const capro::CaproMessage& caProMessage) noexcept
+{
+    IOX_ENFORCE(caProMessage.m_chunkQueueData != nullptr, "Invalid request queue passed to client");
+    m_chunkSender
+        .tryAddQueue(static_cast<ServerChunkQueueData_t*>(caProMessage.m_chunkQueueData),
+                     caProMessage.m_historyCapacity)
+        .or_else([this](auto&) {
+            IOX_LOG(WARN,
+                    "Client from runtime '" << BasePort::getMembers()->m_runtimeName
+                                            << "' cannot connect to more than " << MAX_SERVERS_PER_CLIENT
+                                            << " servers! The requests are distributed to the connected servers.");
+        });
+}
+
+void ClientPortRouDi::removeServerRequestQueue(const capro::CaproMessage& caProMessage) noexcept
+{
+    if (caProMessage.m_chunkQueueData == nullptr)
+    {
+        m_chunkSender.removeAllQueues();
+        return;
+    }
+
+    // the server might not be connected to this client, e.g. if the maximum number of servers was exceeded
+    IOX_DISCARD_RESULT(
+        m_chunkSender.tryRemoveQueue(static_cast<ServerChunkQueueData_t*>(caProMessage.m_chunkQueueData)));
+}
+
 void ClientPortRouDi::releaseAllChunks() noexcept
 {
     m_chunkSender.releaseAll();
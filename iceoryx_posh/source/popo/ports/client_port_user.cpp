@@ -85,8 +85,10 @@ expected<void, ClientSendError> ClientPortUser::sendRequest(RequestHeader* const
         return err(ClientSendError::NO_CONNECT_REQUESTED);
     }
 
-    auto numberOfReceiver = m_chunkSender.send(requestHeader->getChunkHeader());
-    if (numberOfReceiver == 0U)
+    // with multiple servers of the service, the request is sent to only one of them; the response is sent back by
+    // the selected server via the response queue of this client which is known to all servers
+    const auto routingKey = requestHeader->getRoutingKey();
+    if (!m_chunkSender.sendToOneQueue(requestHeader->getChunkHeader(), getMembers()->m_loadBalancingPolicy, routingKey))
     {
         IOX_LOG(WARN, "Try to send request but server is not available!");
         return err(ClientSendError::SERVER_NOT_AVAILABLE);
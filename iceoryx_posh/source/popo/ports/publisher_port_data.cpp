@@ -33,6 +33,7 @@ PublisherPortData::PublisherPortData(const capro::ServiceDescription& serviceDes
     , m_options{publisherOptions}
     , m_offeringRequested(publisherOptions.offerOnCreate)
 {
+    m_chunkSenderData.m_inlineUserPayload = publisherOptions.inlineUserPayload;
 }
 
 } // namespace popo
@@ -40,6 +40,8 @@ ServerPortData::ServerPortData(const capro::ServiceDescription& serviceDescripti
     , m_chunkReceiverData(
           getRequestQueueType(serverOptions.requestQueueFullPolicy), serverOptions.requestQueueFullPolicy, memoryInfo)
     , m_offeringRequested(serverOptions.offerOnCreate)
+    , m_concurrentRequestProcessing(serverOptions.concurrentRequestProcessing)
+    , m_allowMultipleServers(serverOptions.allowMultipleServers)
 {
     m_chunkReceiverData.m_queue.setCapacity(serverOptions.requestQueueCapacity);
 }
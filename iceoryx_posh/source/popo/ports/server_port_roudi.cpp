@@ -63,6 +63,8 @@ optional<capro::CaproMessage> ServerPortRouDi::tryGetCaProMessage() noexcept
         {
             capro::CaproMessage caproMessage(capro::CaproMessageType::STOP_OFFER, this->getCaProServiceDescription());
             caproMessage.m_serviceType = capro::CaproServiceType::SERVER;
+            // the clients need the request queue to disconnect from this server only when there are multiple servers
+            caproMessage.m_chunkQueueData = static_cast<void*>(&getMembers()->m_chunkReceiverData);
             return dispatchCaProMessageAndGetPossibleResponse(caproMessage);
         }
     }
@@ -29,6 +29,23 @@ ServerPortUser::ServerPortUser(MemberType_t& serverPortData) noexcept
 {
 }
 
+ServerPortUser::RequestProcessingGuard::RequestProcessingGuard(const MemberType_t& serverPortData) noexcept
+    : m_serverPortData(serverPortData)
+{
+    if (m_serverPortData.m_concurrentRequestProcessing)
+    {
+        m_serverPortData.m_requestProcessingLock.lock();
+    }
+}
+
+ServerPortUser::RequestProcessingGuard::~RequestProcessingGuard() noexcept
+{
+    if (m_serverPortData.m_concurrentRequestProcessing)
+    {
+        m_serverPortData.m_requestProcessingLock.unlock();
+    }
+}
+
 const ServerPortUser::MemberType_t* ServerPortUser::getMembers() const noexcept
 {
     return reinterpret_cast<const MemberType_t*>(BasePort::getMembers());
@@ -41,6 +58,8 @@ ServerPortUser::MemberType_t* ServerPortUser::getMembers() noexcept
 
 expected<const RequestHeader*, ServerRequestResult> ServerPortUser::getRequest() noexcept
 {
+    RequestProcessingGuard guard{*getMembers()};
+
     auto getChunkResult = m_chunkReceiver.tryGet();
 
     if (getChunkResult.has_error())
@@ -58,6 +77,8 @@ expected<const RequestHeader*, ServerRequestResult> ServerPortUser::getRequest()
 
 void ServerPortUser::releaseRequest(const RequestHeader* const requestHeader) noexcept
 {
+    RequestProcessingGuard guard{*getMembers()};
+
     if (requestHeader != nullptr)
     {
         m_chunkReceiver.release(requestHeader->getChunkHeader());
@@ -71,6 +92,8 @@ void ServerPortUser::releaseRequest(const RequestHeader* const requestHeader) no
 
 void ServerPortUser::releaseQueuedRequests() noexcept
 {
+    RequestProcessingGuard guard{*getMembers()};
+
     m_chunkReceiver.clear();
 }
 
@@ -89,6 +112,8 @@ ServerPortUser::allocateResponse(const RequestHeader* const requestHeader,
                                  const uint64_t userPayloadSize,
                                  const uint32_t userPayloadAlignment) noexcept
 {
+    RequestProcessingGuard guard{*getMembers()};
+
     if (requestHeader == nullptr)
     {
         return err(AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER);
@@ -112,6 +137,8 @@ ServerPortUser::allocateResponse(const RequestHeader* const requestHeader,
 
 void ServerPortUser::releaseResponse(const ResponseHeader* const responseHeader) noexcept
 {
+    RequestProcessingGuard guard{*getMembers()};
+
     if (responseHeader != nullptr)
     {
         m_chunkSender.release(responseHeader->getChunkHeader());
@@ -125,6 +152,8 @@ void ServerPortUser::releaseResponse(const ResponseHeader* const responseHeader)
 
 expected<void, ServerSendError> ServerPortUser::sendResponse(ResponseHeader* const responseHeader) noexcept
 {
+    RequestProcessingGuard guard{*getMembers()};
+
     if (responseHeader == nullptr)
     {
         IOX_LOG(ERROR, "Provided ResponseHeader is a nullptr");
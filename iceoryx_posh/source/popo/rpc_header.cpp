@@ -73,6 +73,16 @@ void RequestHeader::setSequenceId(const int64_t sequenceId) noexcept
     this->m_sequenceId = sequenceId;
 }
 
+void RequestHeader::setRoutingKey(const uint64_t routingKey) noexcept
+{
+    m_routingKey = routingKey;
+}
+
+uint64_t RequestHeader::getRoutingKey() const noexcept
+{
+    return m_routingKey;
+}
+
 RequestHeader* RequestHeader::fromPayload(void* const payload) noexcept
 {
     auto chunkHeader = mepoo::ChunkHeader::fromUserPayload(payload);
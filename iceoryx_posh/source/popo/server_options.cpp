@@ -27,7 +27,9 @@ Serialization ServerOptions::serialize() const noexcept
                                  nodeName,
                                  offerOnCreate,
                                  static_cast<std::underlying_type_t<QueueFullPolicy>>(requestQueueFullPolicy),
-                                 static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(clientTooSlowPolicy));
+                                 static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(clientTooSlowPolicy),
+                                 concurrentRequestProcessing,
+                                 allowMultipleServers);
 }
 
 expected<ServerOptions, Serialization::Error> ServerOptions::deserialize(const Serialization& serialized) noexcept
@@ -43,7 +45,9 @@ expected<ServerOptions, Serialization::Error> ServerOptions::deserialize(const S
                                                         serverOptions.nodeName,
                                                         serverOptions.offerOnCreate,
                                                         requestQueueFullPolicy,
-                                                        clientTooSlowPolicy);
+                                                        clientTooSlowPolicy,
+                                                        serverOptions.concurrentRequestProcessing,
+                                                        serverOptions.allowMultipleServers);
 
     if (!deserializationSuccessful
         || requestQueueFullPolicy > static_cast<QueueFullPolicyUT>(QueueFullPolicy::DISCARD_OLDEST_DATA)
@@ -62,7 +66,9 @@ bool ServerOptions::operator==(const ServerOptions& rhs) const noexcept
 {
     return requestQueueCapacity == rhs.requestQueueCapacity && nodeName == rhs.nodeName
            && offerOnCreate == rhs.offerOnCreate && requestQueueFullPolicy == rhs.requestQueueFullPolicy
-           && clientTooSlowPolicy == rhs.clientTooSlowPolicy;
+           && clientTooSlowPolicy == rhs.clientTooSlowPolicy
+           && concurrentRequestProcessing == rhs.concurrentRequestProcessing
+           && allowMultipleServers == rhs.allowMultipleServers;
 }
 } // namespace popo
 } // namespace iox
@@ -0,0 +1,51 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/introspection/fingerprint.hpp"
+
+#include <cstring>
+
+namespace iox
+{
+namespace roudi
+{
+Fingerprint& Fingerprint::add(const uint64_t value) noexcept
+{
+    constexpr uint64_t BITS_PER_BYTE{8U};
+    constexpr uint64_t BYTE_MASK{0xFFU};
+    for (uint64_t byte = 0U; byte < sizeof(value); ++byte)
+    {
+        m_value ^= (value >> (byte * BITS_PER_BYTE)) & BYTE_MASK;
+        m_value *= FNV_PRIME;
+    }
+    return *this;
+}
+
+Fingerprint& Fingerprint::add(const double value) noexcept
+{
+    static_assert(sizeof(double) == sizeof(uint64_t), "The bit pattern of a double must fit into an uint64_t");
+    uint64_t bits{0U};
+    std::memcpy(&bits, &value, sizeof(bits));
+    return add(bits);
+}
+
+uint64_t Fingerprint::value() const noexcept
+{
+    return m_value;
+}
+
+} // namespace roudi
+} // namespace iox
@@ -61,6 +61,10 @@ mepoo::MePooConfig DefaultRouDiMemory::introspectionMemPoolConfig(const uint32_t
     mempoolConfig.m_mempoolConfig.push_back(
         {align(static_cast<uint32_t>(sizeof(roudi::SubscriberPortChangingIntrospectionFieldTopic)), ALIGNMENT),
          chunkCount});
+    // the publisher of the deltas keeps its history in addition to the chunks in use
+    mempoolConfig.m_mempoolConfig.push_back(
+        {align(static_cast<uint32_t>(sizeof(roudi::PortIntrospectionDeltaTopic)), ALIGNMENT),
+         chunkCount + roudi::PORT_INTROSPECTION_DELTAS_PER_SNAPSHOT});
 
     mempoolConfig.optimize();
     return mempoolConfig;
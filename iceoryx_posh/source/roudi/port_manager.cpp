@@ -24,12 +24,45 @@
 #include "iox/logging.hpp"
 #include "iox/vector.hpp"
 
+#include <algorithm>
 #include <cstdint>
 
 namespace iox
 {
 namespace roudi
 {
+namespace
+{
+template <typename Batch>
+void sortByServiceDescription(Batch& batch) noexcept
+{
+    std::sort(batch.begin(), batch.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.portData->m_serviceDescription < rhs.portData->m_serviceDescription;
+    });
+}
+
+/// @brief calls the callable with each port destruction of a batch sorted by 'sortByServiceDescription' whose port
+/// has the provided service description and which emitted a CaPro message
+template <typename Batch, typename Callable>
+void forEachMessageForService(Batch& sortedBatch,
+                              const capro::ServiceDescription& service,
+                              const Callable& callable) noexcept
+{
+    auto destruction = std::lower_bound(
+        sortedBatch.begin(), sortedBatch.end(), service, [](const auto& portDestruction, const auto& value) {
+            return portDestruction.portData->m_serviceDescription < value;
+        });
+    for (; destruction != sortedBatch.end() && !(service < destruction->portData->m_serviceDescription);
+         ++destruction)
+    {
+        if (destruction->message.has_value())
+        {
+            callable(*destruction);
+        }
+    }
+}
+} // namespace
+
 capro::Interfaces StringToCaProInterface(const capro::IdString_t& str) noexcept
 {
     auto result = convert::from_string<int32_t>(str.c_str());
@@ -105,9 +138,16 @@ PortManager::PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept
     auto subscriberPortsData = acquireInternalPublisherPortData(
         IntrospectionSubscriberPortChangingDataService, options, introspectionMemoryManager);
 
+    // a new subscriber needs all deltas which were sent after the last port introspection topic
+    popo::PublisherOptions deltaOptions{options};
+    deltaOptions.historyCapacity = PORT_INTROSPECTION_DELTAS_PER_SNAPSHOT;
+    auto portDelta =
+        acquireInternalPublisherPortData(IntrospectionPortDeltaService, deltaOptions, introspectionMemoryManager);
+
     m_portIntrospection.registerPublisherPort(PublisherPortUserType(std::move(portGeneric)),
                                               PublisherPortUserType(std::move(portThroughput)),
-                                              PublisherPortUserType(std::move(subscriberPortsData)));
+                                              PublisherPortUserType(std::move(subscriberPortsData)),
+                                              PublisherPortUserType(std::move(portDelta)));
     m_portIntrospection.run();
 }
 
@@ -237,33 +277,68 @@ void PortManager::doDiscoveryForSubscriberPort(SubscriberPortType& subscriberPor
 }
 
 void PortManager::destroyClientPort(popo::ClientPortData* const clientPortData) noexcept
+{
+    ClientPortDestructionBatch batch;
+    prepareDestructionOfClientPort(clientPortData, batch);
+    destroyClientPorts(batch);
+}
+
+void PortManager::prepareDestructionOfClientPort(popo::ClientPortData* const clientPortData,
+                                                 ClientPortDestructionBatch& batch) noexcept
 {
     IOX_ENFORCE(clientPortData != nullptr, "clientPortData must not be a nullptr");
 
+    if (batch.size() == batch.capacity())
+    {
+        destroyClientPorts(batch);
+    }
+
     // create temporary client ports to orderly shut this client down
     popo::ClientPortRouDi clientPortRoudi(*clientPortData);
     popo::ClientPortUser clientPortUser(*clientPortData);
 
     clientPortUser.disconnect();
 
-    // process DISCONNECT for this client in RouDi and distribute it
-    clientPortRoudi.tryGetCaProMessage().and_then([this, &clientPortRoudi](auto caproMessage) {
+    // process DISCONNECT for this client in RouDi; it is distributed together with the whole batch
+    batch.push_back({clientPortData, nullopt});
+    clientPortRoudi.tryGetCaProMessage().and_then([&batch](auto caproMessage) {
         IOX_ENFORCE(caproMessage.m_type == capro::CaproMessageType::DISCONNECT, "Received wrong 'CaproMessageType'!");
 
         /// @todo iox-#1128 report to port introspection
-        this->sendToAllMatchingServerPorts(caproMessage, clientPortRoudi);
+        batch.back().message.emplace(caproMessage);
     });
+}
+
+void PortManager::destroyClientPorts(ClientPortDestructionBatch& batch) noexcept
+{
+    sortByServiceDescription(batch);
+
+    for (auto& serverPortData : m_portPool->getServerPortDataList())
+    {
+        popo::ServerPortRouDi serverPort(serverPortData);
+        forEachMessageForService(batch, serverPortData.m_serviceDescription, [&](auto& destruction) {
+            popo::ClientPortRouDi clientPortRoudi(*destruction.portData);
+            this->sendToServerPort(destruction.message.value(), clientPortRoudi, serverPort);
+        });
+    }
 
-    clientPortRoudi.releaseAllChunks();
+    for (auto& destruction : batch)
+    {
+        auto* clientPortData = destruction.portData;
+        popo::ClientPortRouDi clientPortRoudi(*clientPortData);
+        clientPortRoudi.releaseAllChunks();
 
-    /// @todo iox-#1128 remove from to port introspection
+        /// @todo iox-#1128 remove from to port introspection
 
-    IOX_LOG(DEBUG,
-            "Destroy client port from runtime '" << clientPortData->m_runtimeName << "' and with service description '"
-                                                 << clientPortData->m_serviceDescription << "'");
+        IOX_LOG(DEBUG,
+                "Destroy client port from runtime '" << clientPortData->m_runtimeName
+                                                     << "' and with service description '"
+                                                     << clientPortData->m_serviceDescription << "'");
 
-    // delete client port from list after DISCONNECT was processed
-    m_portPool->removeClientPort(clientPortData);
+        // delete client port from list after DISCONNECT was processed
+        m_portPool->removeClientPort(clientPortData);
+    }
+    batch.clear();
 }
 
 void PortManager::handleClientPorts() noexcept
@@ -331,37 +406,76 @@ void PortManager::makeAllServerPortsToStopOffer() noexcept
 }
 
 void PortManager::destroyServerPort(popo::ServerPortData* const serverPortData) noexcept
+{
+    ServerPortDestructionBatch batch;
+    prepareDestructionOfServerPort(serverPortData, batch);
+    destroyServerPorts(batch);
+}
+
+void PortManager::prepareDestructionOfServerPort(popo::ServerPortData* const serverPortData,
+                                                 ServerPortDestructionBatch& batch) noexcept
 {
     IOX_ENFORCE(serverPortData != nullptr, "serverPortData must not be a nullptr");
 
+    if (batch.size() == batch.capacity())
+    {
+        destroyServerPorts(batch);
+    }
+
     // create temporary server ports to orderly shut this server down
     popo::ServerPortRouDi serverPortRoudi{*serverPortData};
     popo::ServerPortUser serverPortUser{*serverPortData};
 
     serverPortUser.stopOffer();
 
-    // process STOP_OFFER for this server in RouDi and distribute it
-    serverPortRoudi.tryGetCaProMessage().and_then([this, &serverPortRoudi](auto caproMessage) {
+    // process STOP_OFFER for this server in RouDi; it is distributed together with the whole batch
+    batch.push_back({serverPortData, nullopt});
+    serverPortRoudi.tryGetCaProMessage().and_then([this, &batch](auto caproMessage) {
         IOX_ENFORCE(caproMessage.m_type == capro::CaproMessageType::STOP_OFFER, "Received wrong 'CaproMessageType'!");
         IOX_ENFORCE(caproMessage.m_serviceType == capro::CaproServiceType::SERVER,
                     "Received wrong 'CaproServiceType'!");
 
         /// @todo iox-#1128 report to port introspection
         this->removeServerFromServiceRegistry(caproMessage.m_serviceDescription);
-        this->sendToAllMatchingClientPorts(caproMessage, serverPortRoudi);
-        this->sendToAllMatchingInterfacePorts(caproMessage);
+        batch.back().message.emplace(caproMessage);
     });
+}
 
-    serverPortRoudi.releaseAllChunks();
+void PortManager::destroyServerPorts(ServerPortDestructionBatch& batch) noexcept
+{
+    sortByServiceDescription(batch);
 
-    /// @todo iox-#1128 remove from port introspection
+    for (auto& clientPortData : m_portPool->getClientPortDataList())
+    {
+        popo::ClientPortRouDi clientPort(clientPortData);
+        forEachMessageForService(batch, clientPortData.m_serviceDescription, [&](auto& destruction) {
+            popo::ServerPortRouDi serverPortRoudi(*destruction.portData);
+            this->sendToClientPort(destruction.message.value(), serverPortRoudi, clientPort);
+        });
+    }
 
-    IOX_LOG(DEBUG,
-            "Destroy server port from runtime '" << serverPortData->m_runtimeName << "' and with service description '"
-                                                 << serverPortData->m_serviceDescription << "'");
+    for (auto& destruction : batch)
+    {
+        auto* serverPortData = destruction.portData;
+        if (destruction.message.has_value())
+        {
+            sendToAllMatchingInterfacePorts(destruction.message.value());
+        }
+
+        popo::ServerPortRouDi serverPortRoudi{*serverPortData};
+        serverPortRoudi.releaseAllChunks();
+
+        /// @todo iox-#1128 remove from port introspection
 
-    // delete server port from list after STOP_OFFER was processed
-    m_portPool->removeServerPort(serverPortData);
+        IOX_LOG(DEBUG,
+                "Destroy server port from runtime '" << serverPortData->m_runtimeName
+                                                     << "' and with service description '"
+                                                     << serverPortData->m_serviceDescription << "'");
+
+        // delete server port from list after STOP_OFFER was processed
+        m_portPool->removeServerPort(serverPortData);
+    }
+    batch.clear();
 }
 
 void PortManager::handleServerPorts() noexcept
@@ -530,83 +644,101 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
     for (auto& publisherPortData : m_portPool->getPublisherPortDataList())
     {
         PublisherPortRouDiType publisherPort(&publisherPortData);
-
-        auto messageInterface = message.m_serviceDescription.getSourceInterface();
-        auto publisherInterface = publisherPort.getCaProServiceDescription().getSourceInterface();
-
-        // internal publisher receive all messages all other publishers receive only messages if
-        // they do not have the same interface otherwise we have cyclic connections in gateways
-        if (publisherInterface != capro::Interfaces::INTERNAL && publisherInterface == messageInterface)
+        if (sendToPublisherPort(message, subscriberSource, publisherPort))
         {
-            // iox-#1908
-            continue;
-        }
-
-        if (isCompatiblePubSub(publisherPort, subscriberSource))
-        {
-            auto publisherResponse = publisherPort.dispatchCaProMessageAndGetPossibleResponse(message);
-            if (publisherResponse.has_value())
-            {
-                // send response to subscriber port
-                subscriberSource.dispatchCaProMessageAndGetPossibleResponse(publisherResponse.value())
-                    .and_then([](auto& response) {
-                        IOX_LOG(FATAL, "Got response '" << response.m_type << "'");
-                        IOX_PANIC("Expected no response on ACK or NACK messages");
-                    });
-
-                m_portIntrospection.reportMessage(publisherResponse.value(), subscriberSource.getUniqueID());
-            }
             publisherFound = true;
         }
     }
     return publisherFound;
 }
 
+bool PortManager::sendToPublisherPort(const capro::CaproMessage& message,
+                                      SubscriberPortType& subscriberSource,
+                                      PublisherPortRouDiType& publisherPort) noexcept
+{
+    auto messageInterface = message.m_serviceDescription.getSourceInterface();
+    auto publisherInterface = publisherPort.getCaProServiceDescription().getSourceInterface();
+
+    // internal publisher receive all messages all other publishers receive only messages if
+    // they do not have the same interface otherwise we have cyclic connections in gateways
+    if (publisherInterface != capro::Interfaces::INTERNAL && publisherInterface == messageInterface)
+    {
+        // iox-#1908
+        return false;
+    }
+
+    if (!isCompatiblePubSub(publisherPort, subscriberSource))
+    {
+        return false;
+    }
+
+    auto publisherResponse = publisherPort.dispatchCaProMessageAndGetPossibleResponse(message);
+    if (publisherResponse.has_value())
+    {
+        // send response to subscriber port
+        subscriberSource.dispatchCaProMessageAndGetPossibleResponse(publisherResponse.value())
+            .and_then([](auto& response) {
+                IOX_LOG(FATAL, "Got response '" << response.m_type << "'");
+                IOX_PANIC("Expected no response on ACK or NACK messages");
+            });
+
+        m_portIntrospection.reportMessage(publisherResponse.value(), subscriberSource.getUniqueID());
+    }
+    return true;
+}
+
 void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& message,
                                                    PublisherPortRouDiType& publisherSource) noexcept
 {
     for (auto& subscriberPortData : m_portPool->getSubscriberPortDataList())
     {
         SubscriberPortType subscriberPort(&subscriberPortData);
+        sendToSubscriberPort(message, publisherSource, subscriberPort);
+    }
+}
 
-        auto messageInterface = message.m_serviceDescription.getSourceInterface();
-        auto subscriberInterface = subscriberPort.getCaProServiceDescription().getSourceInterface();
+void PortManager::sendToSubscriberPort(const capro::CaproMessage& message,
+                                       PublisherPortRouDiType& publisherSource,
+                                       SubscriberPortType& subscriberPort) noexcept
+{
+    auto messageInterface = message.m_serviceDescription.getSourceInterface();
+    auto subscriberInterface = subscriberPort.getCaProServiceDescription().getSourceInterface();
 
-        // internal subscriber receive all messages all other subscribers receive only messages if
-        // they do not have the same interface otherwise we have cyclic connections in gateways
-        if (subscriberInterface != capro::Interfaces::INTERNAL && subscriberInterface == messageInterface)
-        {
-            // iox-#1908
-            continue;
-        }
+    // internal subscriber receive all messages all other subscribers receive only messages if
+    // they do not have the same interface otherwise we have cyclic connections in gateways
+    if (subscriberInterface != capro::Interfaces::INTERNAL && subscriberInterface == messageInterface)
+    {
+        // iox-#1908
+        return;
+    }
 
-        if (isCompatiblePubSub(publisherSource, subscriberPort))
-        {
-            auto subscriberResponse = subscriberPort.dispatchCaProMessageAndGetPossibleResponse(message);
+    if (!isCompatiblePubSub(publisherSource, subscriberPort))
+    {
+        return;
+    }
 
-            // if the subscribers react on the change, process it immediately on publisher side
-            if (subscriberResponse.has_value())
-            {
-                // we only expect reaction on OFFER
-                IOX_ENFORCE(capro::CaproMessageType::OFFER == message.m_type, "Received wrong 'CaproMessageType'!");
+    auto subscriberResponse = subscriberPort.dispatchCaProMessageAndGetPossibleResponse(message);
 
-                // inform introspection
-                m_portIntrospection.reportMessage(subscriberResponse.value());
+    // if the subscribers react on the change, process it immediately on publisher side
+    if (subscriberResponse.has_value())
+    {
+        // we only expect reaction on OFFER
+        IOX_ENFORCE(capro::CaproMessageType::OFFER == message.m_type, "Received wrong 'CaproMessageType'!");
 
-                auto publisherResponse =
-                    publisherSource.dispatchCaProMessageAndGetPossibleResponse(subscriberResponse.value());
-                if (publisherResponse.has_value())
-                {
-                    // sende responsee to subscriber port
-                    subscriberPort.dispatchCaProMessageAndGetPossibleResponse(publisherResponse.value())
-                        .and_then([](auto& response) {
-                            IOX_LOG(FATAL, "Got response '" << response.m_type << "'");
-                            IOX_PANIC("Expected no response on ACK or NACK messages");
-                        });
-
-                    m_portIntrospection.reportMessage(publisherResponse.value());
-                }
-            }
+        // inform introspection
+        m_portIntrospection.reportMessage(subscriberResponse.value());
+
+        auto publisherResponse = publisherSource.dispatchCaProMessageAndGetPossibleResponse(subscriberResponse.value());
+        if (publisherResponse.has_value())
+        {
+            // sende responsee to subscriber port
+            subscriberPort.dispatchCaProMessageAndGetPossibleResponse(publisherResponse.value())
+                .and_then([](auto& response) {
+                    IOX_LOG(FATAL, "Got response '" << response.m_type << "'");
+                    IOX_PANIC("Expected no response on ACK or NACK messages");
+                });
+
+            m_portIntrospection.reportMessage(publisherResponse.value());
         }
     }
 }
@@ -634,34 +766,42 @@ void PortManager::sendToAllMatchingClientPorts(const capro::CaproMessage& messag
     for (auto& clientPortData : m_portPool->getClientPortDataList())
     {
         popo::ClientPortRouDi clientPort(clientPortData);
-        if (isCompatibleClientServer(serverSource, clientPort))
-        {
-            // send OFFER/STOP_OFFER to client
-            auto clientResponse = clientPort.dispatchCaProMessageAndGetPossibleResponse(message);
+        sendToClientPort(message, serverSource, clientPort);
+    }
+}
 
-            // if the clients react on the change, process it immediately on server side
-            if (clientResponse.has_value())
-            {
-                // we only expect reaction on CONNECT
-                IOX_ENFORCE(capro::CaproMessageType::CONNECT == clientResponse.value().m_type,
-                            "Received wrong 'CaproMessageType'!");
+void PortManager::sendToClientPort(const capro::CaproMessage& message,
+                                   popo::ServerPortRouDi& serverSource,
+                                   popo::ClientPortRouDi& clientPort) noexcept
+{
+    if (!isCompatibleClientServer(serverSource, clientPort))
+    {
+        return;
+    }
 
-                /// @todo iox-#518 inform port introspection about client
+    // send OFFER/STOP_OFFER to client
+    auto clientResponse = clientPort.dispatchCaProMessageAndGetPossibleResponse(message);
 
-                // send CONNECT to server
-                auto serverResponse = serverSource.dispatchCaProMessageAndGetPossibleResponse(clientResponse.value());
-                if (serverResponse.has_value())
-                {
-                    // send response to client port
-                    clientPort.dispatchCaProMessageAndGetPossibleResponse(serverResponse.value())
-                        .and_then([](auto& response) {
-                            IOX_LOG(FATAL, "Got response '" << response.m_type << "'");
-                            IOX_PANIC("Expected no response on ACK or NACK messages");
-                        });
-
-                    /// @todo iox-#1128 inform port introspection about server
-                }
-            }
+    // if the clients react on the change, process it immediately on server side
+    if (clientResponse.has_value())
+    {
+        // we only expect reaction on CONNECT
+        IOX_ENFORCE(capro::CaproMessageType::CONNECT == clientResponse.value().m_type,
+                    "Received wrong 'CaproMessageType'!");
+
+        /// @todo iox-#518 inform port introspection about client
+
+        // send CONNECT to server
+        auto serverResponse = serverSource.dispatchCaProMessageAndGetPossibleResponse(clientResponse.value());
+        if (serverResponse.has_value())
+        {
+            // send response to client port
+            clientPort.dispatchCaProMessageAndGetPossibleResponse(serverResponse.value()).and_then([](auto& response) {
+                IOX_LOG(FATAL, "Got response '" << response.m_type << "'");
+                IOX_PANIC("Expected no response on ACK or NACK messages");
+            });
+
+            /// @todo iox-#1128 inform port introspection about server
         }
     }
 }
@@ -673,29 +813,40 @@ bool PortManager::sendToAllMatchingServerPorts(const capro::CaproMessage& messag
     for (auto& serverPortData : m_portPool->getServerPortDataList())
     {
         popo::ServerPortRouDi serverPort(serverPortData);
-        if (isCompatibleClientServer(serverPort, clientSource))
+        if (sendToServerPort(message, clientSource, serverPort))
         {
-            // send CONNECT/DISCONNECT to server
-            auto serverResponse = serverPort.dispatchCaProMessageAndGetPossibleResponse(message);
-
-            // if the server react on the change, process it immediately on client side
-            if (serverResponse.has_value())
-            {
-                // send response to client port
-                clientSource.dispatchCaProMessageAndGetPossibleResponse(serverResponse.value())
-                    .and_then([](auto& response) {
-                        IOX_LOG(FATAL, "Got response '" << response.m_type << "'");
-                        IOX_PANIC("Expected no response on ACK or NACK messages");
-                    });
-
-                /// @todo iox-#1128 inform port introspection about client
-            }
             serverFound = true;
         }
     }
     return serverFound;
 }
 
+bool PortManager::sendToServerPort(const capro::CaproMessage& message,
+                                   popo::ClientPortRouDi& clientSource,
+                                   popo::ServerPortRouDi& serverPort) noexcept
+{
+    if (!isCompatibleClientServer(serverPort, clientSource))
+    {
+        return false;
+    }
+
+    // send CONNECT/DISCONNECT to server
+    auto serverResponse = serverPort.dispatchCaProMessageAndGetPossibleResponse(message);
+
+    // if the server react on the change, process it immediately on client side
+    if (serverResponse.has_value())
+    {
+        // send response to client port
+        clientSource.dispatchCaProMessageAndGetPossibleResponse(serverResponse.value()).and_then([](auto& response) {
+            IOX_LOG(FATAL, "Got response '" << response.m_type << "'");
+            IOX_PANIC("Expected no response on ACK or NACK messages");
+        });
+
+        /// @todo iox-#1128 inform port introspection about client
+    }
+    return true;
+}
+
 void PortManager::sendToAllMatchingInterfacePorts(const capro::CaproMessage& message) noexcept
 {
     for (auto& interfacePortData : m_portPool->getInterfacePortDataList())
@@ -712,25 +863,17 @@ void PortManager::sendToAllMatchingInterfacePorts(const capro::CaproMessage& mes
 
 void PortManager::unblockProcessShutdown(const RuntimeName_t& runtimeName) noexcept
 {
-    for (auto& port : m_portPool->getPublisherPortDataList())
-    {
-        PublisherPortRouDiType publisherPort(&port);
-        if (runtimeName == publisherPort.getRuntimeName())
-        {
-            port.m_offeringRequested.store(false, std::memory_order_relaxed);
-            doDiscoveryForPublisherPort(publisherPort);
-        }
-    }
+    m_portPool->forEachPublisherPortOf(runtimeName, [this](auto* port) {
+        port->m_offeringRequested.store(false, std::memory_order_relaxed);
+        PublisherPortRouDiType publisherPort(port);
+        this->doDiscoveryForPublisherPort(publisherPort);
+    });
 
-    for (auto& port : m_portPool->getServerPortDataList())
-    {
-        popo::ServerPortRouDi serverPort(port);
-        if (runtimeName == serverPort.getRuntimeName())
-        {
-            port.m_offeringRequested.store(false, std::memory_order_relaxed);
-            doDiscoveryForServerPort(serverPort);
-        }
-    }
+    m_portPool->forEachServerPortOf(runtimeName, [this](auto* port) {
+        port->m_offeringRequested.store(false, std::memory_order_relaxed);
+        popo::ServerPortRouDi serverPort(*port);
+        this->doDiscoveryForServerPort(serverPort);
+    });
 }
 
 void PortManager::unblockRouDiShutdown() noexcept
@@ -757,136 +900,178 @@ void PortManager::deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcep
     {
         m_serviceRegistryPublisherPortData.reset();
     }
-    auto& publisherPorts = m_portPool->getPublisherPortDataList();
-    auto publisherPort = publisherPorts.begin();
-    while (publisherPort != publisherPorts.end())
-    {
-        auto currentPort = publisherPort++;
-        PublisherPortRouDiType sender(currentPort.to_ptr());
-        if (runtimeName == sender.getRuntimeName())
-        {
-            destroyPublisherPort(currentPort.to_ptr());
-        }
-    }
 
-    auto& subscriberPorts = m_portPool->getSubscriberPortDataList();
-    auto subscriberPort = subscriberPorts.begin();
-    while (subscriberPort != subscriberPorts.end())
+    // the ports of the process are looked up with the per runtime index of the port pool and the resulting CaPro
+    // messages are distributed in batches, in order to not scan all peer ports for each port of the process
     {
-        auto currentPort = subscriberPort++;
-        SubscriberPortUserType subscriber(currentPort.to_ptr());
-        if (runtimeName == subscriber.getRuntimeName())
-        {
-            destroySubscriberPort(currentPort.to_ptr());
-        }
+        PublisherPortDestructionBatch batch;
+        m_portPool->forEachPublisherPortOf(
+            runtimeName, [&](auto* port) { this->prepareDestructionOfPublisherPort(port, batch); });
+        destroyPublisherPorts(batch);
     }
 
-    auto& serverPorts = m_portPool->getServerPortDataList();
-    auto serverPort = serverPorts.begin();
-    while (serverPort != serverPorts.end())
     {
-        auto currentPort = serverPort++;
-        popo::ServerPortRouDi server(*currentPort);
-        if (runtimeName == server.getRuntimeName())
-        {
-            destroyServerPort(currentPort.to_ptr());
-        }
+        SubscriberPortDestructionBatch batch;
+        m_portPool->forEachSubscriberPortOf(
+            runtimeName, [&](auto* port) { this->prepareDestructionOfSubscriberPort(port, batch); });
+        destroySubscriberPorts(batch);
     }
 
-    auto& clientPorts = m_portPool->getClientPortDataList();
-    auto clientPort = clientPorts.begin();
-    while (clientPort != clientPorts.end())
     {
-        auto currentPort = clientPort++;
-        popo::ClientPortRouDi client(*currentPort);
-        if (runtimeName == client.getRuntimeName())
-        {
-            destroyClientPort(currentPort.to_ptr());
-        }
+        ServerPortDestructionBatch batch;
+        m_portPool->forEachServerPortOf(runtimeName,
+                                        [&](auto* port) { this->prepareDestructionOfServerPort(port, batch); });
+        destroyServerPorts(batch);
     }
 
-    auto& interfacePorts = m_portPool->getInterfacePortDataList();
-    auto interfacePort = interfacePorts.begin();
-    while (interfacePort != interfacePorts.end())
     {
-        auto currentPort = interfacePort++;
-        popo::InterfacePort interface(currentPort.to_ptr());
-        if (runtimeName == interface.getRuntimeName())
-        {
-            IOX_LOG(DEBUG, "Deleted Interface of application " << runtimeName);
-            m_portPool->removeInterfacePort(currentPort.to_ptr());
-        }
+        ClientPortDestructionBatch batch;
+        m_portPool->forEachClientPortOf(runtimeName,
+                                        [&](auto* port) { this->prepareDestructionOfClientPort(port, batch); });
+        destroyClientPorts(batch);
     }
 
-    auto& condVars = m_portPool->getConditionVariableDataList();
-    auto condVar = condVars.begin();
-    while (condVar != condVars.end())
-    {
-        auto currentCondVar = condVar++;
-        if (runtimeName == currentCondVar->m_runtimeName)
-        {
-            IOX_LOG(DEBUG, "Deleted condition variable of application" << runtimeName);
-            m_portPool->removeConditionVariableData(currentCondVar.to_ptr());
-        }
-    }
+    m_portPool->forEachInterfacePortOf(runtimeName, [&](auto* port) {
+        IOX_LOG(DEBUG, "Deleted Interface of application " << runtimeName);
+        m_portPool->removeInterfacePort(port);
+    });
+
+    m_portPool->forEachConditionVariableDataOf(runtimeName, [&](auto* condVar) {
+        IOX_LOG(DEBUG, "Deleted condition variable of application" << runtimeName);
+        m_portPool->removeConditionVariableData(condVar);
+    });
 }
 
 void PortManager::destroyPublisherPort(PublisherPortRouDiType::MemberType_t* const publisherPortData) noexcept
 {
+    PublisherPortDestructionBatch batch;
+    prepareDestructionOfPublisherPort(publisherPortData, batch);
+    destroyPublisherPorts(batch);
+}
+
+void PortManager::prepareDestructionOfPublisherPort(PublisherPortRouDiType::MemberType_t* const publisherPortData,
+                                                    PublisherPortDestructionBatch& batch) noexcept
+{
+    if (batch.size() == batch.capacity())
+    {
+        destroyPublisherPorts(batch);
+    }
+
     // create temporary publisher ports to orderly shut this publisher down
     PublisherPortRouDiType publisherPortRoudi{publisherPortData};
     PublisherPortUserType publisherPortUser{publisherPortData};
 
     publisherPortUser.stopOffer();
 
-    // process STOP_OFFER for this publisher in RouDi and distribute it
-    publisherPortRoudi.tryGetCaProMessage().and_then([this, &publisherPortRoudi](auto caproMessage) {
+    // process STOP_OFFER for this publisher in RouDi; it is distributed together with the whole batch
+    batch.push_back({publisherPortData, nullopt});
+    publisherPortRoudi.tryGetCaProMessage().and_then([this, &batch](auto caproMessage) {
         IOX_ENFORCE(caproMessage.m_type == capro::CaproMessageType::STOP_OFFER, "Received wrong 'CaproMessageType'!");
 
         m_portIntrospection.reportMessage(caproMessage);
         this->removePublisherFromServiceRegistry(caproMessage.m_serviceDescription);
-        this->sendToAllMatchingSubscriberPorts(caproMessage, publisherPortRoudi);
-        this->sendToAllMatchingInterfacePorts(caproMessage);
+        batch.back().message.emplace(caproMessage);
     });
+}
+
+void PortManager::destroyPublisherPorts(PublisherPortDestructionBatch& batch) noexcept
+{
+    sortByServiceDescription(batch);
+
+    for (auto& subscriberPortData : m_portPool->getSubscriberPortDataList())
+    {
+        SubscriberPortType subscriberPort(&subscriberPortData);
+        forEachMessageForService(batch, subscriberPortData.m_serviceDescription, [&](auto& destruction) {
+            PublisherPortRouDiType publisherPortRoudi{destruction.portData};
+            this->sendToSubscriberPort(destruction.message.value(), publisherPortRoudi, subscriberPort);
+        });
+    }
+
+    for (auto& destruction : batch)
+    {
+        auto* publisherPortData = destruction.portData;
+        if (destruction.message.has_value())
+        {
+            sendToAllMatchingInterfacePorts(destruction.message.value());
+        }
 
-    publisherPortRoudi.releaseAllChunks();
+        PublisherPortRouDiType publisherPortRoudi{publisherPortData};
+        PublisherPortUserType publisherPortUser{publisherPortData};
+        publisherPortRoudi.releaseAllChunks();
 
-    m_portIntrospection.removePublisher(publisherPortUser);
+        m_portIntrospection.removePublisher(publisherPortUser);
 
-    IOX_LOG(DEBUG,
-            "Destroy publisher port from runtime '" << publisherPortData->m_runtimeName
-                                                    << "' and with service description '"
-                                                    << publisherPortData->m_serviceDescription << "'");
-    // delete publisher port from list after STOP_OFFER was processed
-    m_portPool->removePublisherPort(publisherPortData);
+        IOX_LOG(DEBUG,
+                "Destroy publisher port from runtime '" << publisherPortData->m_runtimeName
+                                                        << "' and with service description '"
+                                                        << publisherPortData->m_serviceDescription << "'");
+        // delete publisher port from list after STOP_OFFER was processed
+        m_portPool->removePublisherPort(publisherPortData);
+    }
+    batch.clear();
 }
 
 void PortManager::destroySubscriberPort(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept
 {
+    SubscriberPortDestructionBatch batch;
+    prepareDestructionOfSubscriberPort(subscriberPortData, batch);
+    destroySubscriberPorts(batch);
+}
+
+void PortManager::prepareDestructionOfSubscriberPort(SubscriberPortType::MemberType_t* const subscriberPortData,
+                                                     SubscriberPortDestructionBatch& batch) noexcept
+{
+    if (batch.size() == batch.capacity())
+    {
+        destroySubscriberPorts(batch);
+    }
+
     // create temporary subscriber ports to orderly shut this subscriber down
     SubscriberPortType subscriberPortRoudi(subscriberPortData);
     SubscriberPortUserType subscriberPortUser(subscriberPortData);
 
     subscriberPortUser.unsubscribe();
 
-    // process UNSUB for this subscriber in RouDi and distribute it
-    subscriberPortRoudi.tryGetCaProMessage().and_then([this, &subscriberPortRoudi](auto caproMessage) {
+    // process UNSUB for this subscriber in RouDi; it is distributed together with the whole batch
+    batch.push_back({subscriberPortData, nullopt});
+    subscriberPortRoudi.tryGetCaProMessage().and_then([this, &batch](auto caproMessage) {
         IOX_ENFORCE(caproMessage.m_type == capro::CaproMessageType::UNSUB, "Received wrong 'CaproMessageType'!");
 
         m_portIntrospection.reportMessage(caproMessage);
-        this->sendToAllMatchingPublisherPorts(caproMessage, subscriberPortRoudi);
+        batch.back().message.emplace(caproMessage);
     });
+}
 
-    subscriberPortRoudi.releaseAllChunks();
+void PortManager::destroySubscriberPorts(SubscriberPortDestructionBatch& batch) noexcept
+{
+    sortByServiceDescription(batch);
 
-    m_portIntrospection.removeSubscriber(subscriberPortUser);
+    for (auto& publisherPortData : m_portPool->getPublisherPortDataList())
+    {
+        PublisherPortRouDiType publisherPort(&publisherPortData);
+        forEachMessageForService(batch, publisherPortData.m_serviceDescription, [&](auto& destruction) {
+            SubscriberPortType subscriberPortRoudi(destruction.portData);
+            this->sendToPublisherPort(destruction.message.value(), subscriberPortRoudi, publisherPort);
+        });
+    }
 
-    IOX_LOG(DEBUG,
-            "Destroy subscriber port from runtime '" << subscriberPortData->m_runtimeName
-                                                     << "' and with service description '"
-                                                     << subscriberPortData->m_serviceDescription << "'");
-    // delete subscriber port from list after UNSUB was processed
-    m_portPool->removeSubscriberPort(subscriberPortData);
+    for (auto& destruction : batch)
+    {
+        auto* subscriberPortData = destruction.portData;
+        SubscriberPortType subscriberPortRoudi(subscriberPortData);
+        SubscriberPortUserType subscriberPortUser(subscriberPortData);
+        subscriberPortRoudi.releaseAllChunks();
+
+        m_portIntrospection.removeSubscriber(subscriberPortUser);
+
+        IOX_LOG(DEBUG,
+                "Destroy subscriber port from runtime '" << subscriberPortData->m_runtimeName
+                                                         << "' and with service description '"
+                                                         << subscriberPortData->m_serviceDescription << "'");
+        // delete subscriber port from list after UNSUB was processed
+        m_portPool->removeSubscriberPort(subscriberPortData);
+    }
+    batch.clear();
 }
 
 expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
@@ -1034,7 +1219,7 @@ PortManager::acquireServerPortData(const capro::ServiceDescription& service,
                                    mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
                                    const PortConfigInfo& portConfigInfo) noexcept
 {
-    // it is not allowed to have two servers with the same ServiceDescription;
+    // it is not allowed to have two servers with the same ServiceDescription unless all of them allow multiple servers;
     // check if the server is already in the list
     auto& serverPorts = m_portPool->getServerPortDataList();
     auto port = serverPorts.begin();
@@ -1049,6 +1234,10 @@ PortManager::acquireServerPortData(const capro::ServiceDescription& service,
                 destroyServerPort(currentPort.to_ptr());
                 continue;
             }
+            if (serverOptions.allowMultipleServers && currentPort->m_allowMultipleServers)
+            {
+                continue;
+            }
             IOX_LOG(WARN,
                     "Process '"
                         << runtimeName
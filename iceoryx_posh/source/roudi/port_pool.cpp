@@ -18,6 +18,7 @@
 #include "iceoryx_posh/roudi/port_pool.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iceoryx_posh/internal/roudi/port_pool_data.hpp"
+#include "iox/assertions.hpp"
 
 namespace iox
 {
@@ -49,6 +50,7 @@ expected<popo::InterfacePortData*, PortPoolError> PortPool::addInterfacePort(con
         IOX_REPORT(PoshError::PORT_POOL__INTERFACELIST_OVERFLOW, iox::er::RUNTIME_ERROR);
         return err(PortPoolError::INTERFACE_PORT_LIST_FULL);
     }
+    IOX_ENFORCE(m_interfacePortIndex.add(interfacePortData.to_ptr()), "Runtime port index overflow");
     return ok(interfacePortData.to_ptr());
 }
 
@@ -62,16 +64,19 @@ PortPool::addConditionVariableData(const RuntimeName_t& runtimeName) noexcept
         IOX_REPORT(PoshError::PORT_POOL__CONDITION_VARIABLE_LIST_OVERFLOW, iox::er::RUNTIME_ERROR);
         return err(PortPoolError::CONDITION_VARIABLE_LIST_FULL);
     }
+    IOX_ENFORCE(m_conditionVariableIndex.add(conditionVariableData.to_ptr()), "Runtime port index overflow");
     return ok(conditionVariableData.to_ptr());
 }
 
 void PortPool::removeInterfacePort(const popo::InterfacePortData* const portData) noexcept
 {
+    m_interfacePortIndex.remove(portData);
     m_portPoolData->m_interfacePortMembers.erase(portData);
 }
 
 void PortPool::removeConditionVariableData(const popo::ConditionVariableData* const conditionVariableData) noexcept
 {
+    m_conditionVariableIndex.remove(conditionVariableData);
     m_portPoolData->m_conditionVariableMembers.erase(conditionVariableData);
 }
 
@@ -102,6 +107,7 @@ PortPool::addPublisherPort(const capro::ServiceDescription& serviceDescription,
         IOX_REPORT(PoshError::PORT_POOL__PUBLISHERLIST_OVERFLOW, iox::er::RUNTIME_ERROR);
         return err(PortPoolError::PUBLISHER_PORT_LIST_FULL);
     }
+    IOX_ENFORCE(m_publisherPortIndex.add(publisherPortData.to_ptr()), "Runtime port index overflow");
     return ok(publisherPortData.to_ptr());
 }
 
@@ -121,6 +127,7 @@ PortPool::addSubscriberPort(const capro::ServiceDescription& serviceDescription,
         IOX_REPORT(PoshError::PORT_POOL__SUBSCRIBERLIST_OVERFLOW, iox::er::RUNTIME_ERROR);
         return err(PortPoolError::SUBSCRIBER_PORT_LIST_FULL);
     }
+    IOX_ENFORCE(m_subscriberPortIndex.add(subscriberPortData), "Runtime port index overflow");
     return ok(subscriberPortData);
 }
 
@@ -151,6 +158,7 @@ PortPool::addClientPort(const capro::ServiceDescription& serviceDescription,
         IOX_REPORT(PoshError::PORT_POOL__CLIENTLIST_OVERFLOW, iox::er::RUNTIME_ERROR);
         return err(PortPoolError::CLIENT_PORT_LIST_FULL);
     }
+    IOX_ENFORCE(m_clientPortIndex.add(clientPortData.to_ptr()), "Runtime port index overflow");
     return ok(clientPortData.to_ptr());
 }
 
@@ -171,25 +179,31 @@ PortPool::addServerPort(const capro::ServiceDescription& serviceDescription,
         IOX_REPORT(PoshError::PORT_POOL__SERVERLIST_OVERFLOW, iox::er::RUNTIME_ERROR);
         return err(PortPoolError::SERVER_PORT_LIST_FULL);
     }
+    IOX_ENFORCE(m_serverPortIndex.add(serverPortData.to_ptr()), "Runtime port index overflow");
     return ok(serverPortData.to_ptr());
 }
 
 void PortPool::removePublisherPort(const PublisherPortRouDiType::MemberType_t* const portData) noexcept
 {
+    m_publisherPortIndex.remove(portData);
     m_portPoolData->m_publisherPortMembers.erase(portData);
 }
 
 void PortPool::removeSubscriberPort(const SubscriberPortType::MemberType_t* const portData) noexcept
 {
+    m_subscriberPortIndex.remove(portData);
     m_portPoolData->m_subscriberPortMembers.erase(portData);
 }
 
 void PortPool::removeClientPort(const popo::ClientPortData* const portData) noexcept
 {
+    m_clientPortIndex.remove(portData);
     m_portPoolData->m_clientPortMembers.erase(portData);
 }
+
 void PortPool::removeServerPort(const popo::ServerPortData* const portData) noexcept
 {
+    m_serverPortIndex.remove(portData);
     m_portPoolData->m_serverPortMembers.erase(portData);
 }
 
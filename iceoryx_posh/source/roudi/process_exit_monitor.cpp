@@ -0,0 +1,190 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/process_exit_monitor.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iox/attributes.hpp"
+#include "iox/logging.hpp"
+#include "iox/posix_call.hpp"
+
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/syscall.h>
+#endif
+
+#if defined(__linux__) && defined(SYS_pidfd_open)
+#define IOX_PROCESS_EXIT_MONITOR_WITH_PIDFD
+#endif
+
+namespace iox
+{
+namespace roudi
+{
+#if defined(IOX_PROCESS_EXIT_MONITOR_WITH_PIDFD)
+namespace
+{
+int32_t openPidFd(const uint32_t pid) noexcept
+{
+    // there is no glibc wrapper for pidfd_open before glibc 2.36
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg) the syscall interface is variadic
+    return static_cast<int32_t>(syscall(SYS_pidfd_open, static_cast<pid_t>(pid), 0U));
+}
+} // namespace
+
+ProcessExitMonitor::ProcessExitMonitor() noexcept
+{
+    // probe with the own process whether the kernel supports pidfd_open
+    const auto ownPidFd = openPidFd(static_cast<uint32_t>(getpid()));
+    if (ownPidFd == INVALID_FD)
+    {
+        IOX_LOG(DEBUG, "Process file descriptors are not supported by the kernel");
+        return;
+    }
+    IOX_DISCARD_RESULT(IOX_POSIX_CALL(iox_close)(ownPidFd).failureReturnValue(-1).evaluate());
+
+    IOX_POSIX_CALL(epoll_create1)
+    (EPOLL_CLOEXEC)
+        .failureReturnValue(INVALID_FD)
+        .evaluate()
+        .and_then([this](auto& r) { m_epollFd = r.value; })
+        .or_else([](auto& r) {
+            IOX_LOG(ERROR, "Unable to create the epoll instance: " << r.getHumanReadableErrnum());
+        });
+}
+
+ProcessExitMonitor::~ProcessExitMonitor() noexcept
+{
+    while (!m_monitoredProcesses.empty())
+    {
+        remove(m_monitoredProcesses.back().pid);
+    }
+
+    if (m_epollFd != INVALID_FD)
+    {
+        IOX_DISCARD_RESULT(IOX_POSIX_CALL(iox_close)(m_epollFd).failureReturnValue(-1).evaluate());
+    }
+}
+
+bool ProcessExitMonitor::isAvailable() const noexcept
+{
+    return m_epollFd != INVALID_FD;
+}
+
+bool ProcessExitMonitor::add(const uint32_t pid) noexcept
+{
+    if (!isAvailable() || m_monitoredProcesses.size() == m_monitoredProcesses.capacity())
+    {
+        return false;
+    }
+
+    const auto pidFd = openPidFd(pid);
+    if (pidFd == INVALID_FD)
+    {
+        IOX_LOG(WARN, "Unable to acquire a process file descriptor for the process with the pid " << pid);
+        return false;
+    }
+
+    // one shot, since a terminated process stays readable until it is removed by the process manager
+    epoll_event event{};
+    event.events = EPOLLIN | EPOLLONESHOT;
+    event.data.u64 = pid;
+    if (IOX_POSIX_CALL(epoll_ctl)(m_epollFd, EPOLL_CTL_ADD, pidFd, &event)
+            .failureReturnValue(-1)
+            .evaluate()
+            .has_error())
+    {
+        IOX_LOG(WARN, "Unable to monitor the process file descriptor of the process with the pid " << pid);
+        IOX_DISCARD_RESULT(IOX_POSIX_CALL(iox_close)(pidFd).failureReturnValue(-1).evaluate());
+        return false;
+    }
+
+    m_monitoredProcesses.emplace_back(MonitoredProcess{pid, pidFd});
+    return true;
+}
+
+void ProcessExitMonitor::remove(const uint32_t pid) noexcept
+{
+    for (auto iter = m_monitoredProcesses.begin(); iter != m_monitoredProcesses.end(); ++iter)
+    {
+        if (iter->pid == pid)
+        {
+            // closing the file descriptor removes it from the epoll instance
+            IOX_DISCARD_RESULT(IOX_POSIX_CALL(iox_close)(iter->pidFd).failureReturnValue(-1).evaluate());
+            m_monitoredProcesses.erase(iter);
+            return;
+        }
+    }
+}
+
+ProcessExitMonitor::TerminatedProcesses_t
+ProcessExitMonitor::waitForTerminatedProcesses(const units::Duration timeout) noexcept
+{
+    TerminatedProcesses_t terminatedProcesses;
+    if (!isAvailable())
+    {
+        return terminatedProcesses;
+    }
+
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) required by epoll_wait
+    epoll_event events[MAX_TERMINATED_PROCESSES_PER_WAIT];
+    IOX_POSIX_CALL(epoll_wait)
+    (m_epollFd,
+     &events[0],
+     static_cast<int>(MAX_TERMINATED_PROCESSES_PER_WAIT),
+     static_cast<int>(timeout.toMilliseconds()))
+        .failureReturnValue(-1)
+        .ignoreErrnos(EINTR)
+        .evaluate()
+        .and_then([&](auto& r) {
+            for (int i = 0; i < r.value; ++i)
+            {
+                terminatedProcesses.emplace_back(static_cast<uint32_t>(events[i].data.u64));
+            }
+        })
+        .or_else([](auto& r) {
+            IOX_LOG(ERROR, "Unable to wait for terminated processes: " << r.getHumanReadableErrnum());
+        });
+
+    return terminatedProcesses;
+}
+#else
+ProcessExitMonitor::ProcessExitMonitor() noexcept = default;
+
+ProcessExitMonitor::~ProcessExitMonitor() noexcept = default;
+
+bool ProcessExitMonitor::isAvailable() const noexcept
+{
+    return false;
+}
+
+bool ProcessExitMonitor::add(const uint32_t) noexcept
+{
+    return false;
+}
+
+void ProcessExitMonitor::remove(const uint32_t) noexcept
+{
+}
+
+ProcessExitMonitor::TerminatedProcesses_t
+ProcessExitMonitor::waitForTerminatedProcesses(const units::Duration) noexcept
+{
+    return TerminatedProcesses_t();
+}
+#endif
+
+} // namespace roudi
+} // namespace iox
@@ -303,6 +303,11 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
         auto heartbeat = m_heartbeatPool->emplace();
         heartbeatPoolIndex = heartbeat.to_index();
         heartbeatOffset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, heartbeat.to_ptr());
+
+        if (m_processExitMonitor != nullptr && !m_processExitMonitor->add(pid))
+        {
+            IOX_LOG(WARN, "Falling back to heartbeat monitoring for application '" << name << "'");
+        }
     }
     m_processList.emplace_back(name, m_domainId, pid, user, heartbeatPoolIndex, sessionId);
 
@@ -358,6 +363,10 @@ bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(Process
 {
     if (processIter != m_processList.end())
     {
+        if (m_processExitMonitor != nullptr)
+        {
+            m_processExitMonitor->remove(processIter->getPid());
+        }
         m_portManager.deletePortsOfProcess(processIter->getName());
         m_processIntrospection->removeProcess(static_cast<int32_t>(processIter->getPid()));
 
@@ -676,6 +685,11 @@ void ProcessManager::initIntrospection(ProcessIntrospectionType* processIntrospe
     m_processIntrospection = processIntrospection;
 }
 
+void ProcessManager::initProcessExitMonitor(ProcessExitMonitor* processExitMonitor) noexcept
+{
+    m_processExitMonitor = processExitMonitor;
+}
+
 void ProcessManager::run() noexcept
 {
     monitorProcesses();
@@ -704,6 +718,28 @@ optional<Process*> ProcessManager::findProcess(const RuntimeName_t& name) noexce
     return nullopt;
 }
 
+void ProcessManager::handleTerminatedProcess(const uint32_t pid) noexcept
+{
+    auto processIterator = m_processList.begin();
+    while (processIterator != m_processList.end())
+    {
+        if (processIterator->getPid() == pid)
+        {
+            IOX_LOG(WARN, "Application " << processIterator->getName() << " terminated --> removing it");
+            IOX_DISCARD_RESULT(removeProcessAndDeleteRespectiveSharedMemoryObjects(
+                processIterator, TerminationFeedback::DO_NOT_SEND_ACK_TO_PROCESS));
+            return;
+        }
+        ++processIterator;
+    }
+
+    // the process has already been removed, e.g. since it unregistered before it terminated
+    if (m_processExitMonitor != nullptr)
+    {
+        m_processExitMonitor->remove(pid);
+    }
+}
+
 void ProcessManager::monitorProcesses() noexcept
 {
     static_assert(runtime::PROCESS_KEEP_ALIVE_TIMEOUT > runtime::PROCESS_KEEP_ALIVE_INTERVAL,
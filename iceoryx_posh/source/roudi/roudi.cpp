@@ -21,17 +21,40 @@
 #include "iceoryx_posh/popo/wait_set.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iceoryx_platform/mman.hpp"
+#include "iox/attributes.hpp"
 #include "iox/detail/convert.hpp"
 #include "iox/detail/system_configuration.hpp"
 #include "iox/logging.hpp"
+#include "iox/posix_call.hpp"
 #include "iox/posix_user.hpp"
 #include "iox/std_string_support.hpp"
 #include "iox/thread.hpp"
+#include "iox/timer_service.hpp"
 
 namespace iox
 {
 namespace roudi
 {
+namespace
+{
+void lockProcessMemory() noexcept
+{
+#if defined(__linux__)
+    IOX_POSIX_CALL(mlockall)
+    (MCL_CURRENT | MCL_FUTURE)
+        .failureReturnValue(-1)
+        .evaluate()
+        .and_then([](auto&) { IOX_LOG(INFO, "The memory of RouDi is locked into RAM"); })
+        .or_else([](auto& r) {
+            IOX_LOG(ERROR, "Unable to lock the memory of RouDi into RAM: " << r.getHumanReadableErrnum());
+        });
+#else
+    IOX_LOG(WARN, "Locking the memory into RAM is not supported on this platform");
+#endif
+}
+} // namespace
+
 RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
              PortManager& portManager,
              const config::RouDiConfig& roudiConfig) noexcept
@@ -54,6 +77,13 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
     {
         IOX_LOG(WARN, "Runnning RouDi on 32-bit architectures is not supported! Use at your own risk!");
     }
+
+    if (m_roudiConfig.lockMemory)
+    {
+        lockProcessMemory();
+    }
+    concurrent::TimerService::getInstance().setThreadSchedulingParameters(m_roudiConfig.timerServiceThread);
+
     m_processIntrospection.registerPublisherPort(
         PublisherPortUserType(m_prcMgr->addIntrospectionPublisherPort(IntrospectionProcessService)));
     m_prcMgr->initIntrospection(&m_processIntrospection);
@@ -70,6 +100,20 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
         .create(m_discoveryFinishedSemaphore)
         .expect("Valid Semaphore");
 
+    if (m_roudiConfig.monitoringMode == roudi::MonitoringMode::PIDFD
+        && !m_roudiConfig.sharesAddressSpaceWithApplications)
+    {
+        if (m_processExitMonitor.isAvailable())
+        {
+            m_prcMgr->initProcessExitMonitor(&m_processExitMonitor);
+            m_processExitMonitoringThread = std::thread(&RouDi::monitorProcessExits, this);
+        }
+        else
+        {
+            IOX_LOG(WARN, "Process file descriptors are not available! Falling back to heartbeat monitoring.");
+        }
+    }
+
     // run the threads
     m_monitoringAndDiscoveryThread = std::thread(&RouDi::monitorAndDiscoveryUpdate, this);
 
@@ -111,6 +155,13 @@ void RouDi::shutdown() noexcept
         IOX_LOG(DEBUG, "...'Mon+Discover' thread joined.");
     }
 
+    if (m_processExitMonitoringThread.joinable())
+    {
+        IOX_LOG(DEBUG, "Joining 'ProcExitMon' thread...");
+        m_processExitMonitoringThread.join();
+        IOX_LOG(DEBUG, "...'ProcExitMon' thread joined.");
+    }
+
     if (!m_roudiConfig.sharesAddressSpaceWithApplications)
     {
         deadline_timer terminationDelayTimer(m_roudiConfig.processTerminationDelay);
@@ -201,6 +252,8 @@ void RouDi::triggerDiscoveryLoopAndWaitToFinish(units::Duration timeout) noexcep
 void RouDi::monitorAndDiscoveryUpdate() noexcept
 {
     setThreadName("Mon+Discover");
+    // a failure is already logged and the thread continues with the inherited scheduling
+    IOX_DISCARD_RESULT(setThreadSchedulingParameters(m_roudiConfig.monitoringAndDiscoveryThread));
 
     class DiscoveryWaitSet : public popo::WaitSet<1>
     {
@@ -243,11 +296,28 @@ void RouDi::monitorAndDiscoveryUpdate() noexcept
     }
 }
 
+void RouDi::monitorProcessExits() noexcept
+{
+    setThreadName("ProcExitMon");
+    // a failure is already logged and the thread continues with the inherited scheduling
+    IOX_DISCARD_RESULT(setThreadSchedulingParameters(m_roudiConfig.processExitMonitorThread));
+
+    while (m_runMonitoringAndDiscoveryThread)
+    {
+        for (const auto pid : m_processExitMonitor.waitForTerminatedProcesses(DISCOVERY_INTERVAL))
+        {
+            m_prcMgr->handleTerminatedProcess(pid);
+        }
+    }
+}
+
 void RouDi::processRuntimeMessages(runtime::IpcInterfaceCreator&& roudiIpcInterface) noexcept
 {
     auto roudiIpc = std::move(roudiIpcInterface);
 
     setThreadName("IPC-msg-process");
+    // a failure is already logged and the thread continues with the inherited scheduling
+    IOX_DISCARD_RESULT(setThreadSchedulingParameters(m_roudiConfig.runtimeMessagesThread));
 
     IOX_LOG(INFO, "RouDi is ready for clients");
     fflush(stdout); // explicitly flush 'stdout' for 'launch_testing'
@@ -560,7 +630,8 @@ void RouDi::registerProcess(const RuntimeName_t& name,
                             const uint64_t sessionId,
                             const version::VersionInfo& versionInfo) noexcept
 {
-    bool monitorProcess = (m_roudiConfig.monitoringMode == roudi::MonitoringMode::ON
+    bool monitorProcess = ((m_roudiConfig.monitoringMode == roudi::MonitoringMode::ON
+                            || m_roudiConfig.monitoringMode == roudi::MonitoringMode::PIDFD)
                            && !m_roudiConfig.sharesAddressSpaceWithApplications);
     IOX_DISCARD_RESULT(
         m_prcMgr->registerProcess(name, pid, user, monitorProcess, transmissionTimestamp, sessionId, versionInfo));
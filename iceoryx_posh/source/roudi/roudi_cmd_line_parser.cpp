@@ -60,10 +60,12 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
             std::cout << "-u, --unique-roudi-id <UINT>      Set the unique RouDi ID." << std::endl;
             std::cout << "                                  <UINT> 0..65535" << std::endl;
             std::cout << "-m, --monitoring-mode <MODE>      Set process alive monitoring mode." << std::endl;
-            std::cout << "                                  <MODE> {on, off}" << std::endl;
+            std::cout << "                                  <MODE> {on, off, pidfd}" << std::endl;
             std::cout << "                                  default = 'off'" << std::endl;
             std::cout << "                                  on: enables monitoring for all processes" << std::endl;
             std::cout << "                                  off: disables monitoring for all processes" << std::endl;
+            std::cout << "                                  pidfd: like 'on' but detects terminated" << std::endl;
+            std::cout << "                                  processes immediately (Linux only)" << std::endl;
             std::cout << "-l, --log-level <LEVEL>           Set log level." << std::endl;
             std::cout << "                                  <LEVEL> {off, fatal, error, warning, info," << std::endl;
             std::cout << "                                  debug, trace}" << std::endl;
@@ -147,9 +149,13 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
             {
                 m_cmdLineArgs.roudiConfig.monitoringMode = roudi::MonitoringMode::OFF;
             }
+            else if (strcmp(optarg, "pidfd") == 0)
+            {
+                m_cmdLineArgs.roudiConfig.monitoringMode = roudi::MonitoringMode::PIDFD;
+            }
             else
             {
-                IOX_LOG(ERROR, "Options for monitoring-mode are 'on' and 'off'!");
+                IOX_LOG(ERROR, "Options for monitoring-mode are 'on', 'off' and 'pidfd'!");
                 return err(CmdLineParserResult::INVALID_PARAMETER);
             }
             break;
@@ -30,11 +30,82 @@
 #include <fstream>
 #include <limits> // workaround for missing include in cpptoml.h
 #include <string>
+#include <utility>
 
 namespace iox
 {
 namespace config
 {
+namespace
+{
+constexpr uint64_t MAX_NUMBER_OF_CPU_CORES{64U};
+
+iox::expected<void, iox::roudi::RouDiConfigFileParseError>
+parseThreadSchedulingParameters(const cpptoml::table& threads,
+                                const std::string& threadName,
+                                ThreadSchedulingParameters& parameters) noexcept
+{
+    auto thread = threads.get_table(threadName);
+    if (!thread)
+    {
+        return iox::ok();
+    }
+
+    auto cpuCores = thread->get_array_of<int64_t>("cpu_affinity");
+    if (cpuCores)
+    {
+        for (const auto cpuCore : *cpuCores)
+        {
+            if (cpuCore < 0 || static_cast<uint64_t>(cpuCore) >= MAX_NUMBER_OF_CPU_CORES)
+            {
+                IOX_LOG(ERROR,
+                        "The CPU core " << cpuCore << " of the thread '" << threadName << "' must be in the range of [0, "
+                                        << MAX_NUMBER_OF_CPU_CORES << "[");
+                return iox::err(iox::roudi::RouDiConfigFileParseError::INVALID_THREAD_CPU_AFFINITY);
+            }
+            parameters.cpuAffinityMask |= static_cast<uint64_t>(1U) << static_cast<uint64_t>(cpuCore);
+        }
+    }
+
+    auto scheduler = thread->get_as<std::string>("scheduler");
+    if (scheduler)
+    {
+        if (*scheduler == "fifo")
+        {
+            parameters.scheduler = iox::detail::Scheduler::FIFO;
+        }
+        else if (*scheduler == "rr")
+        {
+            parameters.scheduler = iox::detail::Scheduler::RR;
+        }
+        else
+        {
+            IOX_LOG(ERROR,
+                    "The scheduler '" << *scheduler << "' of the thread '" << threadName
+                                      << "' is invalid; valid are 'fifo' and 'rr'");
+            return iox::err(iox::roudi::RouDiConfigFileParseError::INVALID_THREAD_SCHEDULER);
+        }
+    }
+
+    auto priority = thread->get_as<int32_t>("priority");
+    if (priority)
+    {
+        if (!parameters.scheduler.has_value()
+            || *priority < iox::detail::getSchedulerPriorityMinimum(parameters.scheduler.value())
+            || *priority > iox::detail::getSchedulerPriorityMaximum(parameters.scheduler.value()))
+        {
+            IOX_LOG(ERROR,
+                    "The priority " << *priority << " of the thread '" << threadName
+                                    << "' requires a scheduler and must be in the range of that scheduler");
+            return iox::err(iox::roudi::RouDiConfigFileParseError::INVALID_THREAD_PRIORITY);
+        }
+        parameters.priority = *priority;
+    }
+
+    return iox::ok();
+}
+} // namespace
+
 TomlRouDiConfigFileProvider::TomlRouDiConfigFileProvider(config::CmdLineArgs_t& cmdLineArgs) noexcept
 {
     /// don't print additional output if not running
@@ -82,7 +153,14 @@ iox::expected<iox::IceoryxConfig, iox::roudi::RouDiConfigFileParseError> TomlRou
     }
 
     return TomlRouDiConfigFileProvider::parse(fileStream).and_then([this](auto& config) {
+        // the thread configuration and the memory locking are only available in the config file
+        const RouDiConfig parsedRouDiConfig = config;
         static_cast<RouDiConfig&>(config) = m_roudiConfig;
+        config.monitoringAndDiscoveryThread = parsedRouDiConfig.monitoringAndDiscoveryThread;
+        config.runtimeMessagesThread = parsedRouDiConfig.runtimeMessagesThread;
+        config.processExitMonitorThread = parsedRouDiConfig.processExitMonitorThread;
+        config.timerServiceThread = parsedRouDiConfig.timerServiceThread;
+        config.lockMemory = parsedRouDiConfig.lockMemory;
     });
 }
 
@@ -166,6 +244,25 @@ TomlRouDiConfigFileProvider::parse(std::istream& stream) noexcept
              mempoolConfig});
     }
 
+    parsedConfig.lockMemory = general->get_as<bool>("lock_memory").value_or(false);
+
+    auto threads = parsedFile->get_table("threads");
+    if (threads)
+    {
+        for (const auto& thread :
+             {std::make_pair("monitoring_and_discovery", &parsedConfig.monitoringAndDiscoveryThread),
+              std::make_pair("runtime_messages", &parsedConfig.runtimeMessagesThread),
+              std::make_pair("process_exit_monitor", &parsedConfig.processExitMonitorThread),
+              std::make_pair("timer_service", &parsedConfig.timerServiceThread)})
+        {
+            auto result = parseThreadSchedulingParameters(*threads, thread.first, *thread.second);
+            if (result.has_error())
+            {
+                return iox::err(result.error());
+            }
+        }
+    }
+
     return iox::ok(parsedConfig);
 }
 } // namespace config
@@ -49,6 +49,7 @@ PoshRuntimeImpl::PoshRuntimeImpl(optional<const RuntimeName_t*> name,
     static_assert(PROCESS_KEEP_ALIVE_INTERVAL > roudi::DISCOVERY_INTERVAL, "Keep alive interval too small");
     m_keepAliveTask.emplace(concurrent::detail::PeriodicTaskAutoStart,
                             PROCESS_KEEP_ALIVE_INTERVAL,
+                            concurrent::TimerService::getInstance(),
                             "KeepAlive",
                             *this,
                             &PoshRuntimeImpl::sendKeepAliveAndHandleShutdownPreparation);
@@ -57,6 +57,7 @@ struct ChunkDistributorConfig
 struct ChunkQueueConfig
 {
     static constexpr uint64_t MAX_QUEUE_CAPACITY = NUM_CHUNKS_IN_POOL / 3;
+    static constexpr uint64_t INLINE_USER_PAYLOAD_CAPACITY = 0U;
 };
 
 using ChunkQueueData_t = ChunkQueueData<ChunkQueueConfig, ThreadSafePolicy>;
@@ -20,6 +20,7 @@
 #include "iceoryx_hoofs/testing/watch_dog.hpp"
 #include "iceoryx_posh/popo/publisher.hpp"
 #include "iceoryx_posh/popo/subscriber.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
 #include "iceoryx_posh/roudi_env/minimal_iceoryx_config.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iceoryx_posh/testing/roudi_gtest.hpp"
@@ -750,6 +751,124 @@ TEST_F(PublisherSubscriberCommunication_test, PublisherUniqueIdMatchesReceivedSa
     }
 }
 
+TEST_F(PublisherSubscriberCommunication_test, TakeBlockingReturnsSampleWhichIsPublishedWhileWaiting)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4c8e2a6f-9d1b-4f7e-b3a5-7e9c1d4f2a86");
+    using namespace iox::units::duration_literals;
+    auto publisher = createPublisher<int64_t>();
+    auto subscriber = createSubscriber<int64_t>();
+
+    std::thread publisherThread([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        EXPECT_FALSE(publisher->publishCopyOf(42).has_error());
+    });
+
+    auto maybeSample = subscriber->takeBlocking(3_s);
+    publisherThread.join();
+
+    ASSERT_FALSE(maybeSample.has_error());
+    EXPECT_THAT(*maybeSample.value(), Eq(42));
+}
+
+TEST_F(PublisherSubscriberCommunication_test, TakeBlockingWithBusyPollBudgetReturnsSampleWhichIsPublishedWhileWaiting)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a1d7f3b9-6e2c-4a8d-9f4b-3c6e8a1d7f52");
+    using namespace iox::units::duration_literals;
+    auto publisher = createPublisher<int64_t>();
+    auto subscriber = createSubscriber<int64_t>();
+
+    std::thread publisherThread([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        EXPECT_FALSE(publisher->publishCopyOf(73).has_error());
+    });
+
+    auto maybeSample = subscriber->takeBlocking(3_s, 100_ms);
+    publisherThread.join();
+
+    ASSERT_FALSE(maybeSample.has_error());
+    EXPECT_THAT(*maybeSample.value(), Eq(73));
+}
+
+TEST_F(PublisherSubscriberCommunication_test, TakeBlockingReturnsNoChunkAvailableAfterTheTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7e3b9d5a-2f8c-4e1b-a6d9-9b5f3e7a2c18");
+    using namespace iox::units::duration_literals;
+    constexpr std::chrono::milliseconds TIMEOUT{50};
+    auto publisher = createPublisher<int64_t>();
+    auto subscriber = createSubscriber<int64_t>();
+
+    const auto start = std::chrono::steady_clock::now();
+    auto maybeSample = subscriber->takeBlocking(50_ms, 1_ms);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    ASSERT_TRUE(maybeSample.has_error());
+    EXPECT_THAT(maybeSample.error(), Eq(ChunkReceiveResult::NO_CHUNK_AVAILABLE));
+    EXPECT_THAT(elapsed, Ge(TIMEOUT));
+}
+
+TEST_F(PublisherSubscriberCommunication_test, TakeBlockingWorksWhenSubscriberIsAttachedToAWaitSet)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5b9f1c7e-3a6d-4b2f-8e1c-6d3a9f5b1e74");
+    using namespace iox::units::duration_literals;
+    auto publisher = createPublisher<int64_t>();
+    auto subscriber = createSubscriber<int64_t>();
+    WaitSet<1U> waitSet;
+    ASSERT_FALSE(waitSet.attachState(*subscriber, SubscriberState::HAS_DATA).has_error());
+
+    EXPECT_TRUE(subscriber->takeBlocking(10_ms).has_error());
+
+    std::thread publisherThread([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        EXPECT_FALSE(publisher->publishCopyOf(13).has_error());
+    });
+    auto maybeSample = subscriber->takeBlocking(3_s);
+    publisherThread.join();
+
+    ASSERT_FALSE(maybeSample.has_error());
+    EXPECT_THAT(*maybeSample.value(), Eq(13));
+    EXPECT_THAT(waitSet.size(), Eq(1U));
+}
+
+TEST_F(PublisherSubscriberCommunication_test, SlicesAreReceivedWithThePublishedNumberOfElements)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "46779ada-cb26-44a2-b5a2-47611ea558f5");
+    constexpr uint64_t LOANED_NUMBER_OF_ELEMENTS{10U};
+    constexpr uint64_t PUBLISHED_NUMBER_OF_ELEMENTS{3U};
+    constexpr uint64_t COPIED_NUMBER_OF_ELEMENTS{5U};
+    const int64_t copiedElements[COPIED_NUMBER_OF_ELEMENTS]{5, 4, 3, 2, 1};
+    auto publisher = createPublisher<int64_t[]>();
+    auto subscriber = createSubscriber<int64_t[]>();
+
+    ASSERT_FALSE(publisher->loan(LOANED_NUMBER_OF_ELEMENTS)
+                     .and_then([&](auto& sample) {
+                         for (uint64_t i = 0U; i < sample.size(); ++i)
+                         {
+                             sample[i] = static_cast<int64_t>(i);
+                         }
+                         EXPECT_TRUE(sample.shrink(PUBLISHED_NUMBER_OF_ELEMENTS));
+                         sample.publish();
+                     })
+                     .has_error());
+    ASSERT_FALSE(publisher->publishCopyOf(copiedElements, COPIED_NUMBER_OF_ELEMENTS).has_error());
+
+    auto firstSample = subscriber->take();
+    ASSERT_FALSE(firstSample.has_error());
+    ASSERT_THAT(firstSample->size(), Eq(PUBLISHED_NUMBER_OF_ELEMENTS));
+    EXPECT_THAT(firstSample->getChunkHeader()->userPayloadSize(), Eq(PUBLISHED_NUMBER_OF_ELEMENTS * sizeof(int64_t)));
+    for (uint64_t i = 0U; i < PUBLISHED_NUMBER_OF_ELEMENTS; ++i)
+    {
+        EXPECT_THAT((*firstSample)[i], Eq(static_cast<int64_t>(i)));
+    }
+
+    auto secondSample = subscriber->take();
+    ASSERT_FALSE(secondSample.has_error());
+    ASSERT_THAT(secondSample->size(), Eq(COPIED_NUMBER_OF_ELEMENTS));
+    for (uint64_t i = 0U; i < COPIED_NUMBER_OF_ELEMENTS; ++i)
+    {
+        EXPECT_THAT((*secondSample)[i], Eq(copiedElements[i]));
+    }
+}
+
 #ifdef TEST_WITH_HUGE_PAYLOAD
 
 TEST_F(PublisherSubscriberCommunicationWithBigPayload_test, SendingComplexDataType_BigPayloadStruct)
@@ -173,7 +173,7 @@ TEST_F(ServiceDiscoveryBase_test, FindServiceWithWildcardsReturnsOnlyIntrospecti
     ::testing::Test::RecordProperty("TEST_ID", "d944f32c-edef-44f5-a6eb-c19ee73c98eb");
     findService(iox::capro::Wildcard, iox::capro::Wildcard, iox::capro::Wildcard, MessagingPattern::PUB_SUB);
 
-    constexpr uint32_t NUM_INTERNAL_SERVICES = 6U;
+    constexpr uint32_t NUM_INTERNAL_SERVICES = 7U;
     EXPECT_EQ(serviceContainer.size(), NUM_INTERNAL_SERVICES);
     for (auto& service : serviceContainer)
     {
@@ -446,6 +446,7 @@ class ReferenceDiscovery
             services.emplace(iox::roudi::IntrospectionPortService);
             services.emplace(iox::roudi::IntrospectionPortThroughputService);
             services.emplace(iox::roudi::IntrospectionSubscriberPortChangingDataService);
+            services.emplace(iox::roudi::IntrospectionPortDeltaService);
             services.emplace(iox::roudi::IntrospectionProcessService);
             services.emplace(iox::SERVICE_DISCOVERY_SERVICE_NAME,
                              iox::SERVICE_DISCOVERY_INSTANCE_NAME,
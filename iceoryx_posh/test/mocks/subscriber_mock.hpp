@@ -82,6 +82,7 @@ class MockBaseSubscriber
     MOCK_METHOD0(releaseQueuedData, void());
     MOCK_METHOD1(invalidateTrigger, bool(const uint64_t));
     MOCK_METHOD1(disableEvent, void(const iox::popo::SubscriberEvent));
+    MOCK_METHOD2(waitForData, bool(const iox::units::Duration, const iox::units::Duration));
 
     const Port& port() const noexcept
     {
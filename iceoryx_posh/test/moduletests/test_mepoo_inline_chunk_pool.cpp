@@ -0,0 +1,201 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/inline_chunk_pool.hpp"
+
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/mepoo/chunk_settings.hpp"
+
+#include "test.hpp"
+
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+
+using namespace iox::mepoo;
+
+class InlineChunkPool_test : public Test
+{
+  public:
+    static constexpr uint64_t USER_PAYLOAD_CAPACITY{16U};
+    static constexpr uint32_t NUMBER_OF_CHUNKS{4U};
+
+    static ChunkSettings createChunkSettings(const uint64_t userPayloadSize,
+                                             const uint32_t userPayloadAlignment = alignof(uint64_t),
+                                             const uint32_t userHeaderSize = iox::CHUNK_NO_USER_HEADER_SIZE,
+                                             const uint32_t userHeaderAlignment = iox::CHUNK_NO_USER_HEADER_ALIGNMENT)
+    {
+        return ChunkSettings::create(userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment)
+            .expect("Valid 'ChunkSettings'");
+    }
+
+    InlineChunkPool<USER_PAYLOAD_CAPACITY, NUMBER_OF_CHUNKS> sut;
+};
+
+TEST_F(InlineChunkPool_test, AllocatedChunkHasRequestedUserPayload)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "580281d7-4e2b-4700-865c-6803e905e36f");
+    auto chunkHeader = sut.tryAllocate(createChunkSettings(sizeof(uint64_t)));
+
+    ASSERT_TRUE(chunkHeader.has_value());
+    EXPECT_THAT(chunkHeader.value()->userPayloadSize(), Eq(sizeof(uint64_t)));
+    EXPECT_THAT(chunkHeader.value()->chunkSize(), Eq(decltype(sut)::CHUNK_SIZE));
+    EXPECT_THAT(reinterpret_cast<uintptr_t>(chunkHeader.value()->userPayload()) % alignof(uint64_t), Eq(0U));
+    EXPECT_TRUE(sut.contains(chunkHeader.value()));
+}
+
+TEST_F(InlineChunkPool_test, AllocatingMoreChunksThanAvailableFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8206160f-64d0-4a16-b395-f9b7dee8ac1a");
+    std::vector<ChunkHeader*> chunkHeaders;
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto chunkHeader = sut.tryAllocate(createChunkSettings(USER_PAYLOAD_CAPACITY));
+        ASSERT_TRUE(chunkHeader.has_value());
+        for (auto allocatedChunkHeader : chunkHeaders)
+        {
+            EXPECT_THAT(chunkHeader.value(), Ne(allocatedChunkHeader));
+        }
+        chunkHeaders.push_back(chunkHeader.value());
+    }
+
+    EXPECT_FALSE(sut.tryAllocate(createChunkSettings(sizeof(uint64_t))).has_value());
+}
+
+TEST_F(InlineChunkPool_test, AllocatingChunkWhichDoesNotFitFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "25978ac3-b26d-4dce-bb4c-8c1d27095431");
+    EXPECT_FALSE(sut.tryAllocate(createChunkSettings(USER_PAYLOAD_CAPACITY + 1U)).has_value());
+}
+
+TEST_F(InlineChunkPool_test, FitsAcceptsUserPayloadUpToCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "18b7dc6d-2383-4f27-84af-8c02134c521b");
+    EXPECT_TRUE(decltype(sut)::fits(createChunkSettings(1U, 1U)));
+    EXPECT_TRUE(decltype(sut)::fits(createChunkSettings(USER_PAYLOAD_CAPACITY)));
+}
+
+TEST_F(InlineChunkPool_test, FitsRejectsUserPayloadExceedingCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "46122838-f912-4a1e-8c92-f4370bf4d8d8");
+    EXPECT_FALSE(decltype(sut)::fits(createChunkSettings(USER_PAYLOAD_CAPACITY + 1U)));
+}
+
+TEST_F(InlineChunkPool_test, FitsRejectsUserHeader)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f7437f39-67ba-41ca-b709-4d85e48e2b62");
+    EXPECT_FALSE(decltype(sut)::fits(createChunkSettings(1U, 1U, sizeof(uint64_t), alignof(uint64_t))));
+}
+
+TEST_F(InlineChunkPool_test, FitsRejectsUserPayloadAlignmentWhichExceedsChunkSize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7174ccef-38c4-4106-9a08-a01fdbab639c");
+    constexpr uint32_t LARGE_ALIGNMENT{256U};
+    EXPECT_FALSE(decltype(sut)::fits(createChunkSettings(1U, LARGE_ALIGNMENT)));
+}
+
+TEST_F(InlineChunkPool_test, FreedChunkCanBeAllocatedAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1672db63-2c98-4de3-9236-03ab2cfd3004");
+    ChunkHeader* lastChunkHeader{nullptr};
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        lastChunkHeader = sut.tryAllocate(createChunkSettings(sizeof(uint64_t))).value();
+    }
+
+    EXPECT_TRUE(sut.free(lastChunkHeader));
+
+    auto chunkHeader = sut.tryAllocate(createChunkSettings(sizeof(uint64_t)));
+    ASSERT_TRUE(chunkHeader.has_value());
+    EXPECT_THAT(chunkHeader.value(), Eq(lastChunkHeader));
+}
+
+TEST_F(InlineChunkPool_test, FreeingChunkTwiceFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0cd5088b-2bb2-4157-b750-9fd64442759c");
+    auto chunkHeader = sut.tryAllocate(createChunkSettings(sizeof(uint64_t)));
+    ASSERT_TRUE(chunkHeader.has_value());
+    EXPECT_TRUE(sut.free(chunkHeader.value()));
+
+    EXPECT_FALSE(sut.free(chunkHeader.value()));
+}
+
+TEST_F(InlineChunkPool_test, FreeingChunkWhichIsNotInUseFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ce136150-e29f-462d-a129-1a5dcfb37280");
+    auto chunkHeader = sut.tryAllocate(createChunkSettings(sizeof(uint64_t)));
+    ASSERT_TRUE(chunkHeader.has_value());
+    auto neighbour = reinterpret_cast<ChunkHeader*>(reinterpret_cast<uint8_t*>(chunkHeader.value())
+                                                    + decltype(sut)::CHUNK_SIZE);
+
+    EXPECT_FALSE(sut.free(neighbour));
+}
+
+TEST_F(InlineChunkPool_test, FreeingChunkNotAtChunkBoundaryFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2f076b3d-895f-45a1-af1e-5dd86d8d53b1");
+    auto chunkHeader = sut.tryAllocate(createChunkSettings(sizeof(uint64_t)));
+    ASSERT_TRUE(chunkHeader.has_value());
+    auto misplaced = reinterpret_cast<ChunkHeader*>(reinterpret_cast<uint8_t*>(chunkHeader.value()) + 1U);
+
+    EXPECT_TRUE(sut.contains(misplaced));
+    EXPECT_FALSE(sut.free(misplaced));
+}
+
+TEST_F(InlineChunkPool_test, ChunkOutsideOfPoolIsNotContainedAndCannotBeFreed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f7e69a27-17db-4204-887c-6f94d580d972");
+    alignas(ChunkHeader) uint8_t memory[decltype(sut)::CHUNK_SIZE];
+    auto chunkHeader = new (memory) ChunkHeader(decltype(sut)::CHUNK_SIZE, createChunkSettings(sizeof(uint64_t)));
+
+    EXPECT_FALSE(sut.contains(chunkHeader));
+    EXPECT_FALSE(sut.contains(nullptr));
+    EXPECT_FALSE(sut.free(chunkHeader));
+}
+
+TEST_F(InlineChunkPool_test, FreeAllMakesAllChunksAvailable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "07505237-91e5-4636-8a31-f17de12916f4");
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        EXPECT_TRUE(sut.tryAllocate(createChunkSettings(sizeof(uint64_t))).has_value());
+    }
+
+    sut.freeAll();
+
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        EXPECT_TRUE(sut.tryAllocate(createChunkSettings(sizeof(uint64_t))).has_value());
+    }
+}
+
+TEST_F(InlineChunkPool_test, PoolWithoutUserPayloadCapacityProvidesNoChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5ff97594-3f83-40f1-bd2a-9124a676e9d8");
+    InlineChunkPool<0U, NUMBER_OF_CHUNKS> disabledPool;
+    ChunkHeader* chunkHeader = sut.tryAllocate(createChunkSettings(1U, 1U)).value();
+
+    EXPECT_FALSE(decltype(disabledPool)::fits(createChunkSettings(1U, 1U)));
+    EXPECT_FALSE(disabledPool.tryAllocate(createChunkSettings(1U, 1U)).has_value());
+    EXPECT_FALSE(disabledPool.contains(chunkHeader));
+    EXPECT_FALSE(disabledPool.free(chunkHeader));
+    EXPECT_TRUE(std::is_empty<decltype(disabledPool)>::value);
+}
+
+} // namespace
@@ -322,4 +322,58 @@ TEST_F(SharedChunk_Test, ReleaseMethodReturnsChunkManagementPointerOfSharedChunk
     EXPECT_EQ(sut.getChunkHeader(), nullptr);
 }
 
+TEST_F(SharedChunk_Test, AcquireReferencesIncrementsTheReferenceCounterByTheNumberOfReferences)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "25346dfa-6af1-407b-ab7f-ab7b32be9620");
+    constexpr uint64_t NUMBER_OF_REFERENCES{3U};
+
+    sut.acquireReferences(NUMBER_OF_REFERENCES);
+
+    EXPECT_EQ(chunkManagement->m_referenceCounter.load(), NUMBER_OF_REFERENCES + 1U);
+    sut.releaseAcquiredReferences(NUMBER_OF_REFERENCES);
+}
+
+TEST_F(SharedChunk_Test, AdoptAcquiredReferenceDoesNotChangeTheReferenceCounter)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9f2cea29-214c-4f98-b1b9-d0d66c03f839");
+    constexpr uint64_t NUMBER_OF_REFERENCES{2U};
+    sut.acquireReferences(NUMBER_OF_REFERENCES);
+
+    {
+        auto adoptedChunk1 = sut.adoptAcquiredReference();
+        auto adoptedChunk2 = sut.adoptAcquiredReference();
+
+        EXPECT_TRUE(adoptedChunk1 == sut);
+        EXPECT_TRUE(adoptedChunk2 == sut);
+        EXPECT_EQ(chunkManagement->m_referenceCounter.load(), NUMBER_OF_REFERENCES + 1U);
+    }
+
+    EXPECT_EQ(chunkManagement->m_referenceCounter.load(), 1U);
+}
+
+TEST_F(SharedChunk_Test, ReleaseAcquiredReferencesDecrementsTheReferenceCounterByTheNumberOfReferences)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "762e8ced-7792-4cd6-9d37-84f27043a216");
+    constexpr uint64_t NUMBER_OF_REFERENCES{4U};
+    sut.acquireReferences(NUMBER_OF_REFERENCES);
+
+    sut.releaseAcquiredReferences(NUMBER_OF_REFERENCES);
+
+    EXPECT_EQ(chunkManagement->m_referenceCounter.load(), 1U);
+    EXPECT_EQ(sut.getChunkHeader(), chunkManagement->m_chunkHeader.get());
+}
+
+TEST_F(SharedChunk_Test, AcquireAndReleaseReferencesOnEmptySharedChunkDoesNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "59e25059-1f28-432d-be3c-942af4ad3e3f");
+    SharedChunk emptySut;
+
+    emptySut.acquireReferences(2U);
+    auto adoptedChunk = emptySut.adoptAcquiredReference();
+    emptySut.releaseAcquiredReferences(2U);
+
+    EXPECT_FALSE(adoptedChunk);
+    EXPECT_EQ(emptySut.getChunkHeader(), nullptr);
+}
+
 } // namespace
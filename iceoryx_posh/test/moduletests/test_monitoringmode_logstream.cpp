@@ -61,4 +61,17 @@ TEST_F(MonitoringModeLogStreamTest, MonitoringModeOnLeadsToCorrectString)
     EXPECT_THAT(m_loggerMock.logs[0].message, Eq("MonitoringMode::ON"));
 }
 
+TEST_F(MonitoringModeLogStreamTest, MonitoringModePidfdLeadsToCorrectString)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f2c6b9d1-8e4a-4b7c-a3f5-1d9e0c2b8a64");
+    auto sut = MonitoringMode::PIDFD;
+
+    {
+        IOX_LOGSTREAM_MOCK(m_loggerMock) << sut;
+    }
+
+    ASSERT_THAT(m_loggerMock.logs.size(), Eq(1U));
+    EXPECT_THAT(m_loggerMock.logs[0].message, Eq("MonitoringMode::PIDFD"));
+}
+
 } // namespace
@@ -93,6 +93,7 @@ class ChunkDistributor_test : public Test
     struct ChunkQueueConfig
     {
         static constexpr uint64_t MAX_QUEUE_CAPACITY = MAX_NUMBER_QUEUES;
+        static constexpr uint64_t INLINE_USER_PAYLOAD_CAPACITY = 0U;
     };
 
     using ChunkQueueData_t = ChunkQueueData<ChunkQueueConfig, PolicyType>;
@@ -450,6 +451,37 @@ TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesWithMultipleQueues)
     EXPECT_THAT(sut.getHistorySize(), Eq(1u));
 }
 
+TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesHoldsOneReferencePerQueueAndHistoryEntry)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "32c27016-f4bb-4e5c-a002-dd37bc4f0a03");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t NUMBER_OF_QUEUES = 10U;
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueData;
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueData.emplace_back(this->getChunkQueueData());
+        ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+    }
+
+    auto* chunkManagement = this->allocateChunk(1337U).release();
+    SharedChunk chunk(chunkManagement);
+    sut.deliverToAllStoredQueues(chunk);
+
+    // one reference per queue, one for the history and the one of 'chunk'
+    EXPECT_THAT(chunkManagement->m_referenceCounter.load(), Eq(NUMBER_OF_QUEUES + 2U));
+
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData[i].get());
+        EXPECT_TRUE(queue.tryPop().has_value());
+    }
+    sut.clearHistory();
+
+    EXPECT_THAT(chunkManagement->m_referenceCounter.load(), Eq(1U));
+}
+
 TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesWithMultipleQueuesMultipleChunks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "6930af8f-ab92-44ea-928b-239d45eed807");
@@ -600,6 +632,29 @@ TYPED_TEST(ChunkDistributor_test, DeliverToQueueWithMoreChunksThanCapacityLeadsT
     ASSERT_TRUE(queue.hasLostChunks());
 }
 
+TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesWithMoreChunksThanCapacityCountsDroppedChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7d3f1b60-92e4-4c8a-b5d7-0e6a2c9f4b13");
+    using ChunkQueueData_t = typename TestFixture::ChunkQueueData_t;
+
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    constexpr uint64_t NUMBER_OF_OVERFLOWS{2U};
+    for (uint64_t i = 0; i < ChunkQueueData_t::MAX_CAPACITY + NUMBER_OF_OVERFLOWS; ++i)
+    {
+        sut.deliverToAllStoredQueues(this->allocateChunk(i));
+    }
+
+    EXPECT_THAT(sutData->m_statistics.m_deliveredChunks.load(), Eq(ChunkQueueData_t::MAX_CAPACITY));
+    EXPECT_THAT(sutData->m_statistics.m_droppedChunks.load(), Eq(NUMBER_OF_OVERFLOWS));
+    EXPECT_THAT(queueData->m_statistics.m_receivedChunks.load(), Eq(ChunkQueueData_t::MAX_CAPACITY));
+    EXPECT_THAT(queueData->m_statistics.m_lostChunks.load(), Eq(NUMBER_OF_OVERFLOWS));
+}
+
 TYPED_TEST(ChunkDistributor_test, DeliverToQueueWithBlockingOptionBlocksDelivery)
 {
     ::testing::Test::RecordProperty("TEST_ID", "9f594607-215e-4db5-bdae-433c185dbbcd");
@@ -760,6 +815,9 @@ TYPED_TEST(ChunkDistributor_test, DeliverToSingleQueueBlocksWhenOptionsAreSetToB
     maybeSharedChunk = queue.tryPop();
     ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
     EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(152U));
+
+    const auto blockedTime = std::chrono::nanoseconds(sutData->m_statistics.m_blockedTimeInNanoseconds.load());
+    EXPECT_THAT(blockedTime, Ge(this->BLOCKING_DURATION));
 }
 
 TYPED_TEST(ChunkDistributor_test, MultipleBlockingQueuesWillBeFilledWhenThereBecomesSpaceAvailable)
@@ -18,9 +18,13 @@
 #include "iceoryx_hoofs/testing/mocks/logger_mock.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_sender.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_sender_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
@@ -232,6 +236,176 @@ TEST_F(ChunkReceiver_test, Cleanup)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+class ChunkReceiverInlineUserPayload_test : public ChunkReceiver_test
+{
+  protected:
+    static constexpr uint64_t INLINE_USER_PAYLOAD_CAPACITY = 16U;
+
+    struct InlineChunkQueueConfig
+    {
+        static constexpr uint64_t MAX_QUEUE_CAPACITY = iox::MAX_SUBSCRIBER_QUEUE_CAPACITY;
+        static constexpr uint64_t INLINE_USER_PAYLOAD_CAPACITY =
+            ChunkReceiverInlineUserPayload_test::INLINE_USER_PAYLOAD_CAPACITY;
+    };
+
+    using InlineChunkQueueData_t = iox::popo::ChunkQueueData<InlineChunkQueueConfig, iox::popo::ThreadSafePolicy>;
+    using InlineChunkReceiverData_t =
+        iox::popo::ChunkReceiverData<iox::MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY, InlineChunkQueueData_t>;
+    using InlineChunkDistributorData_t =
+        iox::popo::ChunkDistributorData<iox::DefaultChunkDistributorConfig,
+                                        iox::popo::ThreadSafePolicy,
+                                        iox::popo::ChunkQueuePusher<InlineChunkQueueData_t>>;
+    using InlineChunkSenderData_t = iox::popo::ChunkSenderData<iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY,
+                                                               InlineChunkDistributorData_t>;
+
+    void SetUp() override
+    {
+        m_inlineChunkSenderData.m_inlineUserPayload = true;
+        ASSERT_FALSE(m_inlineChunkSender.tryAddQueue(&m_inlineChunkReceiverData).has_error());
+    }
+
+    void sendInlineValue(const uint64_t value)
+    {
+        auto maybeChunkHeader = m_inlineChunkSender.tryAllocate(m_originId,
+                                                                sizeof(uint64_t),
+                                                                alignof(uint64_t),
+                                                                iox::CHUNK_NO_USER_HEADER_SIZE,
+                                                                iox::CHUNK_NO_USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        *static_cast<uint64_t*>((*maybeChunkHeader)->userPayload()) = value;
+        EXPECT_THAT(m_inlineChunkSender.send(*maybeChunkHeader), Eq(1U));
+    }
+
+    const iox::popo::UniquePortId m_originId{iox::roudi::DEFAULT_UNIQUE_ROUDI_ID};
+
+    InlineChunkReceiverData_t m_inlineChunkReceiverData{iox::popo::VariantQueueTypes::SoFi_SingleProducerSingleConsumer,
+                                                        iox::popo::QueueFullPolicy::DISCARD_OLDEST_DATA};
+    iox::popo::ChunkReceiver<InlineChunkReceiverData_t> m_inlineChunkReceiver{&m_inlineChunkReceiverData};
+    iox::popo::ChunkQueuePusher<InlineChunkQueueData_t> m_inlineChunkQueuePusher{&m_inlineChunkReceiverData};
+
+    InlineChunkSenderData_t m_inlineChunkSenderData{&m_memoryManager,
+                                                    iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
+    iox::popo::ChunkSender<InlineChunkSenderData_t> m_inlineChunkSender{&m_inlineChunkSenderData};
+};
+
+TEST_F(ChunkReceiverInlineUserPayload_test, GetRestoresInlineUserPayloadAndChunkHeader)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2d610b80-37fd-4cde-a22c-83a5a87cd33a");
+    constexpr uint64_t FIRST_VALUE{4711U};
+    constexpr uint64_t SECOND_VALUE{1174U};
+    sendInlineValue(FIRST_VALUE);
+    sendInlineValue(SECOND_VALUE);
+
+    auto firstChunkHeader = m_inlineChunkReceiver.tryGet();
+    auto secondChunkHeader = m_inlineChunkReceiver.tryGet();
+
+    ASSERT_FALSE(firstChunkHeader.has_error());
+    ASSERT_FALSE(secondChunkHeader.has_error());
+    EXPECT_THAT(*static_cast<const uint64_t*>((*firstChunkHeader)->userPayload()), Eq(FIRST_VALUE));
+    EXPECT_THAT(*static_cast<const uint64_t*>((*secondChunkHeader)->userPayload()), Eq(SECOND_VALUE));
+    EXPECT_THAT((*firstChunkHeader)->userPayloadSize(), Eq(sizeof(uint64_t)));
+    EXPECT_THAT((*firstChunkHeader)->originId(), Eq(m_originId));
+    EXPECT_THAT((*secondChunkHeader)->sequenceNumber(), Eq((*firstChunkHeader)->sequenceNumber() + 1U));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkReceiverInlineUserPayload_test, GetProvidesChunksAndInlineUserPayloadsInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ca215f0c-0b3d-4b49-ba3e-7ce850ab764f");
+    sendInlineValue(1U);
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        static_cast<DummySample*>(sharedChunk.getUserPayload())->dummy = 2U;
+        m_inlineChunkQueuePusher.push(sharedChunk);
+    }
+    sendInlineValue(3U);
+
+    for (uint64_t expectedValue = 1U; expectedValue <= 3U; ++expectedValue)
+    {
+        auto maybeChunkHeader = m_inlineChunkReceiver.tryGet();
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        EXPECT_THAT(*static_cast<const uint64_t*>((*maybeChunkHeader)->userPayload()), Eq(expectedValue));
+        m_inlineChunkReceiver.release(*maybeChunkHeader);
+    }
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkReceiverInlineUserPayload_test, GetTooManyInlineUserPayloadsFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "65fd0474-14da-4fd7-b8c6-23a40a5dd035");
+    for (uint64_t i = 0U; i < InlineChunkReceiverData_t::MAX_CHUNKS_IN_USE; ++i)
+    {
+        sendInlineValue(i);
+        EXPECT_FALSE(m_inlineChunkReceiver.tryGet().has_error());
+    }
+    sendInlineValue(0U);
+
+    auto maybeChunkHeader = m_inlineChunkReceiver.tryGet();
+
+    ASSERT_TRUE(maybeChunkHeader.has_error());
+    EXPECT_THAT(maybeChunkHeader.error(), Eq(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL));
+}
+
+TEST_F(ChunkReceiverInlineUserPayload_test, ReleasedInlineUserPayloadCanBeReceivedAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "843877cc-b488-4614-8fac-f8c42f822f02");
+    const iox::mepoo::ChunkHeader* chunkHeader{nullptr};
+    for (uint64_t i = 0U; i < InlineChunkReceiverData_t::MAX_CHUNKS_IN_USE; ++i)
+    {
+        sendInlineValue(i);
+        auto maybeChunkHeader = m_inlineChunkReceiver.tryGet();
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        chunkHeader = *maybeChunkHeader;
+    }
+
+    m_inlineChunkReceiver.release(chunkHeader);
+    sendInlineValue(0U);
+
+    EXPECT_FALSE(m_inlineChunkReceiver.tryGet().has_error());
+}
+
+TEST_F(ChunkReceiverInlineUserPayload_test, ReleasingInlineUserPayloadTwiceFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "415a0671-7568-4c8d-98f6-9cd5760b9e8e");
+    sendInlineValue(1U);
+    auto maybeChunkHeader = m_inlineChunkReceiver.tryGet();
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    m_inlineChunkReceiver.release(*maybeChunkHeader);
+
+    m_inlineChunkReceiver.release(*maybeChunkHeader);
+
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::POPO__CHUNK_RECEIVER_INVALID_CHUNK_TO_RELEASE_FROM_USER);
+}
+
+TEST_F(ChunkReceiverInlineUserPayload_test, CleanupReleasesInlineUserPayloads)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e458aff5-485b-47da-9942-441f593187e3");
+    for (uint64_t i = 0U; i < InlineChunkReceiverData_t::MAX_CHUNKS_IN_USE; ++i)
+    {
+        sendInlineValue(i);
+        EXPECT_FALSE(m_inlineChunkReceiver.tryGet().has_error());
+    }
+    sendInlineValue(0U);
+
+    m_inlineChunkReceiver.releaseAll();
+
+    EXPECT_TRUE(m_inlineChunkReceiver.empty());
+    sendInlineValue(0U);
+    EXPECT_FALSE(m_inlineChunkReceiver.tryGet().has_error());
+}
+
+TEST_F(ChunkReceiverInlineUserPayload_test, TryPopOfInlineUserPayloadFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "eecd8041-ff35-4b6e-860b-26b65b2986e6");
+    sendInlineValue(1U);
+
+    iox::popo::ChunkQueuePopper<InlineChunkQueueData_t> popper(&m_inlineChunkReceiverData);
+
+    EXPECT_FALSE(popper.tryPop().has_value());
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::POPO__CHUNK_QUEUE_POPPER_INLINE_USER_PAYLOAD_WITHOUT_CHUNK);
+}
+
 TEST_F(ChunkReceiver_test, asStringLiteralConvertsChunkReceiveResultValuesToStrings)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5cbbda34-8a22-4eab-a8b6-20da345c1707");
@@ -17,6 +17,7 @@
 
 #include "iceoryx_hoofs/testing/mocks/logger_mock.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/inline_chunk_pool.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
@@ -96,6 +97,7 @@ class ChunkSender_test : public Test
     struct ChunkQueueConfig
     {
         static constexpr uint64_t MAX_QUEUE_CAPACITY = NUM_CHUNKS_IN_POOL;
+        static constexpr uint64_t INLINE_USER_PAYLOAD_CAPACITY = 0U;
     };
 
     using ChunkQueueData_t = iox::popo::ChunkQueueData<ChunkQueueConfig, iox::popo::ThreadSafePolicy>;
@@ -228,6 +230,36 @@ TEST_F(ChunkSender_test, allocate_Overflow)
                 Eq(iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY));
 }
 
+TEST_F(ChunkSender_test, allocateOverflowIsCountedAsLoanFailure)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4b8e0f52-7c1d-4a36-9e2b-d5f7a6c3b184");
+    std::vector<iox::mepoo::ChunkHeader*> chunks;
+    for (size_t i = 0; i < iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY; i++)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                                          sizeof(DummySample),
+                                                          alignof(DummySample),
+                                                          USER_HEADER_SIZE,
+                                                          USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        chunks.push_back(*maybeChunkHeader);
+    }
+    EXPECT_THAT(m_chunkSenderData.m_statistics.m_loanFailures.load(), Eq(0U));
+
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                                      sizeof(DummySample),
+                                                      alignof(DummySample),
+                                                      USER_HEADER_SIZE,
+                                                      USER_HEADER_ALIGNMENT);
+    ASSERT_TRUE(maybeChunkHeader.has_error());
+
+    EXPECT_THAT(m_chunkSenderData.m_statistics.m_loanFailures.load(), Eq(1U));
+    for (auto chunk : chunks)
+    {
+        m_chunkSender.release(chunk);
+    }
+}
+
 TEST_F(ChunkSender_test, freeChunk)
 {
     ::testing::Test::RecordProperty("TEST_ID", "b4a6eb09-a431-4f38-bd0c-38baf896a639");
@@ -397,6 +429,36 @@ TEST_F(ChunkSender_test, sendOneWithReceiver)
     }
 }
 
+TEST_F(ChunkSender_test, sendUpdatesSenderAndQueueStatistics)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c2a7d91e-3f5b-4e08-8b6a-1d9e4f7c0a25");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+    constexpr uint64_t NUMBER_OF_SENT_CHUNKS{3U};
+
+    uint64_t chunkSize{0U};
+    for (uint64_t i = 0U; i < NUMBER_OF_SENT_CHUNKS; ++i)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                                          sizeof(DummySample),
+                                                          alignof(DummySample),
+                                                          USER_HEADER_SIZE,
+                                                          USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        chunkSize = (*maybeChunkHeader)->chunkSize();
+        m_chunkSender.send(*maybeChunkHeader);
+    }
+
+    const auto& statistics = m_chunkSenderData.m_statistics;
+    EXPECT_THAT(statistics.m_sentChunks.load(), Eq(NUMBER_OF_SENT_CHUNKS));
+    EXPECT_THAT(statistics.m_deliveredChunks.load(), Eq(NUMBER_OF_SENT_CHUNKS));
+    EXPECT_THAT(statistics.m_droppedChunks.load(), Eq(0U));
+    EXPECT_THAT(statistics.m_blockedTimeInNanoseconds.load(), Eq(0U));
+    EXPECT_THAT(statistics.m_lastUserPayloadSize.load(), Eq(sizeof(DummySample)));
+    EXPECT_THAT(statistics.m_lastChunkSize.load(), Eq(chunkSize));
+    EXPECT_THAT(m_chunkQueueData.m_statistics.m_receivedChunks.load(), Eq(NUMBER_OF_SENT_CHUNKS));
+    EXPECT_THAT(m_chunkQueueData.m_statistics.m_lostChunks.load(), Eq(0U));
+}
+
 TEST_F(ChunkSender_test, sendMultipleWithReceiver)
 {
     ::testing::Test::RecordProperty("TEST_ID", "07e6a360-f5ae-4cd9-9bee-54b3c31c3390");
@@ -805,6 +867,269 @@ TEST_F(ChunkSender_test, Cleanup)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+class ChunkSenderInlineUserPayload_test : public ChunkSender_test
+{
+  protected:
+    ChunkSenderInlineUserPayload_test()
+    {
+        m_inlineChunkSenderData.m_inlineUserPayload = true;
+        m_inlineChunkSenderDataWithHistory.m_inlineUserPayload = true;
+        EXPECT_FALSE(m_inlineChunkSender.tryAddQueue(&m_inlineChunkQueueData).has_error());
+    }
+
+    static constexpr uint64_t INLINE_USER_PAYLOAD_CAPACITY = 16U;
+
+    struct InlineChunkQueueConfig
+    {
+        static constexpr uint64_t MAX_QUEUE_CAPACITY = NUM_CHUNKS_IN_POOL;
+        static constexpr uint64_t INLINE_USER_PAYLOAD_CAPACITY =
+            ChunkSenderInlineUserPayload_test::INLINE_USER_PAYLOAD_CAPACITY;
+    };
+
+    using InlineChunkQueueData_t = iox::popo::ChunkQueueData<InlineChunkQueueConfig, iox::popo::ThreadSafePolicy>;
+    using InlineChunkDistributorData_t =
+        iox::popo::ChunkDistributorData<ChunkDistributorConfig,
+                                        iox::popo::ThreadSafePolicy,
+                                        iox::popo::ChunkQueuePusher<InlineChunkQueueData_t>>;
+    using InlineChunkSenderData_t = iox::popo::ChunkSenderData<iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY,
+                                                               InlineChunkDistributorData_t>;
+    using InlineChunkSender_t = iox::popo::ChunkSender<InlineChunkSenderData_t>;
+
+    iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError>
+    allocate(InlineChunkSender_t& sender,
+             const uint64_t userPayloadSize,
+             const uint32_t userHeaderSize = USER_HEADER_SIZE,
+             const uint32_t userHeaderAlignment = USER_HEADER_ALIGNMENT)
+    {
+        return sender.tryAllocate(
+            m_originId, userPayloadSize, USER_PAYLOAD_ALIGNMENT, userHeaderSize, userHeaderAlignment);
+    }
+
+    void allocateAndSend(InlineChunkSender_t& sender, const uint64_t value)
+    {
+        auto maybeChunkHeader = allocate(sender, sizeof(uint64_t));
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        *static_cast<uint64_t*>((*maybeChunkHeader)->userPayload()) = value;
+        sender.send(*maybeChunkHeader);
+    }
+
+    /// @brief pops an inline user-payload and restores it like the ChunkReceiver
+    iox::optional<uint64_t> popInlineValue(InlineChunkQueueData_t& queueData)
+    {
+        iox::popo::ChunkQueuePopper<InlineChunkQueueData_t> popper(&queueData);
+        auto element = popper.tryPopElement();
+        if (!element.has_value() || !element->isInline())
+        {
+            return iox::nullopt;
+        }
+
+        iox::mepoo::InlineChunkPool<INLINE_USER_PAYLOAD_CAPACITY, 1U> inlineChunks;
+        auto chunkHeader = element->restoreInlineChunk(inlineChunks);
+        if (!chunkHeader.has_value())
+        {
+            return iox::nullopt;
+        }
+        EXPECT_THAT(chunkHeader.value()->originId(), Eq(m_originId));
+        m_lastSequenceNumber = chunkHeader.value()->sequenceNumber();
+        return *static_cast<const uint64_t*>(chunkHeader.value()->userPayload());
+    }
+
+    const UniquePortId m_originId{iox::roudi::DEFAULT_UNIQUE_ROUDI_ID};
+    uint64_t m_lastSequenceNumber{0U};
+
+    InlineChunkQueueData_t m_inlineChunkQueueData{iox::popo::QueueFullPolicy::DISCARD_OLDEST_DATA,
+                                                  iox::popo::VariantQueueTypes::SoFi_SingleProducerSingleConsumer};
+    InlineChunkSenderData_t m_inlineChunkSenderData{&m_memoryManager,
+                                                    iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
+    InlineChunkSenderData_t m_inlineChunkSenderDataWithHistory{
+        &m_memoryManager, iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, HISTORY_CAPACITY};
+
+    InlineChunkSender_t m_inlineChunkSender{&m_inlineChunkSenderData};
+    InlineChunkSender_t m_inlineChunkSenderWithHistory{&m_inlineChunkSenderDataWithHistory};
+};
+
+TEST_F(ChunkSenderInlineUserPayload_test, AllocatingSmallUserPayloadDoesNotUseMempool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8b78c802-1168-4f3b-b5c2-b01b08e39e63");
+    auto maybeChunkHeader = allocate(m_inlineChunkSender, INLINE_USER_PAYLOAD_CAPACITY);
+
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT((*maybeChunkHeader)->userPayloadSize(), Eq(INLINE_USER_PAYLOAD_CAPACITY));
+    EXPECT_THAT((*maybeChunkHeader)->originId(), Eq(m_originId));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(1).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkSenderInlineUserPayload_test, AllocatingUserPayloadExceedingInlineCapacityUsesMempool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "12710647-95ad-441f-ac3b-575e7eca77c1");
+    auto maybeChunkHeader = allocate(m_inlineChunkSender, INLINE_USER_PAYLOAD_CAPACITY + 1U);
+
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+}
+
+TEST_F(ChunkSenderInlineUserPayload_test, AllocatingSmallUserPayloadWithUserHeaderUsesMempool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "58ab5d85-1df4-4064-96a5-96fe4dcb99f5");
+    auto maybeChunkHeader = allocate(m_inlineChunkSender, sizeof(uint64_t), sizeof(uint64_t), alignof(uint64_t));
+
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+}
+
+TEST_F(ChunkSenderInlineUserPayload_test, AllocatingSmallUserPayloadWithDisabledInlineUserPayloadUsesMempool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c8e92124-7de4-4c27-8ae9-35309430ddfe");
+    m_inlineChunkSenderData.m_inlineUserPayload = false;
+
+    auto maybeChunkHeader = allocate(m_inlineChunkSender, sizeof(uint64_t));
+
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+}
+
+TEST_F(ChunkSenderInlineUserPayload_test, SendCopiesUserPayloadIntoQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8e8dd54b-065d-47d0-a788-92bf94d587f4");
+    constexpr uint64_t VALUE{73U};
+    auto maybeChunkHeader = allocate(m_inlineChunkSender, sizeof(uint64_t));
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    *static_cast<uint64_t*>((*maybeChunkHeader)->userPayload()) = VALUE;
+
+    EXPECT_THAT(m_inlineChunkSender.send(*maybeChunkHeader), Eq(1U));
+
+    auto value = popInlineValue(m_inlineChunkQueueData);
+    ASSERT_TRUE(value.has_value());
+    EXPECT_THAT(value.value(), Eq(VALUE));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_FALSE(m_inlineChunkSender.tryGetPreviousChunk().has_value());
+}
+
+TEST_F(ChunkSenderInlineUserPayload_test, SendIncrementsSequenceNumberOfInlineUserPayloads)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e1d487f2-e65e-488f-9c1d-58f5820c56b9");
+    allocateAndSend(m_inlineChunkSender, 1U);
+    allocateAndSend(m_inlineChunkSender, 2U);
+
+    ASSERT_TRUE(popInlineValue(m_inlineChunkQueueData).has_value());
+    const auto firstSequenceNumber = m_lastSequenceNumber;
+    ASSERT_TRUE(popInlineValue(m_inlineChunkQueueData).has_value());
+    EXPECT_THAT(m_lastSequenceNumber, Eq(firstSequenceNumber + 1U));
+}
+
+TEST_F(ChunkSenderInlineUserPayload_test, SendingInlineUserPayloadReleasesPreviousChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "903f6d31-729d-4e20-a1fc-8a35eae10c71");
+    auto maybeChunkHeader = allocate(m_inlineChunkSender, SMALL_CHUNK);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    m_inlineChunkSender.send(*maybeChunkHeader);
+    iox::popo::ChunkQueuePopper<InlineChunkQueueData_t>(&m_inlineChunkQueueData).clear();
+    ASSERT_TRUE(m_inlineChunkSender.tryGetPreviousChunk().has_value());
+
+    allocateAndSend(m_inlineChunkSender, 1U);
+
+    EXPECT_FALSE(m_inlineChunkSender.tryGetPreviousChunk().has_value());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(1).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkSenderInlineUserPayload_test, AllocatingTooManyInlineChunksFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ce80f16e-5cbb-4e57-bedc-cc0387c13d02");
+    for (uint32_t i = 0U; i < iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY; ++i)
+    {
+        EXPECT_FALSE(allocate(m_inlineChunkSender, sizeof(uint64_t)).has_error());
+    }
+
+    auto maybeChunkHeader = allocate(m_inlineChunkSender, sizeof(uint64_t));
+
+    ASSERT_TRUE(maybeChunkHeader.has_error());
+    EXPECT_THAT(maybeChunkHeader.error(), Eq(iox::popo::AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL));
+}
+
+TEST_F(ChunkSenderInlineUserPayload_test, ReleasedInlineChunkCanBeAllocatedAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fae27b84-e34a-4e3d-910c-22d0e2555722");
+    iox::mepoo::ChunkHeader* chunkHeader{nullptr};
+    for (uint32_t i = 0U; i < iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY; ++i)
+    {
+        auto maybeChunkHeader = allocate(m_inlineChunkSender, sizeof(uint64_t));
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        chunkHeader = *maybeChunkHeader;
+    }
+
+    m_inlineChunkSender.release(chunkHeader);
+
+    auto maybeChunkHeader = allocate(m_inlineChunkSender, sizeof(uint64_t));
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(*maybeChunkHeader, Eq(chunkHeader));
+}
+
+TEST_F(ChunkSenderInlineUserPayload_test, ReleasingInlineChunkTwiceFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0c78c4a8-d44f-4115-b6a5-897eed34a46d");
+    auto maybeChunkHeader = allocate(m_inlineChunkSender, sizeof(uint64_t));
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    m_inlineChunkSender.release(*maybeChunkHeader);
+
+    m_inlineChunkSender.release(*maybeChunkHeader);
+
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::POPO__CHUNK_SENDER_INVALID_CHUNK_TO_FREE_FROM_USER);
+}
+
+TEST_F(ChunkSenderInlineUserPayload_test, SendingInlineChunkTwiceFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e2d03f03-494e-4865-b0e6-1ea54c437c25");
+    auto maybeChunkHeader = allocate(m_inlineChunkSender, sizeof(uint64_t));
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    m_inlineChunkSender.send(*maybeChunkHeader);
+
+    EXPECT_THAT(m_inlineChunkSender.send(*maybeChunkHeader), Eq(0U));
+
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::POPO__CHUNK_SENDER_INVALID_CHUNK_TO_SEND_FROM_USER);
+}
+
+TEST_F(ChunkSenderInlineUserPayload_test, HistoryProvidesInlineUserPayloadsToNewQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6ec1d6ef-08be-44a3-8b7b-06358df9d7bf");
+    allocateAndSend(m_inlineChunkSenderWithHistory, 13U);
+    auto maybeChunkHeader = allocate(m_inlineChunkSenderWithHistory, sizeof(uint64_t));
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    *static_cast<uint64_t*>((*maybeChunkHeader)->userPayload()) = 37U;
+    m_inlineChunkSenderWithHistory.pushToHistory(*maybeChunkHeader);
+
+    ASSERT_FALSE(m_inlineChunkSenderWithHistory.tryAddQueue(&m_inlineChunkQueueData, HISTORY_CAPACITY).has_error());
+
+    EXPECT_THAT(m_inlineChunkSenderWithHistory.getHistorySize(), Eq(2U));
+    auto firstValue = popInlineValue(m_inlineChunkQueueData);
+    auto secondValue = popInlineValue(m_inlineChunkQueueData);
+    ASSERT_TRUE(firstValue.has_value());
+    ASSERT_TRUE(secondValue.has_value());
+    EXPECT_THAT(firstValue.value(), Eq(13U));
+    EXPECT_THAT(secondValue.value(), Eq(37U));
+}
+
+TEST_F(ChunkSenderInlineUserPayload_test, HistoryWithInlineUserPayloadsAndChunksReleasesChunksOnCleanup)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8298432f-3cca-4357-bb61-57d77586a730");
+    allocateAndSend(m_inlineChunkSenderWithHistory, 13U);
+    auto maybeChunkHeader = allocate(m_inlineChunkSenderWithHistory, INLINE_USER_PAYLOAD_CAPACITY + 1U);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    m_inlineChunkSenderWithHistory.send(*maybeChunkHeader);
+    for (uint32_t i = 0U; i < iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY; ++i)
+    {
+        EXPECT_FALSE(allocate(m_inlineChunkSenderWithHistory, sizeof(uint64_t)).has_error());
+    }
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+
+    m_inlineChunkSenderWithHistory.releaseAll();
+
+    EXPECT_THAT(m_inlineChunkSenderWithHistory.getHistorySize(), Eq(0U));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_FALSE(allocate(m_inlineChunkSenderWithHistory, sizeof(uint64_t)).has_error());
+}
+
 TEST_F(ChunkSender_test, asStringLiteralConvertsAllocationErrorValuesToStrings)
 {
     ::testing::Test::RecordProperty("TEST_ID", "fdb713e1-0e2c-411e-a3ee-02c216d510d0");
@@ -34,6 +34,7 @@ TEST(ClientOptions_test, SerializationRoundTripIsSuccessful)
     testOptions.connectOnCreate = false;
     testOptions.responseQueueFullPolicy = iox::popo::QueueFullPolicy::BLOCK_PRODUCER;
     testOptions.serverTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    testOptions.loadBalancingPolicy = iox::popo::LoadBalancingPolicy::CONSISTENT_HASH;
 
     iox::popo::ClientOptions::deserialize(testOptions.serialize())
         .and_then([&](auto& roundTripOptions) {
@@ -51,6 +52,9 @@ TEST(ClientOptions_test, SerializationRoundTripIsSuccessful)
 
             EXPECT_THAT(roundTripOptions.serverTooSlowPolicy, Ne(defaultOptions.serverTooSlowPolicy));
             EXPECT_THAT(roundTripOptions.serverTooSlowPolicy, Eq(testOptions.serverTooSlowPolicy));
+
+            EXPECT_THAT(roundTripOptions.loadBalancingPolicy, Ne(defaultOptions.loadBalancingPolicy));
+            EXPECT_THAT(roundTripOptions.loadBalancingPolicy, Eq(testOptions.loadBalancingPolicy));
         })
         .or_else([&](auto&) {
             constexpr bool DESERIALZATION_ERROR_OCCURED{true};
@@ -75,15 +79,23 @@ TEST(ClientOptions_test, DeserializingBogusDataFails)
 
 using QueueFullPolicyUT = std::underlying_type_t<iox::popo::QueueFullPolicy>;
 using ConsumerTooSlowPolicyUT = std::underlying_type_t<iox::popo::ConsumerTooSlowPolicy>;
-iox::Serialization enumSerialization(QueueFullPolicyUT responseQueueFullPolicy,
-                                     ConsumerTooSlowPolicyUT serverTooSlowPolicy)
+using LoadBalancingPolicyUT = std::underlying_type_t<iox::popo::LoadBalancingPolicy>;
+iox::Serialization
+enumSerialization(QueueFullPolicyUT responseQueueFullPolicy,
+                  ConsumerTooSlowPolicyUT serverTooSlowPolicy,
+                  LoadBalancingPolicyUT loadBalancingPolicy =
+                      static_cast<LoadBalancingPolicyUT>(iox::popo::LoadBalancingPolicy::ROUND_ROBIN))
 {
     constexpr uint64_t RESPONSE_QUEUE_CAPACITY{42U};
     const iox::NodeName_t NODE_NAME{"harr-harr"};
     constexpr bool CONNECT_ON_CREATE{true};
 
-    return iox::Serialization::create(
-        RESPONSE_QUEUE_CAPACITY, NODE_NAME, CONNECT_ON_CREATE, responseQueueFullPolicy, serverTooSlowPolicy);
+    return iox::Serialization::create(RESPONSE_QUEUE_CAPACITY,
+                                      NODE_NAME,
+                                      CONNECT_ON_CREATE,
+                                      responseQueueFullPolicy,
+                                      serverTooSlowPolicy,
+                                      loadBalancingPolicy);
 }
 
 TEST(ClientOptions_test, DeserializingValidResponseQueueFullAndServerTooSlowPolicyIsSuccessful)
@@ -144,6 +156,28 @@ TEST(ClientOptions_test, DeserializingInvalidServerTooSlowPolicyFails)
         });
 }
 
+TEST(ClientOptions_test, DeserializingInvalidLoadBalancingPolicyFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3e9b7c21-a4f8-4d56-b0e3-5c8d2f6a1b97");
+    constexpr QueueFullPolicyUT RESPONSE_QUEUE_FULL_POLICY{
+        static_cast<QueueFullPolicyUT>(iox::popo::QueueFullPolicy::BLOCK_PRODUCER)};
+    constexpr ConsumerTooSlowPolicyUT SERVER_TOO_SLOW_POLICY{
+        static_cast<ConsumerTooSlowPolicyUT>(iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER)};
+    constexpr LoadBalancingPolicyUT LOAD_BALANCING_POLICY{111};
+
+    const auto serialized =
+        enumSerialization(RESPONSE_QUEUE_FULL_POLICY, SERVER_TOO_SLOW_POLICY, LOAD_BALANCING_POLICY);
+    iox::popo::ClientOptions::deserialize(serialized)
+        .and_then([&](auto&) {
+            constexpr bool DESERIALZATION_SUCCESSFUL{true};
+            EXPECT_FALSE(DESERIALZATION_SUCCESSFUL);
+        })
+        .or_else([&](auto&) {
+            constexpr bool DESERIALZATION_ERROR_OCCURED{true};
+            EXPECT_TRUE(DESERIALZATION_ERROR_OCCURED);
+        });
+}
+
 TEST(ClientOptions_test, ComparisonOperatorReturnsTrueWhenEqual)
 {
     ::testing::Test::RecordProperty("TEST_ID", "ba0554b8-6b25-45c2-8a4c-66b6663de586");
@@ -215,4 +249,16 @@ TEST(ClientOptions_test, ComparisonOperatorReturnsFalseServerTooSlowPolicyDoesNo
     EXPECT_FALSE(options2 == options1);
 }
 
+TEST(ClientOptions_test, ComparisonOperatorReturnsFalseWhenLoadBalancingPolicyDoesNotMatch)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f6a0d3b8-2e5c-4197-8d4a-b7c1e9f03a62");
+    ClientOptions options1;
+    options1.loadBalancingPolicy = LoadBalancingPolicy::ROUND_ROBIN;
+    ClientOptions options2;
+    options2.loadBalancingPolicy = LoadBalancingPolicy::LEAST_QUEUED;
+
+    EXPECT_FALSE(options1 == options2);
+    EXPECT_FALSE(options2 == options1);
+}
+
 } // namespace
@@ -134,6 +134,36 @@ class ClientPort_test : public Test
         return clientPortForStateTransitionTests.value();
     }
 
+    SutClientPort& initAndGetClientPortConnectedToTwoServers(const LoadBalancingPolicy loadBalancingPolicy)
+    {
+        ClientOptions options = m_clientOptionsWithConnectOnCreate;
+        options.loadBalancingPolicy = loadBalancingPolicy;
+        clientPortForLoadBalancingTests.reset();
+        clientPortForLoadBalancingTests.emplace(m_serviceDescription, m_runtimeName, options, m_memoryManager);
+        auto& sut = clientPortForLoadBalancingTests.value();
+
+        tryAdvanceToState(sut, iox::ConnectionState::CONNECTED);
+
+        CaproMessage serverMessageOffer{CaproMessageType::OFFER, m_serviceDescription};
+        auto clientMessage = sut.portRouDi.dispatchCaProMessageAndGetPossibleResponse(serverMessageOffer);
+        EXPECT_TRUE(clientMessage.has_value());
+
+        CaproMessage serverMessageAck{CaproMessageType::ACK, m_serviceDescription};
+        serverMessageAck.m_chunkQueueData = &otherServerChunkQueueData;
+        sut.portRouDi.dispatchCaProMessageAndGetPossibleResponse(serverMessageAck);
+
+        return sut;
+    }
+
+    void sendRequestWithRoutingKey(SutClientPort& sut, const uint64_t routingKey)
+    {
+        auto allocateResult = sut.portUser.allocateRequest(USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT);
+        ASSERT_FALSE(allocateResult.has_error());
+        auto* requestHeader = allocateResult.value();
+        requestHeader->setRoutingKey(routingKey);
+        EXPECT_FALSE(sut.portUser.sendRequest(requestHeader).has_error());
+    }
+
     uint32_t getNumberOfUsedChunks() const
     {
         return m_memoryManager.getMemPoolInfo(0U).m_usedChunks;
@@ -207,6 +237,7 @@ class ClientPort_test : public Test
     }();
 
     iox::optional<SutClientPort> clientPortForStateTransitionTests;
+    iox::optional<SutClientPort> clientPortForLoadBalancingTests;
 
   public:
     static constexpr uint64_t USER_PAYLOAD_SIZE{32U};
@@ -215,6 +246,9 @@ class ClientPort_test : public Test
     ServerChunkQueueData_t serverChunkQueueData{iox::popo::QueueFullPolicy::DISCARD_OLDEST_DATA,
                                                 iox::popo::VariantQueueTypes::SoFi_MultiProducerSingleConsumer};
     ChunkQueuePopper<ServerChunkQueueData_t> serverRequestQueue{&serverChunkQueueData};
+    ServerChunkQueueData_t otherServerChunkQueueData{iox::popo::QueueFullPolicy::DISCARD_OLDEST_DATA,
+                                                     iox::popo::VariantQueueTypes::SoFi_MultiProducerSingleConsumer};
+    ChunkQueuePopper<ServerChunkQueueData_t> otherServerRequestQueue{&otherServerChunkQueueData};
 
     SutClientPort clientPortWithConnectOnCreate{
         m_serviceDescription, m_runtimeName, m_clientOptionsWithConnectOnCreate, m_memoryManager};
@@ -319,6 +353,72 @@ TEST_F(ClientPort_test, SendRequestOnConnectedClientPortEnqueuesRequestToServerQ
         });
 }
 
+TEST_F(ClientPort_test, SendRequestWithRoundRobinPolicyDistributesRequestsEvenlyToAllServers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5b0f2c7e-8d14-4a36-9e51-c3a7d2f08b69");
+    constexpr uint64_t NUMBER_OF_REQUESTS_PER_SERVER{3U};
+    auto& sut = initAndGetClientPortConnectedToTwoServers(LoadBalancingPolicy::ROUND_ROBIN);
+
+    for (uint64_t i = 0U; i < 2U * NUMBER_OF_REQUESTS_PER_SERVER; ++i)
+    {
+        sendRequestWithRoutingKey(sut, 0U);
+    }
+
+    EXPECT_THAT(serverRequestQueue.size(), Eq(NUMBER_OF_REQUESTS_PER_SERVER));
+    EXPECT_THAT(otherServerRequestQueue.size(), Eq(NUMBER_OF_REQUESTS_PER_SERVER));
+}
+
+TEST_F(ClientPort_test, SendRequestWithLeastQueuedPolicySendsRequestsToServerWithFewestQueuedRequests)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e2a94d1b-6f37-4c08-b5d3-79c1e8a4f026");
+    constexpr uint64_t NUMBER_OF_QUEUED_REQUESTS{2U};
+    auto& sut = initAndGetClientPortConnectedToTwoServers(LoadBalancingPolicy::LEAST_QUEUED);
+
+    ChunkQueuePusher<ServerChunkQueueData_t> serverRequestQueuePusher{&serverChunkQueueData};
+    for (uint64_t i = 0U; i < NUMBER_OF_QUEUED_REQUESTS; ++i)
+    {
+        ASSERT_TRUE(serverRequestQueuePusher.push(getChunkFromMemoryManager(USER_PAYLOAD_SIZE, sizeof(RequestHeader))));
+    }
+
+    for (uint64_t i = 0U; i < NUMBER_OF_QUEUED_REQUESTS; ++i)
+    {
+        sendRequestWithRoutingKey(sut, 0U);
+    }
+    EXPECT_THAT(serverRequestQueue.size(), Eq(NUMBER_OF_QUEUED_REQUESTS));
+    EXPECT_THAT(otherServerRequestQueue.size(), Eq(NUMBER_OF_QUEUED_REQUESTS));
+
+    sendRequestWithRoutingKey(sut, 0U);
+    sendRequestWithRoutingKey(sut, 0U);
+    EXPECT_THAT(serverRequestQueue.size(), Eq(NUMBER_OF_QUEUED_REQUESTS + 1U));
+    EXPECT_THAT(otherServerRequestQueue.size(), Eq(NUMBER_OF_QUEUED_REQUESTS + 1U));
+}
+
+TEST_F(ClientPort_test, SendRequestWithConsistentHashPolicySendsRequestsWithSameRoutingKeyToSameServer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9c6e3a85-1d2f-47b0-a8e4-0f5b7d3c29a1");
+    constexpr uint64_t NUMBER_OF_ROUTING_KEYS{32U};
+    auto& sut = initAndGetClientPortConnectedToTwoServers(LoadBalancingPolicy::CONSISTENT_HASH);
+
+    uint64_t numberOfKeysOfServer{0U};
+    for (uint64_t routingKey = 0U; routingKey < NUMBER_OF_ROUTING_KEYS; ++routingKey)
+    {
+        sendRequestWithRoutingKey(sut, routingKey);
+        sendRequestWithRoutingKey(sut, routingKey);
+
+        const auto requestsOfServer = serverRequestQueue.size();
+        const auto requestsOfOtherServer = otherServerRequestQueue.size();
+        EXPECT_TRUE((requestsOfServer == 2U && requestsOfOtherServer == 0U)
+                    || (requestsOfServer == 0U && requestsOfOtherServer == 2U));
+        numberOfKeysOfServer += (requestsOfServer == 2U) ? 1U : 0U;
+
+        serverRequestQueue.clear();
+        otherServerRequestQueue.clear();
+    }
+
+    EXPECT_THAT(numberOfKeysOfServer, Gt(0U));
+    EXPECT_THAT(numberOfKeysOfServer, Lt(NUMBER_OF_ROUTING_KEYS));
+}
+
 TEST_F(ClientPort_test,
        SendRequestOnNotConnectedClientPortDoesNotEnqueuesRequestToServerQueueAndReleasesTheChunkToTheMempool)
 {
@@ -749,6 +849,21 @@ TEST_F(ClientPort_test, StateNotConnectedWithCaProMessageTypeOfferRemainsInState
     ASSERT_FALSE(responseCaproMessage.has_value());
 }
 
+TEST_F(ClientPort_test, StateNotConnectedWithCaProMessageTypeAckAndNackRemainsInStateNotConnected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0f3d8b6a-2c71-4e95-b4a8-6d1e9c5f7a32");
+    auto& sut = initAndGetClientPortForStateTransitionTests();
+
+    for (auto caproMessageType : {CaproMessageType::ACK, CaproMessageType::NACK})
+    {
+        auto caproMessage = CaproMessage{caproMessageType, sut.portData.m_serviceDescription};
+        auto responseCaproMessage = sut.portRouDi.dispatchCaProMessageAndGetPossibleResponse(caproMessage);
+
+        EXPECT_THAT(sut.portUser.getConnectionState(), Eq(iox::ConnectionState::NOT_CONNECTED));
+        ASSERT_FALSE(responseCaproMessage.has_value());
+    }
+}
+
 TEST_F(ClientPort_test, StateNotConnectedWithCaProMessageTypeConnectTransitionsToStateConnectRequested)
 {
     ::testing::Test::RecordProperty("TEST_ID", "72c72160-f53e-4062-90cb-b7a51017b5be");
@@ -825,6 +940,88 @@ TEST_F(ClientPort_test, StateWaitForOfferWithCaProMessageTypeOfferTransitionsToS
     EXPECT_THAT(responseCaproMessage->m_chunkQueueData, Eq(&sut.portData.m_chunkReceiverData));
 }
 
+TEST_F(ClientPort_test, StateWaitForOfferWithCaProMessageTypeAckTransitionsToStateConnected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b86c1f47-3a9e-4d20-8f5b-2e7a0c4d91e8");
+    auto& sut = initAndGetClientPortForStateTransitionTests();
+    sut.portUser.connect();
+    tryAdvanceToState(sut, iox::ConnectionState::WAIT_FOR_OFFER);
+
+    auto caproMessage = CaproMessage{CaproMessageType::ACK, sut.portData.m_serviceDescription};
+    caproMessage.m_chunkQueueData = &serverChunkQueueData;
+
+    auto responseCaproMessage = sut.portRouDi.dispatchCaProMessageAndGetPossibleResponse(caproMessage);
+
+    EXPECT_THAT(sut.portUser.getConnectionState(), Eq(iox::ConnectionState::CONNECTED));
+    ASSERT_FALSE(responseCaproMessage.has_value());
+}
+
+TEST_F(ClientPort_test, StateWaitForOfferWithCaProMessageTypeNackRemainsInStateWaitForOffer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4e7a2d90-c5b3-41f8-9a6e-d03b8f1c5e74");
+    auto& sut = initAndGetClientPortForStateTransitionTests();
+    sut.portUser.connect();
+    tryAdvanceToState(sut, iox::ConnectionState::WAIT_FOR_OFFER);
+
+    auto caproMessage = CaproMessage{CaproMessageType::NACK, sut.portData.m_serviceDescription};
+    auto responseCaproMessage = sut.portRouDi.dispatchCaProMessageAndGetPossibleResponse(caproMessage);
+
+    EXPECT_THAT(sut.portUser.getConnectionState(), Eq(iox::ConnectionState::WAIT_FOR_OFFER));
+    ASSERT_FALSE(responseCaproMessage.has_value());
+}
+
+TEST_F(ClientPort_test, StateConnectedWithCaProMessageTypeOfferRemainsInStateConnectedAndRespondsWithConnect)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d1f95b3c-7e08-4a6d-b2c4-8a3e6f0d7b15");
+    auto& sut = initAndGetClientPortForStateTransitionTests();
+    sut.portUser.connect();
+    tryAdvanceToState(sut, iox::ConnectionState::CONNECTED);
+
+    auto caproMessage = CaproMessage{CaproMessageType::OFFER, sut.portData.m_serviceDescription};
+    auto responseCaproMessage = sut.portRouDi.dispatchCaProMessageAndGetPossibleResponse(caproMessage);
+
+    EXPECT_THAT(sut.portUser.getConnectionState(), Eq(iox::ConnectionState::CONNECTED));
+    ASSERT_TRUE(responseCaproMessage.has_value());
+    EXPECT_THAT(responseCaproMessage->m_type, Eq(iox::capro::CaproMessageType::CONNECT));
+    EXPECT_THAT(responseCaproMessage->m_chunkQueueData, Eq(&sut.portData.m_chunkReceiverData));
+}
+
+TEST_F(ClientPort_test, StateConnectedWithCaProMessageTypeAckAndNackRemainsInStateConnected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7a2e5c19-b4d6-4f83-a0e7-1c9d8b3f6a24");
+    auto& sut = initAndGetClientPortForStateTransitionTests();
+    sut.portUser.connect();
+    tryAdvanceToState(sut, iox::ConnectionState::CONNECTED);
+
+    for (auto caproMessageType : {CaproMessageType::ACK, CaproMessageType::NACK})
+    {
+        auto caproMessage = CaproMessage{caproMessageType, sut.portData.m_serviceDescription};
+        caproMessage.m_chunkQueueData = &otherServerChunkQueueData;
+        auto responseCaproMessage = sut.portRouDi.dispatchCaProMessageAndGetPossibleResponse(caproMessage);
+
+        EXPECT_THAT(sut.portUser.getConnectionState(), Eq(iox::ConnectionState::CONNECTED));
+        ASSERT_FALSE(responseCaproMessage.has_value());
+    }
+}
+
+TEST_F(ClientPort_test, StateConnectedWithCaProMessageTypeStopOfferOfOneOfMultipleServersRemainsInStateConnected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c3b8f0e6-5a1d-4972-8e4b-f6d2a9c07e53");
+    auto& sut = initAndGetClientPortConnectedToTwoServers(LoadBalancingPolicy::ROUND_ROBIN);
+
+    auto caproMessage = CaproMessage{CaproMessageType::STOP_OFFER, sut.portData.m_serviceDescription};
+    caproMessage.m_chunkQueueData = &otherServerChunkQueueData;
+    auto responseCaproMessage = sut.portRouDi.dispatchCaProMessageAndGetPossibleResponse(caproMessage);
+
+    EXPECT_THAT(sut.portUser.getConnectionState(), Eq(iox::ConnectionState::CONNECTED));
+    ASSERT_FALSE(responseCaproMessage.has_value());
+
+    sendRequestWithRoutingKey(sut, 0U);
+    sendRequestWithRoutingKey(sut, 0U);
+    EXPECT_THAT(serverRequestQueue.size(), Eq(2U));
+    EXPECT_THAT(otherServerRequestQueue.size(), Eq(0U));
+}
+
 TEST_F(ClientPort_test, StateConnectedWithCaProMessageTypeStopOfferTransitionsToStateWaitForOffer)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4c07d376-f316-4805-9a91-575289beae94");
@@ -919,7 +1116,8 @@ TEST_F(ClientPort_test, InvalidStateTransitionsCallErrorHandler)
             switch (targetState)
             {
             case iox::ConnectionState::NOT_CONNECTED:
-                if (caproMessageType == CaproMessageType::CONNECT || caproMessageType == CaproMessageType::OFFER)
+                if (caproMessageType == CaproMessageType::CONNECT || caproMessageType == CaproMessageType::OFFER
+                    || caproMessageType == CaproMessageType::ACK || caproMessageType == CaproMessageType::NACK)
                 {
                     continue;
                 }
@@ -931,14 +1129,16 @@ TEST_F(ClientPort_test, InvalidStateTransitionsCallErrorHandler)
                 }
                 break;
             case iox::ConnectionState::WAIT_FOR_OFFER:
-                if (caproMessageType == CaproMessageType::DISCONNECT || caproMessageType == CaproMessageType::OFFER)
+                if (caproMessageType == CaproMessageType::DISCONNECT || caproMessageType == CaproMessageType::OFFER
+                    || caproMessageType == CaproMessageType::ACK || caproMessageType == CaproMessageType::NACK)
                 {
                     continue;
                 }
                 break;
             case iox::ConnectionState::CONNECTED:
-                if (caproMessageType == CaproMessageType::STOP_OFFER
-                    || caproMessageType == CaproMessageType::DISCONNECT)
+                if (caproMessageType == CaproMessageType::STOP_OFFER || caproMessageType == CaproMessageType::DISCONNECT
+                    || caproMessageType == CaproMessageType::OFFER || caproMessageType == CaproMessageType::ACK
+                    || caproMessageType == CaproMessageType::NACK)
                 {
                     continue;
                 }
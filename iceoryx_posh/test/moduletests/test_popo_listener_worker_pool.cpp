@@ -0,0 +1,235 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/listener_worker_pool.hpp"
+#include "iceoryx_posh/popo/listener.hpp"
+#include "iceoryx_posh/popo/user_trigger.hpp"
+#include "iox/optional.hpp"
+#include "test.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::popo;
+using namespace iox::units::duration_literals;
+
+void waitUntil(const std::function<bool()>& condition)
+{
+    while (!condition())
+    {
+        std::this_thread::yield();
+    }
+}
+
+class ListenerWorkerPool_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        m_watchdog.watchAndActOnFailure([] { std::terminate(); });
+    }
+
+    void createSut(const uint64_t numberOfWorkers, const ListenerWorkerPool::Execute_t& execute)
+    {
+        vector<ListenerWorkerOptions, ListenerWorkerPool::MAX_NUMBER_OF_WORKERS> workerOptions;
+        for (uint64_t i = 0U; i < numberOfWorkers; ++i)
+        {
+            workerOptions.emplace_back();
+        }
+        m_sut.emplace(workerOptions, execute);
+    }
+
+    Watchdog m_watchdog{2_s};
+    optional<ListenerWorkerPool> m_sut;
+};
+
+TEST_F(ListenerWorkerPool_test, NumberOfWorkersEqualsNumberOfWorkerOptions)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2f0d5b1c-8a6e-4e0f-9d5c-1f3b7e8a9c21");
+    createSut(3U, [](auto) {});
+
+    EXPECT_THAT(m_sut->numberOfWorkers(), Eq(3U));
+}
+
+TEST_F(ListenerWorkerPool_test, DispatchedEventIsExecuted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9b6a3e2d-4c1f-4f7a-8b0e-5d2c6a1f3e47");
+    constexpr uint32_t EVENT_INDEX = 13U;
+    std::atomic<uint32_t> executedIndex{0U};
+    createSut(2U, [&](auto index) { executedIndex = index; });
+
+    m_sut->dispatch(EVENT_INDEX);
+
+    waitUntil([&] { return executedIndex.load() == EVENT_INDEX; });
+    EXPECT_THAT(executedIndex.load(), Eq(EVENT_INDEX));
+}
+
+TEST_F(ListenerWorkerPool_test, DifferentEventsAreExecutedConcurrently)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c7e1a9f4-2b3d-4e6c-9a8f-0d1e2f3a4b5c");
+    std::atomic<uint64_t> numberOfRunningCallbacks{0U};
+    createSut(2U, [&](auto) {
+        ++numberOfRunningCallbacks;
+        // returns only when both callbacks are running at the same time, otherwise the watchdog terminates the test
+        waitUntil([&] { return numberOfRunningCallbacks.load() == 2U; });
+    });
+
+    m_sut->dispatch(0U);
+    m_sut->dispatch(1U);
+    waitUntil([&] { return numberOfRunningCallbacks.load() == 2U; });
+    m_sut.reset();
+
+    EXPECT_THAT(numberOfRunningCallbacks.load(), Eq(2U));
+}
+
+TEST_F(ListenerWorkerPool_test, SameEventIsNeverExecutedConcurrently)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5a4b3c2d-1e0f-4a9b-8c7d-6e5f4a3b2c1d");
+    constexpr uint64_t NUMBER_OF_DISPATCHES = 1000U;
+    std::atomic<uint64_t> numberOfRunningCallbacks{0U};
+    std::atomic<uint64_t> maxNumberOfRunningCallbacks{0U};
+    std::atomic<uint64_t> numberOfExecutions{0U};
+    createSut(4U, [&](auto) {
+        auto running = ++numberOfRunningCallbacks;
+        auto maxRunning = maxNumberOfRunningCallbacks.load();
+        while (running > maxRunning && !maxNumberOfRunningCallbacks.compare_exchange_weak(maxRunning, running))
+        {
+        }
+        std::this_thread::yield();
+        --numberOfRunningCallbacks;
+        ++numberOfExecutions;
+    });
+
+    for (uint64_t i = 0U; i < NUMBER_OF_DISPATCHES; ++i)
+    {
+        m_sut->dispatch(0U);
+    }
+    waitUntil([&] { return numberOfExecutions.load() > 0U && numberOfRunningCallbacks.load() == 0U; });
+    m_sut.reset();
+
+    EXPECT_THAT(maxNumberOfRunningCallbacks.load(), Eq(1U));
+    EXPECT_THAT(numberOfExecutions.load(), Le(NUMBER_OF_DISPATCHES));
+}
+
+TEST_F(ListenerWorkerPool_test, EventDispatchedWhileExecutingIsExecutedAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e8d7c6b5-a4f3-4e2d-b1c0-9f8e7d6c5b4a");
+    std::atomic_bool isCallbackBlocked{true};
+    std::atomic<uint64_t> numberOfExecutions{0U};
+    createSut(2U, [&](auto) {
+        ++numberOfExecutions;
+        waitUntil([&] { return !isCallbackBlocked.load(); });
+    });
+
+    m_sut->dispatch(7U);
+    waitUntil([&] { return numberOfExecutions.load() == 1U; });
+    m_sut->dispatch(7U);
+    m_sut->dispatch(7U);
+    isCallbackBlocked = false;
+
+    waitUntil([&] { return numberOfExecutions.load() == 2U; });
+    m_sut.reset();
+
+    EXPECT_THAT(numberOfExecutions.load(), Eq(2U));
+}
+
+std::atomic<uint64_t> g_numberOfCallbackCalls{0U};
+
+void countingCallback(UserTrigger* const)
+{
+    ++g_numberOfCallbackCalls;
+}
+
+class TestListener : public Listener
+{
+  public:
+    TestListener(ConditionVariableData& data, const ListenerOptions& options) noexcept
+        : Listener(data, options)
+    {
+    }
+};
+
+TEST_F(ListenerWorkerPool_test, ListenerWithWorkersExecutesCallbacksOfTriggeredEvents)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1d2c3b4a-5f6e-4d7c-8b9a-0f1e2d3c4b5a");
+    g_numberOfCallbackCalls = 0U;
+    ConditionVariableData condVarData{"Schwaebische Eisenbahn"};
+    ListenerOptions options;
+    options.workerThreads.emplace_back();
+    options.workerThreads.emplace_back();
+    optional<TestListener> listener;
+    listener.emplace(condVarData, options);
+
+    UserTrigger trigger1;
+    UserTrigger trigger2;
+    ASSERT_FALSE(listener->attachEvent(trigger1, createNotificationCallback(countingCallback)).has_error());
+    ASSERT_FALSE(listener->attachEvent(trigger2, createNotificationCallback(countingCallback)).has_error());
+
+    trigger1.trigger();
+    waitUntil([&] { return g_numberOfCallbackCalls.load() == 1U; });
+    trigger2.trigger();
+    waitUntil([&] { return g_numberOfCallbackCalls.load() == 2U; });
+
+    listener->detachEvent(trigger1);
+    listener->detachEvent(trigger2);
+    listener.reset();
+
+    EXPECT_THAT(g_numberOfCallbackCalls.load(), Eq(2U));
+}
+
+#if defined(__linux__)
+std::atomic<int> g_cpuOfCallback{-1};
+
+void storeCpuOfCallback(UserTrigger* const)
+{
+    g_cpuOfCallback = sched_getcpu();
+}
+
+TEST_F(ListenerWorkerPool_test, ListenerThreadAppliesTheThreadSchedulingParameters)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8e4b1d7a-3c9f-4e2b-a5d8-6f1c3e9b2a47");
+    constexpr uint64_t CPU_0_MASK = 1U;
+    g_cpuOfCallback = -1;
+    ConditionVariableData condVarData{"Schwaebische Eisenbahn"};
+    ListenerOptions options;
+    options.threadSchedulingParameters.cpuAffinityMask = CPU_0_MASK;
+    optional<TestListener> listener;
+    listener.emplace(condVarData, options);
+
+    UserTrigger trigger;
+    ASSERT_FALSE(listener->attachEvent(trigger, createNotificationCallback(storeCpuOfCallback)).has_error());
+    trigger.trigger();
+    waitUntil([&] { return g_cpuOfCallback.load() != -1; });
+
+    listener->detachEvent(trigger);
+    listener.reset();
+
+    EXPECT_THAT(g_cpuOfCallback.load(), Eq(0));
+}
+#endif
+
+} // namespace
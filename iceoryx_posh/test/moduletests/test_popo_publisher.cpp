@@ -21,6 +21,8 @@
 
 #include "test.hpp"
 
+#include <limits>
+
 namespace
 {
 using namespace ::testing;
@@ -314,4 +316,173 @@ TEST_F(PublisherTest, GetServiceDescriptionCallForwardedToUnderlyingPublisherPor
     sut.getServiceDescription();
 }
 
+constexpr uint64_t NUMBER_OF_ELEMENTS{4U};
+
+using TestSlicePublisher =
+    iox::popo::PublisherImpl<DummyData[], iox::mepoo::NoUserHeader, MockBasePublisher<DummyData>>;
+
+class SlicePublisherTest : public Test
+{
+  protected:
+    ChunkMock<DummyData[NUMBER_OF_ELEMENTS]> chunkMock;
+    TestSlicePublisher sut{{"", "", ""}};
+    MockPublisherPortUser& portMock{sut.mockPort()};
+};
+
+TEST_F(SlicePublisherTest, LoansChunkLargeEnoughForTheNumberOfElements)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f260d6be-fa37-471d-9912-ed8123afb42d");
+    EXPECT_CALL(portMock, tryAllocateChunk(NUMBER_OF_ELEMENTS * sizeof(DummyData), alignof(DummyData), _, _))
+        .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))));
+    // ===== Test ===== //
+    auto result = sut.loan(NUMBER_OF_ELEMENTS);
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value().size(), NUMBER_OF_ELEMENTS);
+    EXPECT_FALSE(result.value().empty());
+    EXPECT_CALL(portMock, releaseChunk(chunkMock.chunkHeader()));
+    // ===== Cleanup ===== //
+}
+
+TEST_F(SlicePublisherTest, LoanedSliceElementsAreDefaultInitialized)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "12ec9086-0b70-487b-9221-253acb14392b");
+    EXPECT_CALL(portMock, tryAllocateChunk(NUMBER_OF_ELEMENTS * sizeof(DummyData), _, _, _))
+        .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))));
+    // ===== Test ===== //
+    auto result = sut.loan(NUMBER_OF_ELEMENTS);
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    for (const auto& element : result.value())
+    {
+        EXPECT_EQ(element.val, DummyData::defaultVal());
+    }
+    EXPECT_CALL(portMock, releaseChunk(chunkMock.chunkHeader()));
+    // ===== Cleanup ===== //
+}
+
+TEST_F(SlicePublisherTest, LoanWithArgumentsCallsCustomCtorForEachElement)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1715193e-c36c-449f-a88f-d21b3bfd4f38");
+    constexpr uint64_t CUSTOM_VALUE{73};
+    EXPECT_CALL(portMock, tryAllocateChunk(NUMBER_OF_ELEMENTS * sizeof(DummyData), _, _, _))
+        .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))));
+    // ===== Test ===== //
+    auto result = sut.loan(NUMBER_OF_ELEMENTS, CUSTOM_VALUE);
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    for (uint64_t i = 0U; i < NUMBER_OF_ELEMENTS; ++i)
+    {
+        EXPECT_EQ(result.value()[i].val, CUSTOM_VALUE);
+    }
+    EXPECT_CALL(portMock, releaseChunk(chunkMock.chunkHeader()));
+    // ===== Cleanup ===== //
+}
+
+TEST_F(SlicePublisherTest, LoaningSliceWhichExceedsTheAddressableSizeFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "643a9fbd-3971-45c8-92f6-3ede1317550e");
+    EXPECT_CALL(portMock, tryAllocateChunk(_, _, _, _)).Times(0);
+    // ===== Test ===== //
+    auto result = sut.loan(std::numeric_limits<uint64_t>::max() / sizeof(DummyData) + 1U);
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(result.error(), iox::popo::AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
+}
+
+TEST_F(SlicePublisherTest, LoanFailsWhenPortFailsToAllocate)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d9424073-004b-45b5-9777-04b42b3d3c58");
+    EXPECT_CALL(portMock, tryAllocateChunk(_, _, _, _))
+        .WillOnce(Return(ByMove(iox::err(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS))));
+    // ===== Test ===== //
+    auto result = sut.loan(NUMBER_OF_ELEMENTS);
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(result.error(), iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS);
+}
+
+TEST_F(SlicePublisherTest, ShrinkReducesNumberOfElementsAndUserPayloadSize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9d473e10-946d-497a-986c-ff990c586cc9");
+    constexpr uint64_t NEW_NUMBER_OF_ELEMENTS{1U};
+    EXPECT_CALL(portMock, tryAllocateChunk(NUMBER_OF_ELEMENTS * sizeof(DummyData), _, _, _))
+        .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))));
+    auto result = sut.loan(NUMBER_OF_ELEMENTS);
+    ASSERT_FALSE(result.has_error());
+    // ===== Test ===== //
+    EXPECT_TRUE(result.value().shrink(NEW_NUMBER_OF_ELEMENTS));
+    // ===== Verify ===== //
+    EXPECT_EQ(result.value().size(), NEW_NUMBER_OF_ELEMENTS);
+    EXPECT_EQ(static_cast<uint64_t>(result.value().end() - result.value().begin()), NEW_NUMBER_OF_ELEMENTS);
+    EXPECT_EQ(chunkMock.chunkHeader()->userPayloadSize(), NEW_NUMBER_OF_ELEMENTS * sizeof(DummyData));
+    EXPECT_CALL(portMock, releaseChunk(chunkMock.chunkHeader()));
+    // ===== Cleanup ===== //
+}
+
+TEST_F(SlicePublisherTest, ShrinkToZeroElementsResultsInEmptySlice)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "40614799-5077-4928-9a7b-734e7bb9a316");
+    EXPECT_CALL(portMock, tryAllocateChunk(NUMBER_OF_ELEMENTS * sizeof(DummyData), _, _, _))
+        .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))));
+    auto result = sut.loan(NUMBER_OF_ELEMENTS);
+    ASSERT_FALSE(result.has_error());
+    // ===== Test ===== //
+    EXPECT_TRUE(result.value().shrink(0U));
+    // ===== Verify ===== //
+    EXPECT_TRUE(result.value().empty());
+    EXPECT_EQ(chunkMock.chunkHeader()->userPayloadSize(), 0U);
+    EXPECT_CALL(portMock, releaseChunk(chunkMock.chunkHeader()));
+    // ===== Cleanup ===== //
+}
+
+TEST_F(SlicePublisherTest, ShrinkBeyondTheCurrentNumberOfElementsFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3aff814b-24cc-4284-b731-bc63bbb0503c");
+    EXPECT_CALL(portMock, tryAllocateChunk(NUMBER_OF_ELEMENTS * sizeof(DummyData), _, _, _))
+        .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))));
+    auto result = sut.loan(NUMBER_OF_ELEMENTS);
+    ASSERT_FALSE(result.has_error());
+    // ===== Test ===== //
+    EXPECT_FALSE(result.value().shrink(NUMBER_OF_ELEMENTS + 1U));
+    // ===== Verify ===== //
+    EXPECT_EQ(result.value().size(), NUMBER_OF_ELEMENTS);
+    EXPECT_EQ(chunkMock.chunkHeader()->userPayloadSize(), NUMBER_OF_ELEMENTS * sizeof(DummyData));
+    EXPECT_CALL(portMock, releaseChunk(chunkMock.chunkHeader()));
+    // ===== Cleanup ===== //
+}
+
+TEST_F(SlicePublisherTest, PublishingShrunkSliceSendsTheChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "50dc7922-3b7b-4615-b733-bb3353740e41");
+    EXPECT_CALL(portMock, tryAllocateChunk(NUMBER_OF_ELEMENTS * sizeof(DummyData), _, _, _))
+        .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))));
+    EXPECT_CALL(portMock, sendChunk(chunkMock.chunkHeader()));
+    EXPECT_CALL(portMock, releaseChunk(_)).Times(0);
+    auto result = sut.loan(NUMBER_OF_ELEMENTS);
+    ASSERT_FALSE(result.has_error());
+    ASSERT_TRUE(result.value().shrink(2U));
+    // ===== Test ===== //
+    result.value().publish();
+    // ===== Verify ===== //
+    EXPECT_FALSE(result.value());
+}
+
+TEST_F(SlicePublisherTest, PublishCopyOfCopiesTheElementsAndPublishes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fd6a455a-237f-4e44-834e-a7d4c058533e");
+    const DummyData elements[NUMBER_OF_ELEMENTS]{DummyData(1U), DummyData(2U), DummyData(3U), DummyData(4U)};
+    EXPECT_CALL(portMock, tryAllocateChunk(NUMBER_OF_ELEMENTS * sizeof(DummyData), _, _, _))
+        .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))));
+    EXPECT_CALL(portMock, sendChunk(chunkMock.chunkHeader()));
+    // ===== Test ===== //
+    auto result = sut.publishCopyOf(elements, NUMBER_OF_ELEMENTS);
+    // ===== Verify ===== //
+    EXPECT_FALSE(result.has_error());
+    for (uint64_t i = 0U; i < NUMBER_OF_ELEMENTS; ++i)
+    {
+        EXPECT_EQ((*chunkMock.sample())[i].val, elements[i].val);
+    }
+}
+
 } // namespace
@@ -34,6 +34,8 @@ TEST(ServerOptions_test, SerializationRoundTripIsSuccessful)
     testOptions.offerOnCreate = false;
     testOptions.requestQueueFullPolicy = iox::popo::QueueFullPolicy::BLOCK_PRODUCER;
     testOptions.clientTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    testOptions.concurrentRequestProcessing = true;
+    testOptions.allowMultipleServers = true;
 
     iox::popo::ServerOptions::deserialize(testOptions.serialize())
         .and_then([&](auto& roundTripOptions) {
@@ -51,6 +53,12 @@ TEST(ServerOptions_test, SerializationRoundTripIsSuccessful)
 
             EXPECT_THAT(roundTripOptions.clientTooSlowPolicy, Ne(defaultOptions.clientTooSlowPolicy));
             EXPECT_THAT(roundTripOptions.clientTooSlowPolicy, Eq(testOptions.clientTooSlowPolicy));
+
+            EXPECT_THAT(roundTripOptions.concurrentRequestProcessing, Ne(defaultOptions.concurrentRequestProcessing));
+            EXPECT_THAT(roundTripOptions.concurrentRequestProcessing, Eq(testOptions.concurrentRequestProcessing));
+
+            EXPECT_THAT(roundTripOptions.allowMultipleServers, Ne(defaultOptions.allowMultipleServers));
+            EXPECT_THAT(roundTripOptions.allowMultipleServers, Eq(testOptions.allowMultipleServers));
         })
         .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of ServerOptions failed!"; });
 }
@@ -72,9 +80,16 @@ iox::Serialization enumSerialization(QueueFullPolicyUT requsetQueueFullPolicy,
     constexpr uint64_t REQUEST_QUEUE_CAPACITY{42U};
     const iox::NodeName_t NODE_NAME{"harr-harr"};
     constexpr bool OFFER_ON_CREATE{true};
-
-    return iox::Serialization::create(
-        REQUEST_QUEUE_CAPACITY, NODE_NAME, OFFER_ON_CREATE, requsetQueueFullPolicy, clientTooSlowPolicy);
+    constexpr bool CONCURRENT_REQUEST_PROCESSING{true};
+    constexpr bool ALLOW_MULTIPLE_SERVERS{true};
+
+    return iox::Serialization::create(REQUEST_QUEUE_CAPACITY,
+                                      NODE_NAME,
+                                      OFFER_ON_CREATE,
+                                      requsetQueueFullPolicy,
+                                      clientTooSlowPolicy,
+                                      CONCURRENT_REQUEST_PROCESSING,
+                                      ALLOW_MULTIPLE_SERVERS);
 }
 
 TEST(ServerOptions_test, DeserializingValidRequestQueueFullPolicyAndClientTooSlowPolicyIsSuccessful)
@@ -188,4 +203,28 @@ TEST(ServerOptions_test, ComparisonOperatorReturnsFalseClientTooSlowPolicyDoesNo
     EXPECT_FALSE(options2 == options1);
 }
 
+TEST(ServerOptions_test, ComparisonOperatorReturnsFalseConcurrentRequestProcessingDoesNotMatch)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0c5e8f1a-3b7d-4a92-b6e4-2d9f8c1a7e53");
+    ServerOptions options1;
+    options1.concurrentRequestProcessing = true;
+    ServerOptions options2;
+    options2.concurrentRequestProcessing = false;
+
+    EXPECT_FALSE(options1 == options2);
+    EXPECT_FALSE(options2 == options1);
+}
+
+TEST(ServerOptions_test, ComparisonOperatorReturnsFalseAllowMultipleServersDoesNotMatch)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8d4f1e62-9b3a-4c07-a5e8-6f2b0d7c3e91");
+    ServerOptions options1;
+    options1.allowMultipleServers = true;
+    ServerOptions options2;
+    options2.allowMultipleServers = false;
+
+    EXPECT_FALSE(options1 == options2);
+    EXPECT_FALSE(options2 == options1);
+}
+
 } // namespace
@@ -111,6 +111,7 @@ TEST_F(ServerPort_test, TryGetCaProMessageOnStopOfferWhenPortIsOffering)
         .and_then([&](const auto& caproMessage) {
             EXPECT_THAT(caproMessage.m_type, Eq(CaproMessageType::STOP_OFFER));
             EXPECT_THAT(caproMessage.m_serviceType, Eq(CaproServiceType::SERVER));
+            EXPECT_THAT(caproMessage.m_chunkQueueData, Eq(&sut.portData.m_chunkReceiverData));
         })
         .or_else([&]() { GTEST_FAIL() << "Expected CaPro message but got none"; });
 }
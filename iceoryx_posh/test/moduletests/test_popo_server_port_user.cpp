@@ -20,6 +20,10 @@
 
 #include "iceoryx_hoofs/testing/error_reporting/testing_support.hpp"
 
+#include <algorithm>
+#include <thread>
+#include <vector>
+
 namespace iox_test_popo_server_port
 {
 // NOTE tests related to QueueFullPolicy are done in test_client_server.cpp integration test
@@ -719,6 +723,70 @@ TEST_F(ServerPort_test, SendResponseWithValidClientQueueIdReleasesDeliversToTheC
 
 // END sendResponse tests
 
+// BEGIN concurrent request processing tests
+
+TEST_F(ServerPort_test, RequestsCanBeProcessedByMultipleThreadsConcurrently)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7d1b3e5f-9a2c-4e8d-b6f0-1c3a5e7d9b2f");
+    auto& sut = serverPortWithConcurrentRequestProcessing;
+    addClientQueue(sut);
+
+    constexpr uint64_t NUMBER_OF_WORKERS{iox::MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY};
+    constexpr uint64_t NUMBER_OF_ROUNDS{100U};
+    for (uint64_t round = 0U; round < NUMBER_OF_ROUNDS; ++round)
+    {
+        const uint64_t requestDataBase{round * QUEUE_CAPACITY};
+        ASSERT_TRUE(pushRequests(sut.requestQueuePusher, QUEUE_CAPACITY, requestDataBase));
+
+        std::vector<std::thread> workers;
+        for (uint64_t i = 0U; i < NUMBER_OF_WORKERS; ++i)
+        {
+            workers.emplace_back([&] {
+                while (true)
+                {
+                    auto requestResult = sut.portUser.getRequest();
+                    if (requestResult.has_error())
+                    {
+                        EXPECT_THAT(requestResult.error(), Eq(ServerRequestResult::NO_PENDING_REQUESTS));
+                        return;
+                    }
+                    const auto* requestHeader = requestResult.value();
+                    sut.portUser.allocateResponse(requestHeader, sizeof(uint64_t), alignof(uint64_t))
+                        .and_then([&](auto& responseHeader) {
+                            new (ChunkHeader::fromUserHeader(responseHeader)->userPayload())
+                                uint64_t(getRequestData(requestHeader));
+                            EXPECT_FALSE(sut.portUser.sendResponse(responseHeader).has_error());
+                        })
+                        .or_else([](auto& error) { GTEST_FAIL() << "Expected response but got error: " << error; });
+                    sut.portUser.releaseRequest(requestHeader);
+                }
+            });
+        }
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+
+        std::vector<uint64_t> responseData;
+        while (auto maybeChunk = clientResponseQueue.tryPop())
+        {
+            responseData.emplace_back(*static_cast<uint64_t*>(maybeChunk->getUserPayload()));
+        }
+        std::sort(responseData.begin(), responseData.end());
+        ASSERT_THAT(responseData.size(), Eq(QUEUE_CAPACITY));
+        for (uint64_t i = 0U; i < QUEUE_CAPACITY; ++i)
+        {
+            EXPECT_THAT(responseData[i], Eq(requestDataBase + i));
+        }
+    }
+
+    // the last sent response is still referenced by the chunk sender
+    constexpr uint64_t NUMBER_OF_RESPONSE_CHUNKS{1U};
+    EXPECT_THAT(this->getNumberOfUsedChunks(), Eq(NUMBER_OF_RESPONSE_CHUNKS));
+}
+
+// END concurrent request processing tests
+
 // BEGIN condition variable tests
 
 TEST_F(ServerPort_test, ConditionVariableInitiallyNotSet)
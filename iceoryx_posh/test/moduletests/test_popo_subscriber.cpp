@@ -177,6 +177,77 @@ TEST_F(SubscriberTest, ReceivedSamplesAreAutomaticallyDeletedWhenOutOfScope)
     // ===== Cleanup ===== //
 }
 
+TEST_F(SubscriberTest, TakeBlockingReturnsAvailableSampleWithoutWaiting)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b3e1f7a9-4c2d-4e8b-9a5f-2d7c1e9b4a63");
+    using namespace iox::units::duration_literals;
+    // ===== Setup ===== //
+    EXPECT_CALL(sut, takeChunk)
+        .Times(1)
+        .WillOnce(Return(ByMove(iox::ok(const_cast<const iox::mepoo::ChunkHeader*>(chunkMock.chunkHeader())))));
+    EXPECT_CALL(sut, waitForData).Times(0);
+    EXPECT_CALL(sut.port(), releaseChunk).Times(AtLeast(1));
+    // ===== Test ===== //
+    auto maybeSample = sut.takeBlocking(1_s);
+    // ===== Verify ===== //
+    ASSERT_FALSE(maybeSample.has_error());
+    EXPECT_EQ(maybeSample.value().get(), chunkMock.chunkHeader()->userPayload());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(SubscriberTest, TakeBlockingWaitsForDataWithTheBusyPollBudgetWhenNoSampleIsAvailable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6f9d2b4e-1a7c-4f3e-b8d6-5c2a9e7f1b34");
+    using namespace iox::units::duration_literals;
+    // ===== Setup ===== //
+    EXPECT_CALL(sut, takeChunk)
+        .Times(2)
+        .WillOnce(Return(ByMove(iox::err(iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE))))
+        .WillOnce(Return(ByMove(iox::ok(const_cast<const iox::mepoo::ChunkHeader*>(chunkMock.chunkHeader())))));
+    EXPECT_CALL(sut, waitForData(Le(1_s), Eq(10_us))).Times(1).WillOnce(Return(true));
+    EXPECT_CALL(sut.port(), releaseChunk).Times(AtLeast(1));
+    // ===== Test ===== //
+    auto maybeSample = sut.takeBlocking(1_s, 10_us);
+    // ===== Verify ===== //
+    ASSERT_FALSE(maybeSample.has_error());
+    EXPECT_EQ(maybeSample.value().get(), chunkMock.chunkHeader()->userPayload());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(SubscriberTest, TakeBlockingReturnsNoChunkAvailableWhenTheWaitTimesOut)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d8a4c6e2-9b1f-4d7a-a3e5-8f6b2c4d9e17");
+    using namespace iox::units::duration_literals;
+    // ===== Setup ===== //
+    EXPECT_CALL(sut, takeChunk)
+        .Times(1)
+        .WillOnce(Return(ByMove(iox::err(iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE))));
+    EXPECT_CALL(sut, waitForData).Times(1).WillOnce(Return(false));
+    // ===== Test ===== //
+    auto maybeSample = sut.takeBlocking(1_s);
+    // ===== Verify ===== //
+    ASSERT_TRUE(maybeSample.has_error());
+    EXPECT_EQ(maybeSample.error(), iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+    // ===== Cleanup ===== //
+}
+
+TEST_F(SubscriberTest, TakeBlockingReturnsOtherErrorsWithoutWaiting)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2a7e9c1d-5f3b-4a8e-9d6c-1b4f7a2e8c59");
+    using namespace iox::units::duration_literals;
+    // ===== Setup ===== //
+    EXPECT_CALL(sut, takeChunk)
+        .Times(1)
+        .WillOnce(Return(ByMove(iox::err(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL))));
+    EXPECT_CALL(sut, waitForData).Times(0);
+    // ===== Test ===== //
+    auto maybeSample = sut.takeBlocking(1_s);
+    // ===== Verify ===== //
+    ASSERT_TRUE(maybeSample.has_error());
+    EXPECT_EQ(maybeSample.error(), iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
+    // ===== Cleanup ===== //
+}
+
 TEST_F(SubscriberTest, ReleasesQueuedDataViaBaseSubscriber)
 {
     ::testing::Test::RecordProperty("TEST_ID", "f30fe1ae-046c-48b3-b5cd-b9adbf9b864f");
@@ -188,4 +259,43 @@ TEST_F(SubscriberTest, ReleasesQueuedDataViaBaseSubscriber)
     // ===== Cleanup ===== //
 }
 
+constexpr uint64_t NUMBER_OF_ELEMENTS{3U};
+
+using TestSliceSubscriber = StubbedSubscriber<DummyData[], iox::mepoo::NoUserHeader, MockBaseSubscriber<DummyData>>;
+
+class SliceSubscriberTest : public Test
+{
+  protected:
+    ChunkMock<DummyData[NUMBER_OF_ELEMENTS]> chunkMock;
+    TestSliceSubscriber sut{{"", "", ""}, iox::popo::SubscriberOptions()};
+};
+
+TEST_F(SliceSubscriberTest, TakeReturnsSliceWithTheNumberOfElementsOfTheUserPayload)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c45ebd44-abf2-46f7-b127-b577b950e612");
+    // ===== Setup ===== //
+    for (uint64_t i = 0U; i < NUMBER_OF_ELEMENTS; ++i)
+    {
+        (*chunkMock.sample())[i].val = i;
+    }
+    EXPECT_CALL(sut, takeChunk)
+        .Times(1)
+        .WillOnce(Return(ByMove(iox::ok(const_cast<const iox::mepoo::ChunkHeader*>(chunkMock.chunkHeader())))));
+    EXPECT_CALL(sut.port(), releaseChunk).Times(AtLeast(1));
+    // ===== Test ===== //
+    auto maybeSample = sut.take();
+    // ===== Verify ===== //
+    ASSERT_FALSE(maybeSample.has_error());
+    const auto& sample = maybeSample.value();
+    EXPECT_EQ(sample.get(), chunkMock.chunkHeader()->userPayload());
+    ASSERT_EQ(sample.size(), NUMBER_OF_ELEMENTS);
+    uint64_t expectedValue{0U};
+    for (const auto& element : sample)
+    {
+        EXPECT_EQ(element.val, expectedValue);
+        ++expectedValue;
+    }
+    // ===== Cleanup ===== //
+}
+
 } // namespace
@@ -351,6 +351,7 @@ TEST_F(PoshRuntime_test, GetMiddlewarePublisherWithForbiddenServiceDescriptionsF
     internalServices.push_back(iox::roudi::IntrospectionPortService);
     internalServices.push_back(iox::roudi::IntrospectionPortThroughputService);
     internalServices.push_back(iox::roudi::IntrospectionSubscriberPortChangingDataService);
+    internalServices.push_back(iox::roudi::IntrospectionPortDeltaService);
 
     // Added by ProcessManager
     internalServices.push_back(iox::roudi::IntrospectionMempoolService);
@@ -203,11 +203,11 @@ TEST_F(CmdLineParser_test, MonitoringModeOptionsLeadToCorrectMode)
 {
     ::testing::Test::RecordProperty("TEST_ID", "362435bb-c35b-4617-b08b-17c359543c69");
     constexpr uint8_t NUMBER_OF_ARGS{3U};
-    MonitoringMode modeArray[] = {MonitoringMode::ON, MonitoringMode::OFF};
+    MonitoringMode modeArray[] = {MonitoringMode::ON, MonitoringMode::OFF, MonitoringMode::PIDFD};
     char* args[NUMBER_OF_ARGS];
     char appName[] = "./foo";
     char optionArray[][20] = {"-m", "--monitoring-mode"};
-    char valueArray[][10] = {"on", "off"};
+    char valueArray[][10] = {"on", "off", "pidfd"};
     args[0] = &appName[0];
 
     for (auto optionValue : optionArray)
@@ -98,6 +98,45 @@ TEST_F(RoudiConfigTomlFileProvider_test, ParsingFileIsSuccessful)
     });
 }
 
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingThreadSchedulingParametersIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4c7e2a9f-1b8d-4f3e-a6c5-9d2b7e4f1a38");
+    std::istringstream stream(R"(
+        [general]
+        version = 1
+        lock_memory = true
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+
+        [threads.monitoring_and_discovery]
+        cpu_affinity = [0, 3]
+        scheduler = "fifo"
+        priority = 42
+
+        [threads.timer_service]
+        scheduler = "rr"
+    )");
+
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    const auto& config = result.value();
+    EXPECT_TRUE(config.lockMemory);
+    EXPECT_THAT(config.monitoringAndDiscoveryThread.cpuAffinityMask, Eq(0b1001U));
+    ASSERT_TRUE(config.monitoringAndDiscoveryThread.scheduler.has_value());
+    EXPECT_THAT(config.monitoringAndDiscoveryThread.scheduler.value(), Eq(iox::detail::Scheduler::FIFO));
+    EXPECT_THAT(config.monitoringAndDiscoveryThread.priority, Eq(42));
+    ASSERT_TRUE(config.timerServiceThread.scheduler.has_value());
+    EXPECT_THAT(config.timerServiceThread.scheduler.value(), Eq(iox::detail::Scheduler::RR));
+    EXPECT_THAT(config.timerServiceThread.cpuAffinityMask, Eq(0U));
+    EXPECT_FALSE(config.runtimeMessagesThread.scheduler.has_value());
+    EXPECT_FALSE(config.processExitMonitorThread.scheduler.has_value());
+}
+
 constexpr const char* CONFIG_NO_GENERAL_SECTION = R"(
     [[segment]]
 
@@ -183,6 +222,48 @@ constexpr const char* CONFIG_MEMPOOL_WITHOUT_CHUNK_COUNT = R"(
 
 constexpr const char* CONFIG_EXCEPTION_IN_PARSER = R"(🐔)";
 
+constexpr const char* CONFIG_INVALID_THREAD_CPU_AFFINITY = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+
+    [[segment.mempool]]
+    size = 128
+    count = 1
+
+    [threads.runtime_messages]
+    cpu_affinity = [64]
+)";
+
+constexpr const char* CONFIG_INVALID_THREAD_SCHEDULER = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+
+    [[segment.mempool]]
+    size = 128
+    count = 1
+
+    [threads.runtime_messages]
+    scheduler = "hamster"
+)";
+
+constexpr const char* CONFIG_INVALID_THREAD_PRIORITY = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+
+    [[segment.mempool]]
+    size = 128
+    count = 1
+
+    [threads.runtime_messages]
+    priority = 42
+)";
+
 INSTANTIATE_TEST_SUITE_P(
     ParseAllMalformedInputConfigFiles,
     RoudiConfigTomlFileProvider_test,
@@ -200,6 +281,12 @@ INSTANTIATE_TEST_SUITE_P(
                                  CONFIG_MEMPOOL_WITHOUT_CHUNK_SIZE},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_COUNT,
                                  CONFIG_MEMPOOL_WITHOUT_CHUNK_COUNT},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_THREAD_CPU_AFFINITY,
+                                 CONFIG_INVALID_THREAD_CPU_AFFINITY},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_THREAD_SCHEDULER,
+                                 CONFIG_INVALID_THREAD_SCHEDULER},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_THREAD_PRIORITY,
+                                 CONFIG_INVALID_THREAD_PRIORITY},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::EXCEPTION_IN_PARSER,
                                  CONFIG_EXCEPTION_IN_PARSER}));
 
@@ -0,0 +1,154 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/introspection/flat_hash_index.hpp"
+
+#include "test.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+
+constexpr uint64_t CAPACITY{16U};
+
+class FlatHashIndex_test : public Test
+{
+  public:
+    std::vector<uint64_t> positionsOf(const uint64_t hash) const
+    {
+        std::vector<uint64_t> positions;
+        sut.forEach(hash, [&](const uint64_t position) { positions.push_back(position); });
+        std::sort(positions.begin(), positions.end());
+        return positions;
+    }
+
+    FlatHashIndex<CAPACITY> sut;
+};
+
+TEST_F(FlatHashIndex_test, InitialIndexIsEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5f2d8b4e-1a7c-4e9f-b3d6-8c1e4a7f2b59");
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_FALSE(sut.findIf(42U, [](auto) { return true; }).has_value());
+    EXPECT_THAT(positionsOf(42U), IsEmpty());
+}
+
+TEST_F(FlatHashIndex_test, InsertedEntryIsFound)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a3e7c1f9-6d2b-4a8e-9f4c-2b7d5e1a8c36");
+    ASSERT_TRUE(sut.insert(42U, 7U));
+
+    EXPECT_THAT(sut.size(), Eq(1U));
+    auto position = sut.findIf(42U, [](auto) { return true; });
+    ASSERT_TRUE(position.has_value());
+    EXPECT_THAT(position.value(), Eq(7U));
+}
+
+TEST_F(FlatHashIndex_test, FindIfReturnsOnlyPositionsForWhichThePredicateIsTrue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7b1f4d8a-3e6c-4b2f-a9d5-6e3a8c1f4b72");
+    ASSERT_TRUE(sut.insert(42U, 3U));
+    ASSERT_TRUE(sut.insert(42U, 5U));
+
+    auto position = sut.findIf(42U, [](auto position) { return position == 5U; });
+    ASSERT_TRUE(position.has_value());
+    EXPECT_THAT(position.value(), Eq(5U));
+    EXPECT_FALSE(sut.findIf(42U, [](auto position) { return position == 4U; }).has_value());
+}
+
+TEST_F(FlatHashIndex_test, ForEachVisitsAllEntriesWithTheSameHashOnly)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2c8e5a1d-9f3b-4d7e-b6a2-4f1c8e3d9a57");
+    ASSERT_TRUE(sut.insert(42U, 1U));
+    ASSERT_TRUE(sut.insert(13U, 2U));
+    ASSERT_TRUE(sut.insert(42U, 3U));
+
+    EXPECT_THAT(positionsOf(42U), ElementsAre(1U, 3U));
+    EXPECT_THAT(positionsOf(13U), ElementsAre(2U));
+}
+
+TEST_F(FlatHashIndex_test, InsertFailsWhenCapacityIsExceeded)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9d4a2f7c-5b1e-4c8a-a3f6-1e9b7d2c5a48");
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        ASSERT_TRUE(sut.insert(i, i));
+    }
+
+    EXPECT_FALSE(sut.insert(CAPACITY, CAPACITY));
+    EXPECT_THAT(sut.size(), Eq(CAPACITY));
+}
+
+TEST_F(FlatHashIndex_test, EraseRemovesOnlyTheEntryWithTheProvidedPosition)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4e6b9c3a-7d2f-4a1e-8b5c-3a7e1f9d6b24");
+    ASSERT_TRUE(sut.insert(42U, 1U));
+    ASSERT_TRUE(sut.insert(42U, 2U));
+
+    EXPECT_TRUE(sut.erase(42U, 1U));
+    EXPECT_FALSE(sut.erase(42U, 1U));
+    EXPECT_FALSE(sut.erase(13U, 2U));
+
+    EXPECT_THAT(sut.size(), Eq(1U));
+    EXPECT_THAT(positionsOf(42U), ElementsAre(2U));
+}
+
+TEST_F(FlatHashIndex_test, AllEntriesAreFoundAfterErasingEntriesWithCollidingHashes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c1f8a5d3-2e9b-4f6c-a7d4-9b2e6c3f1a85");
+    // entries with the same hash share the probe sequence; erasing from its middle must not cut off the entries behind
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        ASSERT_TRUE(sut.insert(i % 3U, i));
+    }
+
+    for (uint64_t i = 0U; i < CAPACITY; i += 2U)
+    {
+        ASSERT_TRUE(sut.erase(i % 3U, i));
+    }
+
+    EXPECT_THAT(sut.size(), Eq(CAPACITY / 2U));
+    for (uint64_t i = 1U; i < CAPACITY; i += 2U)
+    {
+        auto position = sut.findIf(i % 3U, [&](auto position) { return position == i; });
+        ASSERT_TRUE(position.has_value());
+        EXPECT_THAT(position.value(), Eq(i));
+    }
+    EXPECT_THAT(positionsOf(0U), ElementsAre(3U, 9U, 15U));
+}
+
+TEST_F(FlatHashIndex_test, IndexCanBeRefilledAfterAllEntriesWereErased)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6a3d1e8f-4c7b-4e2a-9d5f-8f1b3c6e2a97");
+    for (uint64_t round = 0U; round < 3U; ++round)
+    {
+        for (uint64_t i = 0U; i < CAPACITY; ++i)
+        {
+            ASSERT_TRUE(sut.insert(i * round, i));
+        }
+        for (uint64_t i = 0U; i < CAPACITY; ++i)
+        {
+            ASSERT_TRUE(sut.erase(i * round, i));
+        }
+        EXPECT_THAT(sut.size(), Eq(0U));
+    }
+}
+
+} // namespace
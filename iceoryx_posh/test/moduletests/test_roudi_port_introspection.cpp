@@ -25,6 +25,8 @@
 #include "test.hpp"
 
 #include <cstdint>
+#include <memory>
+#include <vector>
 
 namespace
 {
@@ -35,6 +37,9 @@ class PortIntrospectionAccess : public iox::roudi::PortIntrospection<PublisherPo
 {
   public:
     using iox::roudi::PortIntrospection<PublisherPort, SubscriberPort>::sendPortData;
+    using iox::roudi::PortIntrospection<PublisherPort, SubscriberPort>::sendPortDelta;
+    using iox::roudi::PortIntrospection<PublisherPort, SubscriberPort>::sendSubscriberPortsData;
+    using iox::roudi::PortIntrospection<PublisherPort, SubscriberPort>::send;
 
     void sendThroughputData()
     {
@@ -48,6 +53,14 @@ class PortIntrospectionAccess : public iox::roudi::PortIntrospection<PublisherPo
     {
         return this->m_publisherPortThroughput;
     }
+    iox::optional<PublisherPort>& getPublisherPortSubscriberPortsData()
+    {
+        return this->m_publisherPortSubscriberPortsData;
+    }
+    iox::optional<PublisherPort>& getPublisherPortDelta()
+    {
+        return this->m_publisherPortDelta;
+    }
 };
 
 class PortIntrospection_test : public Test
@@ -65,6 +78,7 @@ class PortIntrospection_test : public Test
     {
         DefaultValue<iox::popo::UniquePortId>::Set(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID);
         ASSERT_THAT(m_introspectionAccess.registerPublisherPort(std::move(m_mockPublisherPortUserIntrospection),
+                                                                std::move(m_mockPublisherPortUserIntrospection),
                                                                 std::move(m_mockPublisherPortUserIntrospection),
                                                                 std::move(m_mockPublisherPortUserIntrospection)),
                     Eq(true));
@@ -125,6 +139,49 @@ class PortIntrospection_test : public Test
         return true;
     }
 
+    using AllocationResult = iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError>;
+
+    static AllocationResult allocated(iox::mepoo::ChunkHeader* chunkHeader)
+    {
+        return iox::ok(chunkHeader);
+    }
+
+    static AllocationResult allocationFailed()
+    {
+        return iox::err(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS);
+    }
+
+    std::unique_ptr<iox::popo::PublisherPortData>
+    createPublisherPortData(const iox::capro::ServiceDescription& service)
+    {
+        return std::make_unique<iox::popo::PublisherPortData>(service,
+                                                              m_runtimeName,
+                                                              iox::roudi::DEFAULT_UNIQUE_ROUDI_ID,
+                                                              &m_memoryManager,
+                                                              iox::popo::PublisherOptions());
+    }
+
+    std::unique_ptr<iox::popo::SubscriberPortData>
+    createSubscriberPortData(const iox::capro::ServiceDescription& service)
+    {
+        return std::make_unique<iox::popo::SubscriberPortData>(
+            service,
+            m_runtimeName,
+            iox::roudi::DEFAULT_UNIQUE_ROUDI_ID,
+            iox::popo::VariantQueueTypes::FiFo_MultiProducerSingleConsumer,
+            iox::popo::SubscriberOptions());
+    }
+
+    iox::capro::ServiceDescription uniqueService()
+    {
+        const auto event = std::to_string(m_serviceCounter++);
+        return {"Brezel", "mit", iox::capro::IdString_t(iox::TruncateToCapacity, event.c_str())};
+    }
+
+    const iox::RuntimeName_t m_runtimeName{"name"};
+    iox::mepoo::MemoryManager m_memoryManager;
+    uint64_t m_serviceCounter{0U};
+
     MockPublisherPortUser m_mockPublisherPortUserIntrospection;
     MockPublisherPortUser m_mockPublisherPortUserIntrospection2;
 
@@ -139,11 +196,13 @@ TEST_F(PortIntrospection_test, registerPublisherPort)
         new iox::roudi::PortIntrospection<MockPublisherPortUser, MockSubscriberPortUser>);
 
     EXPECT_THAT(introspection->registerPublisherPort(std::move(m_mockPublisherPortUserIntrospection),
+                                                     std::move(m_mockPublisherPortUserIntrospection),
                                                      std::move(m_mockPublisherPortUserIntrospection),
                                                      std::move(m_mockPublisherPortUserIntrospection)),
                 Eq(true));
 
     EXPECT_THAT(introspection->registerPublisherPort(std::move(m_mockPublisherPortUserIntrospection2),
+                                                     std::move(m_mockPublisherPortUserIntrospection2),
                                                      std::move(m_mockPublisherPortUserIntrospection2),
                                                      std::move(m_mockPublisherPortUserIntrospection2)),
                 Eq(false));
@@ -438,6 +497,418 @@ TEST_F(PortIntrospection_test, addAndRemoveSubscriber)
 }
 
 
+TEST_F(PortIntrospection_test, sendThroughputDataContainsStatisticsOfAllPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e5a0c7d4-18b2-4f9e-a36d-2c7b9f10d856");
+    using Topic = iox::roudi::PortThroughputIntrospectionFieldTopic;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    const iox::RuntimeName_t runtimeName{"name"};
+    iox::capro::ServiceDescription service("Schnitzel", "mit", "Pommes");
+
+    iox::mepoo::MemoryManager memoryManager;
+    iox::popo::PublisherOptions publisherOptions;
+    publisherOptions.historyCapacity = 1U;
+    iox::popo::PublisherPortData publisherPortData(
+        service, runtimeName, iox::roudi::DEFAULT_UNIQUE_ROUDI_ID, &memoryManager, publisherOptions);
+    iox::popo::SubscriberPortData subscriberPortData{service,
+                                                     runtimeName,
+                                                     iox::roudi::DEFAULT_UNIQUE_ROUDI_ID,
+                                                     iox::popo::VariantQueueTypes::FiFo_MultiProducerSingleConsumer,
+                                                     iox::popo::SubscriberOptions()};
+    ASSERT_TRUE(m_introspectionAccess.addPublisher(publisherPortData));
+    ASSERT_TRUE(m_introspectionAccess.addSubscriber(subscriberPortData));
+
+    constexpr uint64_t SENT_CHUNKS{13U};
+    constexpr uint64_t DELIVERED_CHUNKS{12U};
+    constexpr uint64_t DROPPED_CHUNKS{1U};
+    constexpr uint64_t LOAN_FAILURES{2U};
+    constexpr uint64_t BLOCKED_TIME{37U};
+    constexpr uint64_t USER_PAYLOAD_SIZE{8U};
+    constexpr uint64_t CHUNK_SIZE{128U};
+    constexpr uint64_t RECEIVED_CHUNKS{11U};
+    constexpr uint64_t LOST_CHUNKS{2U};
+
+    auto& senderStatistics = publisherPortData.m_chunkSenderData.m_statistics;
+    senderStatistics.m_sentChunks = SENT_CHUNKS;
+    senderStatistics.m_deliveredChunks = DELIVERED_CHUNKS;
+    senderStatistics.m_droppedChunks = DROPPED_CHUNKS;
+    senderStatistics.m_loanFailures = LOAN_FAILURES;
+    senderStatistics.m_blockedTimeInNanoseconds = BLOCKED_TIME;
+    senderStatistics.m_lastUserPayloadSize = USER_PAYLOAD_SIZE;
+    senderStatistics.m_lastChunkSize = CHUNK_SIZE;
+
+    auto& queueStatistics = subscriberPortData.m_chunkReceiverData.m_statistics;
+    queueStatistics.m_receivedChunks = RECEIVED_CHUNKS;
+    queueStatistics.m_lostChunks = LOST_CHUNKS;
+
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), tryAllocateChunk(_, _, _, _))
+        .WillOnce(Return(ByMove(iox::ok(chunk.get()->chunkHeader()))));
+
+    bool chunkWasSent = false;
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), sendChunk(_))
+        .WillOnce(Invoke([&](iox::mepoo::ChunkHeader* const) { chunkWasSent = true; }));
+
+    m_introspectionAccess.sendThroughputData();
+
+    ASSERT_THAT(chunkWasSent, Eq(true));
+    ASSERT_THAT(chunk->sample()->m_throughputList.size(), Eq(1U));
+    ASSERT_THAT(chunk->sample()->m_subscriberThroughputList.size(), Eq(1U));
+
+    const auto& throughput = chunk->sample()->m_throughputList[0];
+    EXPECT_THAT(throughput.m_sentChunks, Eq(SENT_CHUNKS));
+    EXPECT_THAT(throughput.m_deliveredChunks, Eq(DELIVERED_CHUNKS));
+    EXPECT_THAT(throughput.m_droppedChunks, Eq(DROPPED_CHUNKS));
+    EXPECT_THAT(throughput.m_loanFailures, Eq(LOAN_FAILURES));
+    EXPECT_THAT(throughput.m_blockedTimeInNanoseconds, Eq(BLOCKED_TIME));
+    EXPECT_THAT(throughput.m_sampleSize, Eq(USER_PAYLOAD_SIZE));
+    EXPECT_THAT(throughput.m_chunkSize, Eq(CHUNK_SIZE));
+    EXPECT_THAT(throughput.m_isField, Eq(true));
+    EXPECT_THAT(throughput.m_chunksPerMinute, Gt(0.0));
+
+    const auto& subscriberThroughput = chunk->sample()->m_subscriberThroughputList[0];
+    EXPECT_THAT(subscriberThroughput.m_receivedChunks, Eq(RECEIVED_CHUNKS));
+    EXPECT_THAT(subscriberThroughput.m_lostChunks, Eq(LOST_CHUNKS));
+    EXPECT_THAT(subscriberThroughput.m_lostChunksPerMinute, Gt(0.0));
+    EXPECT_THAT(subscriberThroughput.m_queueSize, Eq(0U));
+    EXPECT_THAT(subscriberThroughput.m_queueCapacity,
+                Eq(subscriberPortData.m_chunkReceiverData.m_queue.capacity()));
+
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+}
+
+TEST_F(PortIntrospection_test, removedPublisherIsDisconnectedFromItsSubscribers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b8d3f1a6-4c9e-4e7b-a2d5-7f3c1e8b6a94");
+    using Topic = iox::roudi::PortThroughputIntrospectionFieldTopic;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    const iox::RuntimeName_t runtimeName{"name"};
+    iox::capro::ServiceDescription service("Kaesespaetzle", "mit", "Roestzwiebeln");
+    iox::capro::ServiceDescription otherService("Maultaschen", "in", "Bruehe");
+    iox::capro::ServiceDescription unrelatedService("Linsen", "mit", "Spaetzle");
+
+    iox::mepoo::MemoryManager memoryManager;
+    iox::popo::PublisherPortData publisherPortData(
+        service, runtimeName, iox::roudi::DEFAULT_UNIQUE_ROUDI_ID, &memoryManager, iox::popo::PublisherOptions());
+    iox::popo::SubscriberPortData subscriberPortData{service,
+                                                     runtimeName,
+                                                     iox::roudi::DEFAULT_UNIQUE_ROUDI_ID,
+                                                     iox::popo::VariantQueueTypes::FiFo_MultiProducerSingleConsumer,
+                                                     iox::popo::SubscriberOptions()};
+    iox::popo::SubscriberPortData otherSubscriberPortData{
+        otherService,
+        runtimeName,
+        iox::roudi::DEFAULT_UNIQUE_ROUDI_ID,
+        iox::popo::VariantQueueTypes::FiFo_MultiProducerSingleConsumer,
+        iox::popo::SubscriberOptions()};
+    ASSERT_TRUE(m_introspectionAccess.addSubscriber(subscriberPortData));
+    ASSERT_TRUE(m_introspectionAccess.addSubscriber(otherSubscriberPortData));
+    ASSERT_TRUE(m_introspectionAccess.addPublisher(publisherPortData));
+
+    iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError> tryAllocateChunkResult =
+        iox::ok(chunk.get()->chunkHeader());
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(tryAllocateChunkResult));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), sendChunk(_)).Times(2);
+
+    auto numberOfConnectedSubscribers = [&] {
+        uint64_t numberOfConnectedSubscribers{0U};
+        for (const auto& subscriberThroughput : chunk->sample()->m_subscriberThroughputList)
+        {
+            if (subscriberThroughput.m_publisherPortID != 0U)
+            {
+                ++numberOfConnectedSubscribers;
+            }
+        }
+        return numberOfConnectedSubscribers;
+    };
+
+    m_introspectionAccess.sendThroughputData();
+    ASSERT_THAT(chunk->sample()->m_subscriberThroughputList.size(), Eq(2U));
+    EXPECT_THAT(numberOfConnectedSubscribers(), Eq(1U));
+
+    MockPublisherPortUser port(&publisherPortData);
+    EXPECT_CALL(port, getServiceDescription()).WillRepeatedly(Return(publisherPortData.m_serviceDescription));
+    EXPECT_CALL(port, getUniqueID()).WillRepeatedly(Return(publisherPortData.m_uniqueId));
+    ASSERT_TRUE(m_introspectionAccess.removePublisher(port));
+
+    // the new publisher reuses the storage of the removed one and must not be attributed to its former subscribers
+    iox::popo::PublisherPortData unrelatedPublisherPortData(unrelatedService,
+                                                            runtimeName,
+                                                            iox::roudi::DEFAULT_UNIQUE_ROUDI_ID,
+                                                            &memoryManager,
+                                                            iox::popo::PublisherOptions());
+    ASSERT_TRUE(m_introspectionAccess.addPublisher(unrelatedPublisherPortData));
+
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+    m_introspectionAccess.sendThroughputData();
+    ASSERT_THAT(chunk->sample()->m_throughputList.size(), Eq(1U));
+    ASSERT_THAT(chunk->sample()->m_subscriberThroughputList.size(), Eq(2U));
+    EXPECT_THAT(numberOfConnectedSubscribers(), Eq(0U));
+
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+}
+
+TEST_F(PortIntrospection_test, sendPortDeltaContainsAddedAndRemovedPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0b7e3c9a-5d1f-4a8e-b2c6-9f4d1a7e3b58");
+    using Topic = iox::roudi::PortIntrospectionFieldTopic;
+    using Delta = iox::roudi::PortIntrospectionDeltaTopic;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+    auto deltaChunk = std::unique_ptr<ChunkMock<Delta>>(new ChunkMock<Delta>);
+
+    EXPECT_CALL(m_introspectionAccess.getPublisherPort().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(allocated(chunk->chunkHeader())));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPort().value(), sendChunk(_)).Times(1);
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortDelta().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(allocated(deltaChunk->chunkHeader())));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortDelta().value(), sendChunk(_)).Times(2);
+
+    auto keptPublisher = createPublisherPortData(uniqueService());
+    ASSERT_TRUE(m_introspectionAccess.addPublisher(*keptPublisher));
+    m_introspectionAccess.sendPortData();
+    const auto snapshotGeneration = chunk->sample()->m_generation;
+
+    auto publisher = createPublisherPortData(uniqueService());
+    auto subscriber = createSubscriberPortData(uniqueService());
+    ASSERT_TRUE(m_introspectionAccess.addPublisher(*publisher));
+    ASSERT_TRUE(m_introspectionAccess.addSubscriber(*subscriber));
+
+    ASSERT_TRUE(m_introspectionAccess.sendPortDelta());
+    {
+        const auto& delta = *deltaChunk->sample();
+        EXPECT_THAT(delta.m_baseGeneration, Eq(snapshotGeneration));
+        EXPECT_THAT(delta.m_generation, Eq(snapshotGeneration + 1U));
+        ASSERT_THAT(delta.m_addedPublishers.size(), Eq(1U));
+        EXPECT_THAT(delta.m_addedPublishers[0].m_publisherPortID, Eq(static_cast<uint64_t>(publisher->m_uniqueId)));
+        ASSERT_THAT(delta.m_addedSubscribers.size(), Eq(1U));
+        EXPECT_THAT(delta.m_addedSubscribers[0].m_subscriberPortID,
+                    Eq(static_cast<uint64_t>(subscriber->m_uniqueId)));
+        EXPECT_THAT(delta.m_removedPublisherPortIDs.size(), Eq(0U));
+        EXPECT_THAT(delta.m_removedSubscriberPortIDs.size(), Eq(0U));
+    }
+    deltaChunk->sample()->~Delta();
+
+    MockPublisherPortUser publisherPort(publisher.get());
+    EXPECT_CALL(publisherPort, getServiceDescription()).WillRepeatedly(Return(publisher->m_serviceDescription));
+    EXPECT_CALL(publisherPort, getUniqueID()).WillRepeatedly(Return(publisher->m_uniqueId));
+    ASSERT_TRUE(m_introspectionAccess.removePublisher(publisherPort));
+    MockSubscriberPortUser subscriberPort(subscriber.get());
+    EXPECT_CALL(subscriberPort, getServiceDescription()).WillRepeatedly(Return(subscriber->m_serviceDescription));
+    EXPECT_CALL(subscriberPort, getUniqueID()).WillRepeatedly(Return(subscriber->m_uniqueId));
+    ASSERT_TRUE(m_introspectionAccess.removeSubscriber(subscriberPort));
+
+    ASSERT_TRUE(m_introspectionAccess.sendPortDelta());
+    {
+        const auto& delta = *deltaChunk->sample();
+        EXPECT_THAT(delta.m_baseGeneration, Eq(snapshotGeneration + 1U));
+        EXPECT_THAT(delta.m_generation, Eq(snapshotGeneration + 2U));
+        EXPECT_THAT(delta.m_addedPublishers.size(), Eq(0U));
+        EXPECT_THAT(delta.m_addedSubscribers.size(), Eq(0U));
+        ASSERT_THAT(delta.m_removedPublisherPortIDs.size(), Eq(1U));
+        EXPECT_THAT(delta.m_removedPublisherPortIDs[0], Eq(static_cast<uint64_t>(publisher->m_uniqueId)));
+        ASSERT_THAT(delta.m_removedSubscriberPortIDs.size(), Eq(1U));
+        EXPECT_THAT(delta.m_removedSubscriberPortIDs[0], Eq(static_cast<uint64_t>(subscriber->m_uniqueId)));
+    }
+
+    chunk->sample()->~Topic();
+    deltaChunk->sample()->~Delta();
+}
+
+TEST_F(PortIntrospection_test, PortWhichIsAddedAndRemovedBetweenTwoDeltasIsNotPartOfTheDelta)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7d2a9e4f-1c6b-4f3a-8e5d-2b9c7f1a4e63");
+    using Delta = iox::roudi::PortIntrospectionDeltaTopic;
+
+    auto deltaChunk = std::unique_ptr<ChunkMock<Delta>>(new ChunkMock<Delta>);
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortDelta().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(allocated(deltaChunk->chunkHeader())));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortDelta().value(), sendChunk(_)).Times(1);
+
+    auto subscriber = createSubscriberPortData(uniqueService());
+    ASSERT_TRUE(m_introspectionAccess.addSubscriber(*subscriber));
+    MockSubscriberPortUser subscriberPort(subscriber.get());
+    EXPECT_CALL(subscriberPort, getServiceDescription()).WillRepeatedly(Return(subscriber->m_serviceDescription));
+    EXPECT_CALL(subscriberPort, getUniqueID()).WillRepeatedly(Return(subscriber->m_uniqueId));
+    ASSERT_TRUE(m_introspectionAccess.removeSubscriber(subscriberPort));
+
+    ASSERT_TRUE(m_introspectionAccess.sendPortDelta());
+    EXPECT_THAT(deltaChunk->sample()->m_addedSubscribers.size(), Eq(0U));
+    EXPECT_THAT(deltaChunk->sample()->m_removedSubscriberPortIDs.size(), Eq(0U));
+
+    deltaChunk->sample()->~Delta();
+}
+
+TEST_F(PortIntrospection_test, sendPortDeltaFailsWhenTheChangesDoNotFitIntoTheDelta)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e4c8b1f7-3a9d-4e2c-b6f1-8d3e5a9c2b74");
+    using Topic = iox::roudi::PortIntrospectionFieldTopic;
+    using Delta = iox::roudi::PortIntrospectionDeltaTopic;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+    auto deltaChunk = std::unique_ptr<ChunkMock<Delta>>(new ChunkMock<Delta>);
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortDelta().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(allocated(deltaChunk->chunkHeader())));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortDelta().value(), sendChunk(_)).Times(0);
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortDelta().value(), releaseChunk(_)).Times(1);
+    EXPECT_CALL(m_introspectionAccess.getPublisherPort().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(allocated(chunk->chunkHeader())));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPort().value(), sendChunk(_)).Times(1);
+
+    std::vector<std::unique_ptr<iox::popo::SubscriberPortData>> subscribers;
+    for (uint64_t i = 0U; i <= iox::roudi::MAX_PORT_INTROSPECTION_DELTA_ENTRIES; ++i)
+    {
+        subscribers.emplace_back(createSubscriberPortData(uniqueService()));
+        ASSERT_TRUE(m_introspectionAccess.addSubscriber(*subscribers.back()));
+    }
+
+    EXPECT_FALSE(m_introspectionAccess.sendPortDelta());
+
+    m_introspectionAccess.sendPortData();
+    EXPECT_THAT(chunk->sample()->m_subscriberList.size(), Eq(iox::roudi::MAX_PORT_INTROSPECTION_DELTA_ENTRIES + 1U));
+
+    chunk->sample()->~Topic();
+}
+
+TEST_F(PortIntrospection_test, SendPublishesPortDataAfterTheMaximumNumberOfDeltasAndWhenThePortsStopChanging)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5a1f8d3c-9e2b-4c7a-a4f6-1d8e3b9c5f27");
+    using Topic = iox::roudi::PortIntrospectionFieldTopic;
+    using Delta = iox::roudi::PortIntrospectionDeltaTopic;
+    using namespace iox::roudi;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+    auto deltaChunk = std::unique_ptr<ChunkMock<Delta>>(new ChunkMock<Delta>);
+
+    uint64_t numberOfSentTopics{0U};
+    uint64_t numberOfSentDeltas{0U};
+    EXPECT_CALL(m_introspectionAccess.getPublisherPort().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(allocated(chunk->chunkHeader())));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPort().value(), sendChunk(_))
+        .WillRepeatedly(Invoke([&](auto) { ++numberOfSentTopics; }));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortDelta().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(allocated(deltaChunk->chunkHeader())));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortDelta().value(), sendChunk(_))
+        .WillRepeatedly(Invoke([&](auto) { ++numberOfSentDeltas; }));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(allocationFailed()));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortSubscriberPortsData().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(allocationFailed()));
+
+    m_introspectionAccess.sendPortData();
+    numberOfSentTopics = 0U;
+
+    std::vector<std::unique_ptr<iox::popo::PublisherPortData>> publishers;
+    auto addPublisherAndSend = [&] {
+        publishers.emplace_back(createPublisherPortData(uniqueService()));
+        ASSERT_TRUE(m_introspectionAccess.addPublisher(*publishers.back()));
+        m_introspectionAccess.send();
+    };
+
+    for (uint64_t i = 0U; i < PORT_INTROSPECTION_DELTAS_PER_SNAPSHOT; ++i)
+    {
+        addPublisherAndSend();
+    }
+    EXPECT_THAT(numberOfSentDeltas, Eq(PORT_INTROSPECTION_DELTAS_PER_SNAPSHOT));
+    EXPECT_THAT(numberOfSentTopics, Eq(0U));
+
+    addPublisherAndSend();
+    EXPECT_THAT(numberOfSentDeltas, Eq(PORT_INTROSPECTION_DELTAS_PER_SNAPSHOT));
+    EXPECT_THAT(numberOfSentTopics, Eq(1U));
+    EXPECT_THAT(chunk->sample()->m_publisherList.size(), Eq(PORT_INTROSPECTION_DELTAS_PER_SNAPSHOT + 1U));
+
+    // nothing changed since the last port data
+    m_introspectionAccess.send();
+    EXPECT_THAT(numberOfSentTopics, Eq(1U));
+
+    addPublisherAndSend();
+    EXPECT_THAT(numberOfSentDeltas, Eq(PORT_INTROSPECTION_DELTAS_PER_SNAPSHOT + 1U));
+    EXPECT_THAT(numberOfSentTopics, Eq(1U));
+
+    // the port data is updated once after the last delta and keeps the generation of the delta
+    m_introspectionAccess.send();
+    m_introspectionAccess.send();
+    EXPECT_THAT(numberOfSentTopics, Eq(2U));
+    EXPECT_THAT(chunk->sample()->m_generation, Eq(deltaChunk->sample()->m_generation));
+    EXPECT_THAT(chunk->sample()->m_publisherList.size(), Eq(PORT_INTROSPECTION_DELTAS_PER_SNAPSHOT + 2U));
+
+    chunk->sample()->~Topic();
+    deltaChunk->sample()->~Delta();
+}
+
+TEST_F(PortIntrospection_test, unchangedThroughputDataIsNotSentAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c9e2f5a1-7b4d-4e8c-9a3f-6e1b8d4c2f95");
+    using Topic = iox::roudi::PortThroughputIntrospectionFieldTopic;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    auto publisher = createPublisherPortData(uniqueService());
+    ASSERT_TRUE(m_introspectionAccess.addPublisher(*publisher));
+
+    uint64_t numberOfSentChunks{0U};
+    uint64_t numberOfReleasedChunks{0U};
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(allocated(chunk->chunkHeader())));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), sendChunk(_))
+        .WillRepeatedly(Invoke([&](auto) { ++numberOfSentChunks; }));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), releaseChunk(_))
+        .WillRepeatedly(Invoke([&](auto) { ++numberOfReleasedChunks; }));
+
+    m_introspectionAccess.sendThroughputData();
+    m_introspectionAccess.sendThroughputData();
+    EXPECT_THAT(numberOfSentChunks, Eq(1U));
+    EXPECT_THAT(numberOfReleasedChunks, Eq(1U));
+
+    publisher->m_chunkSenderData.m_statistics.m_sentChunks = 42U;
+    m_introspectionAccess.sendThroughputData();
+    EXPECT_THAT(numberOfSentChunks, Eq(2U));
+
+    // the rate drops to zero once, afterwards the data does not change anymore
+    m_introspectionAccess.sendThroughputData();
+    EXPECT_THAT(numberOfSentChunks, Eq(3U));
+    ASSERT_THAT(chunk->sample()->m_throughputList.size(), Eq(1U));
+    EXPECT_THAT(chunk->sample()->m_throughputList[0].m_chunksPerMinute, Eq(0.0));
+    chunk->sample()->~Topic();
+
+    m_introspectionAccess.sendThroughputData();
+    EXPECT_THAT(numberOfSentChunks, Eq(3U));
+    EXPECT_THAT(numberOfReleasedChunks, Eq(2U));
+}
+
+TEST_F(PortIntrospection_test, unchangedSubscriberPortsDataIsNotSentAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f6b9d2e-8a1c-4b5f-a7e3-9c2d6f1b8a46");
+    using Topic = iox::roudi::SubscriberPortChangingIntrospectionFieldTopic;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    auto subscriber = createSubscriberPortData(uniqueService());
+    ASSERT_TRUE(m_introspectionAccess.addSubscriber(*subscriber));
+
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortSubscriberPortsData().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(allocated(chunk->chunkHeader())));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortSubscriberPortsData().value(), sendChunk(_)).Times(2);
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortSubscriberPortsData().value(), releaseChunk(_)).Times(1);
+
+    m_introspectionAccess.sendSubscriberPortsData();
+    m_introspectionAccess.sendSubscriberPortsData();
+
+    auto otherSubscriber = createSubscriberPortData(uniqueService());
+    ASSERT_TRUE(m_introspectionAccess.addSubscriber(*otherSubscriber));
+    m_introspectionAccess.sendSubscriberPortsData();
+
+    ASSERT_THAT(chunk->sample()->subscriberPortChangingDataList.size(), Eq(2U));
+    EXPECT_THAT(chunk->sample()->subscriberPortChangingDataList[1].subscriberPortID,
+                Eq(static_cast<uint64_t>(otherSubscriber->m_uniqueId)));
+
+    chunk->sample()->~Topic();
+}
+
 TEST_F(PortIntrospection_test, Thread)
 {
     ::testing::Test::RecordProperty("TEST_ID", "ae5b252d-0060-4bb7-a193-0c2ae0ebbb7a");
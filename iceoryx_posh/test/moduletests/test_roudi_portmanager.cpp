@@ -22,6 +22,8 @@
 
 #include "iceoryx_hoofs/testing/error_reporting/testing_support.hpp"
 
+#include <vector>
+
 namespace iox_test_roudi_portmanager
 {
 using iox::into;
@@ -911,4 +913,85 @@ TEST_F(PortManager_test, PortsDestroyInProcess2ChangeStatesOfPortsInProcess1)
     }
 }
 
+TEST_F(PortManager_test, DeletePortsOfProcessWithMorePortsThanOneBatchDisconnectsAllPeers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d3a8f1c6-2e7b-4b9d-a5f0-8c1e6d2b4f93");
+    // more than twice the capacity of a batch of port destructions
+    constexpr uint64_t NUMBER_OF_PORTS{150U};
+    iox::RuntimeName_t runtimeName1 = "myApp1";
+    iox::RuntimeName_t runtimeName2 = "myApp2";
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
+    SubscriberOptions subscriberOptions{1U, 1U, iox::NodeName_t("node"), false};
+
+    std::vector<PublisherPortRouDiType::MemberType_t*> publishers1;
+    std::vector<SubscriberPortType::MemberType_t*> subscribers1;
+    for (uint64_t i = 0U; i < NUMBER_OF_PORTS; ++i)
+    {
+        // the ports of app2 are acquired in the reverse order of their services to not end up with sorted batches
+        const auto id = into<lossy<IdString_t>>(convert::toString(i));
+        const auto reverseId = into<lossy<IdString_t>>(convert::toString(NUMBER_OF_PORTS - 1U - i));
+        const iox::capro::ServiceDescription fromApp1{"FromApp1", id, "Event"};
+        const iox::capro::ServiceDescription fromApp2{"FromApp2", id, "Event"};
+        const iox::capro::ServiceDescription offeredByApp2{"FromApp2", reverseId, "Event"};
+
+        publishers1.push_back(m_portManager
+                                  ->acquirePublisherPortData(fromApp1,
+                                                             publisherOptions,
+                                                             runtimeName1,
+                                                             m_payloadDataSegmentMemoryManager,
+                                                             PortConfigInfo())
+                                  .value());
+        subscribers1.push_back(
+            m_portManager->acquireSubscriberPortData(fromApp2, subscriberOptions, runtimeName1, PortConfigInfo())
+                .value());
+        PublisherPortUser(publishers1.back()).offer();
+        SubscriberPortUser(subscribers1.back()).subscribe();
+
+        auto publisherData2 = m_portManager
+                                  ->acquirePublisherPortData(offeredByApp2,
+                                                             publisherOptions,
+                                                             runtimeName2,
+                                                             m_payloadDataSegmentMemoryManager,
+                                                             PortConfigInfo())
+                                  .value();
+        const iox::capro::ServiceDescription subscribedByApp2{"FromApp1", reverseId, "Event"};
+        auto subscriberData2 = m_portManager
+                                   ->acquireSubscriberPortData(
+                                       subscribedByApp2, subscriberOptions, runtimeName2, PortConfigInfo())
+                                   .value();
+        PublisherPortUser(publisherData2).offer();
+        SubscriberPortUser(subscriberData2).subscribe();
+    }
+
+    m_portManager->doDiscovery();
+
+    for (uint64_t i = 0U; i < NUMBER_OF_PORTS; ++i)
+    {
+        ASSERT_TRUE(PublisherPortUser(publishers1[i]).hasSubscribers());
+        ASSERT_THAT(SubscriberPortUser(subscribers1[i]).getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+    }
+
+    m_portManager->deletePortsOfProcess(runtimeName2);
+
+    for (uint64_t i = 0U; i < NUMBER_OF_PORTS; ++i)
+    {
+        EXPECT_FALSE(PublisherPortUser(publishers1[i]).hasSubscribers());
+        if (std::is_same<iox::build::CommunicationPolicy, iox::build::OneToManyPolicy>::value)
+        {
+            EXPECT_THAT(SubscriberPortUser(subscribers1[i]).getSubscriptionState(),
+                        Eq(iox::SubscribeState::WAIT_FOR_OFFER));
+        }
+    }
+
+    auto* portPool = m_roudiMemoryManager->portPool().value();
+    for (const auto& publisher : portPool->getPublisherPortDataList())
+    {
+        EXPECT_THAT(publisher.m_runtimeName, Ne(runtimeName2));
+    }
+    for (const auto& subscriber : portPool->getSubscriberPortDataList())
+    {
+        EXPECT_THAT(subscriber.m_runtimeName, Ne(runtimeName2));
+    }
+}
+
 } // namespace iox_test_roudi_portmanager
@@ -142,6 +142,48 @@ TEST_F(PortManager_test, AcquireServerPortDataWithSameServiceDescriptionTwiceAnd
     IOX_TESTING_EXPECT_OK();
 }
 
+TEST_F(PortManager_test, AcquireServerPortDataWithSameServiceDescriptionTwiceAndMultipleServersAllowedReturnsPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a1c7e4f9-6b28-4d53-9e0a-3f8b5d2c7e16");
+    const ServiceDescription sd{"hyp", "no", "toad"};
+    const RuntimeName_t runtimeName{"hypnotoad"};
+    auto serverOptions = createTestServerOptions();
+    serverOptions.allowMultipleServers = true;
+
+    for (auto i = 0U; i < 2U; ++i)
+    {
+        m_portManager->acquireServerPortData(sd, serverOptions, runtimeName, m_payloadDataSegmentMemoryManager, {})
+            .or_else([&](const auto& error) {
+                GTEST_FAIL() << "Expected ServerPortData but got PortPoolError: " << static_cast<uint8_t>(error);
+            });
+    }
+
+    IOX_TESTING_EXPECT_OK();
+}
+
+TEST_F(PortManager_test,
+       AcquireServerPortDataWithSameServiceDescriptionTwiceAndOnlySecondAllowingMultipleServersReturnsError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5e2b9d70-c3a4-4f18-8b6d-e1f07a9c4d38");
+    const ServiceDescription sd{"hyp", "no", "toad"};
+    const RuntimeName_t runtimeName{"hypnotoad"};
+    auto serverOptions = createTestServerOptions();
+
+    m_portManager->acquireServerPortData(sd, serverOptions, runtimeName, m_payloadDataSegmentMemoryManager, {})
+        .or_else([&](const auto& error) {
+            GTEST_FAIL() << "Expected ServerPortData but got PortPoolError: " << static_cast<uint8_t>(error);
+        });
+
+    serverOptions.allowMultipleServers = true;
+    m_portManager->acquireServerPortData(sd, serverOptions, runtimeName, m_payloadDataSegmentMemoryManager, {})
+        .and_then([&](const auto&) {
+            GTEST_FAIL() << "Expected PortPoolError::UNIQUE_SERVER_PORT_ALREADY_EXISTS but got ServerPortData";
+        })
+        .or_else([&](const auto& error) { EXPECT_THAT(error, Eq(PortPoolError::UNIQUE_SERVER_PORT_ALREADY_EXISTS)); });
+
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::POSH__PORT_MANAGER_SERVERPORT_NOT_UNIQUE);
+}
+
 // END aquireServerPortData tests
 
 // BEGIN discovery tests
@@ -342,6 +384,70 @@ TEST_F(PortManager_test, DoDiscoveryWithClientConnectResultsInNoClientsWhenClien
     EXPECT_FALSE(serverPortUser.hasClients());
 }
 
+TEST_F(PortManager_test, CreateClientWithConnectOnCreateAndMultipleOfferingServersResultsInClientConnectedToAllServers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c8f3a6d1-0e94-4b27-a5c8-7d1e2b9f4a60");
+    auto clientOptions = createTestClientOptions();
+    clientOptions.connectOnCreate = true;
+    auto serverOptions = createTestServerOptions();
+    serverOptions.offerOnCreate = true;
+    serverOptions.allowMultipleServers = true;
+
+    auto serverPortUser1 = createServer(serverOptions);
+    auto clientPortUser = createClient(clientOptions);
+    auto serverPortUser2 = createServer(serverOptions);
+
+    EXPECT_THAT(clientPortUser.getConnectionState(), Eq(ConnectionState::CONNECTED));
+    EXPECT_TRUE(serverPortUser1.hasClients());
+    EXPECT_TRUE(serverPortUser2.hasClients());
+}
+
+TEST_F(PortManager_test, DoDiscoveryWithClientConnectedToMultipleServersRemainsConnectedUntilAllServersStopOffer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2d7b4e19-f6a3-4c85-b0d2-9e3c1a8f5b74");
+    auto clientOptions = createTestClientOptions();
+    clientOptions.connectOnCreate = true;
+    auto serverOptions = createTestServerOptions();
+    serverOptions.offerOnCreate = true;
+    serverOptions.allowMultipleServers = true;
+
+    auto serverPortUser1 = createServer(serverOptions);
+    auto serverPortUser2 = createServer(serverOptions);
+    auto clientPortUser = createClient(clientOptions);
+
+    serverPortUser1.stopOffer();
+    m_portManager->doDiscovery();
+
+    EXPECT_THAT(clientPortUser.getConnectionState(), Eq(ConnectionState::CONNECTED));
+    EXPECT_TRUE(serverPortUser2.hasClients());
+
+    serverPortUser2.stopOffer();
+    m_portManager->doDiscovery();
+
+    EXPECT_THAT(clientPortUser.getConnectionState(), Eq(ConnectionState::WAIT_FOR_OFFER));
+}
+
+TEST_F(PortManager_test, DoDiscoveryWithClientConnectedToMultipleServersResultsInNotConnectedWhenCallingDisconnect)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f0a5c2e8-3b71-4d96-8c4e-6a9d0b7e2f13");
+    auto clientOptions = createTestClientOptions();
+    clientOptions.connectOnCreate = true;
+    auto serverOptions = createTestServerOptions();
+    serverOptions.offerOnCreate = true;
+    serverOptions.allowMultipleServers = true;
+
+    auto serverPortUser1 = createServer(serverOptions);
+    auto serverPortUser2 = createServer(serverOptions);
+    auto clientPortUser = createClient(clientOptions);
+
+    clientPortUser.disconnect();
+    m_portManager->doDiscovery();
+
+    EXPECT_THAT(clientPortUser.getConnectionState(), Eq(ConnectionState::NOT_CONNECTED));
+    EXPECT_FALSE(serverPortUser1.hasClients());
+    EXPECT_FALSE(serverPortUser2.hasClients());
+}
+
 TEST_F(PortManager_test, CreateMultipleClientsWithConnectOnCreateAndOfferingServerResultsInAllClientsConnected)
 {
     ::testing::Test::RecordProperty("TEST_ID", "08f9981f-2585-4574-b0fc-c16cf0eef7d4");
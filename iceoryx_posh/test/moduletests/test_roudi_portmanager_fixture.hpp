@@ -114,6 +114,7 @@ class PortManager_test : public Test
         internalServices.push_back(IntrospectionPortService);
         internalServices.push_back(IntrospectionPortThroughputService);
         internalServices.push_back(IntrospectionSubscriberPortChangingDataService);
+        internalServices.push_back(IntrospectionPortDeltaService);
     }
 
     iox::capro::ServiceDescription getUniqueSD()
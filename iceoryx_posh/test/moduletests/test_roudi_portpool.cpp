@@ -26,6 +26,8 @@
 #include "iceoryx_hoofs/testing/error_reporting/testing_support.hpp"
 #include "test.hpp"
 
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -668,4 +670,71 @@ TEST_F(PortPool_test, RemoveConditionVariableDataIsSuccessful)
 
 // END ConditionVariable tests
 
+// BEGIN per runtime lookup tests
+
+TEST_F(PortPool_test, ForEachPublisherPortOfVisitsOnlyPortsOfTheRuntime)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0f3b7d2e-6c4a-4e1b-9a8d-5e2c7f1b3a64");
+    std::vector<popo::PublisherPortData*> expectedPorts;
+    for (uint32_t i = 0U; i < 6U; ++i)
+    {
+        const auto& runtimeName = (i % 2U == 0U) ? m_applicationName : m_runtimeName;
+        auto publisherPort = sut.addPublisherPort(
+            m_serviceDescription, &m_memoryManager, runtimeName, m_publisherOptions, m_memoryInfo);
+        ASSERT_FALSE(publisherPort.has_error());
+        if (runtimeName == m_applicationName)
+        {
+            expectedPorts.push_back(publisherPort.value());
+        }
+    }
+
+    std::vector<popo::PublisherPortData*> visitedPorts;
+    sut.forEachPublisherPortOf(m_applicationName, [&](auto* port) { visitedPorts.push_back(port); });
+
+    EXPECT_THAT(visitedPorts, UnorderedElementsAreArray(expectedPorts));
+}
+
+TEST_F(PortPool_test, ForEachPublisherPortOfDoesNotVisitRemovedPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a7e2c9f1-3b5d-4d8a-b6e4-1c9f0a2d7e35");
+    auto publisherPort1 = sut.addPublisherPort(
+        m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions, m_memoryInfo);
+    auto publisherPort2 = sut.addPublisherPort(
+        m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions, m_memoryInfo);
+    ASSERT_FALSE(publisherPort1.has_error());
+    ASSERT_FALSE(publisherPort2.has_error());
+
+    sut.removePublisherPort(publisherPort1.value());
+
+    std::vector<popo::PublisherPortData*> visitedPorts;
+    sut.forEachPublisherPortOf(m_applicationName, [&](auto* port) { visitedPorts.push_back(port); });
+
+    EXPECT_THAT(visitedPorts, ElementsAre(publisherPort2.value()));
+}
+
+TEST_F(PortPool_test, ForEachPortOfAllowsRemovingTheVisitedPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5c1e8b3a-9d2f-4a7c-8e6b-3f0d4a9c2e17");
+    ASSERT_TRUE(addClientPorts(3U, [](auto&, auto&, auto&) {}));
+    ASSERT_TRUE(addServerPorts(3U, [](auto&, auto&, auto&) {}));
+    ASSERT_FALSE(sut.addInterfacePort(m_applicationName, Interfaces::INTERNAL).has_error());
+    ASSERT_FALSE(sut.addConditionVariableData(m_applicationName).has_error());
+    ASSERT_FALSE(sut.addSubscriberPort(m_serviceDescription, m_applicationName, m_subscriberOptions).has_error());
+
+    const RuntimeName_t runtimeName{"AppName1"};
+    sut.forEachClientPortOf(runtimeName, [&](auto* port) { sut.removeClientPort(port); });
+    sut.forEachServerPortOf(runtimeName, [&](auto* port) { sut.removeServerPort(port); });
+    sut.forEachInterfacePortOf(m_applicationName, [&](auto* port) { sut.removeInterfacePort(port); });
+    sut.forEachConditionVariableDataOf(m_applicationName, [&](auto* data) { sut.removeConditionVariableData(data); });
+    sut.forEachSubscriberPortOf(m_applicationName, [&](auto* port) { sut.removeSubscriberPort(port); });
+
+    EXPECT_THAT(sut.getClientPortDataList().size(), Eq(2U));
+    EXPECT_THAT(sut.getServerPortDataList().size(), Eq(2U));
+    EXPECT_THAT(sut.getInterfacePortDataList().size(), Eq(0U));
+    EXPECT_THAT(sut.getConditionVariableDataList().size(), Eq(0U));
+    EXPECT_THAT(sut.getSubscriberPortDataList().size(), Eq(0U));
+}
+
+// END per runtime lookup tests
+
 } // namespace
@@ -0,0 +1,121 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_platform/unistd.hpp"
+#include "iceoryx_platform/wait.hpp"
+#include "iceoryx_posh/internal/roudi/process_exit_monitor.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+using namespace iox::units::duration_literals;
+
+class ProcessExitMonitor_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        if (!m_sut.isAvailable())
+        {
+            GTEST_SKIP() << "Process file descriptors are not available on this system";
+        }
+    }
+
+    void TearDown() override
+    {
+        if (m_childPid > 0)
+        {
+            int status{0};
+            waitpid(m_childPid, &status, 0);
+        }
+    }
+
+    /// @brief creates a child process which terminates immediately; the child is reaped in TearDown, therefore its
+    /// pid stays valid during the test
+    uint32_t createTerminatedChildProcess()
+    {
+        m_childPid = fork();
+        if (m_childPid == 0)
+        {
+            _exit(0);
+        }
+        EXPECT_THAT(m_childPid, Gt(0));
+        return static_cast<uint32_t>(m_childPid);
+    }
+
+    static constexpr iox::units::Duration TIMEOUT{10_s};
+    static constexpr iox::units::Duration SHORT_TIMEOUT{10_ms};
+
+    pid_t m_childPid{0};
+    ProcessExitMonitor m_sut;
+};
+
+TEST_F(ProcessExitMonitor_test, TerminatedProcessIsReported)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4b8e1f2a-9c3d-4a5e-b6f7-0d1c2e3f4a5b");
+    const auto pid = createTerminatedChildProcess();
+    ASSERT_TRUE(m_sut.add(pid));
+
+    const auto terminatedProcesses = m_sut.waitForTerminatedProcesses(TIMEOUT);
+
+    ASSERT_THAT(terminatedProcesses.size(), Eq(1U));
+    EXPECT_THAT(terminatedProcesses[0], Eq(pid));
+}
+
+TEST_F(ProcessExitMonitor_test, TerminatedProcessIsReportedOnlyOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a9d2c7e4-1f3b-4e6a-8c5d-7b0e9f2a1c36");
+    const auto pid = createTerminatedChildProcess();
+    ASSERT_TRUE(m_sut.add(pid));
+    ASSERT_THAT(m_sut.waitForTerminatedProcesses(TIMEOUT).size(), Eq(1U));
+
+    EXPECT_TRUE(m_sut.waitForTerminatedProcesses(SHORT_TIMEOUT).empty());
+}
+
+TEST_F(ProcessExitMonitor_test, RemovedProcessIsNotReported)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e1f5a3b8-6d2c-4f9e-a7b1-3c8d0e4f2a97");
+    const auto pid = createTerminatedChildProcess();
+    ASSERT_TRUE(m_sut.add(pid));
+
+    m_sut.remove(pid);
+
+    EXPECT_TRUE(m_sut.waitForTerminatedProcesses(SHORT_TIMEOUT).empty());
+}
+
+TEST_F(ProcessExitMonitor_test, RunningProcessIsNotReported)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7c2e9a4f-5b1d-4c8e-9f3a-2d6b8e0c1f54");
+    ASSERT_TRUE(m_sut.add(static_cast<uint32_t>(getpid())));
+
+    EXPECT_TRUE(m_sut.waitForTerminatedProcesses(SHORT_TIMEOUT).empty());
+}
+
+TEST_F(ProcessExitMonitor_test, AddingNonExistingProcessFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d5b0f8e2-3a7c-4d1e-b9f6-8e2a4c7d0b13");
+    const auto pid = createTerminatedChildProcess();
+    int status{0};
+    ASSERT_THAT(waitpid(m_childPid, &status, 0), Eq(m_childPid));
+    m_childPid = 0;
+
+    EXPECT_FALSE(m_sut.add(pid));
+}
+
+} // namespace
@@ -171,4 +171,24 @@ TEST_F(ProcessManager_test, HandleProcessShutdownPreparationRequestWorks)
     ASSERT_FALSE(publisher.isOffered());
 }
 
+TEST_F(ProcessManager_test, HandleTerminatedProcessRemovesProcess)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8e0b5d2c-4f1a-4c7e-9b3d-6a2f1e8c7d45");
+    ASSERT_TRUE(m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo));
+
+    m_sut->handleTerminatedProcess(m_pid);
+
+    EXPECT_THAT(m_sut->registeredProcessCount(), Eq(0));
+}
+
+TEST_F(ProcessManager_test, HandleTerminatedProcessWithUnknownPidDoesNotRemoveProcess)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c3a7e915-2b6d-4e8f-a041-5d9c8b7e6f12");
+    ASSERT_TRUE(m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo));
+
+    m_sut->handleTerminatedProcess(m_pid + 1U);
+
+    EXPECT_THAT(m_sut->registeredProcessCount(), Eq(1));
+}
+
 } // namespace
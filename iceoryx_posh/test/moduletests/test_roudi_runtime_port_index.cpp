@@ -0,0 +1,156 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/runtime_port_index.hpp"
+
+#include "test.hpp"
+
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::roudi;
+
+struct PortDataStub
+{
+    RuntimeName_t m_runtimeName;
+};
+
+class RuntimePortIndex_test : public Test
+{
+  public:
+    static constexpr uint64_t CAPACITY{8U};
+
+    std::vector<PortDataStub*> portsOf(const RuntimeName_t& runtimeName)
+    {
+        std::vector<PortDataStub*> ports;
+        m_sut.forEachPortOf(runtimeName, [&](auto* port) { ports.push_back(port); });
+        return ports;
+    }
+
+    const RuntimeName_t m_runtimeA{"A"};
+    const RuntimeName_t m_runtimeB{"B"};
+    PortDataStub m_ports[CAPACITY + 1U]{{m_runtimeA}, {m_runtimeB}, {m_runtimeA}, {m_runtimeB}, {m_runtimeA},
+                                        {m_runtimeB}, {m_runtimeA}, {m_runtimeB}, {m_runtimeA}};
+    RuntimePortIndex<PortDataStub, CAPACITY> m_sut;
+};
+
+TEST_F(RuntimePortIndex_test, IndexIsInitiallyEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1e4c7a92-5d3b-4f8e-a6c1-9b2d0e7f3a58");
+    EXPECT_THAT(m_sut.size(), Eq(0U));
+    EXPECT_TRUE(portsOf(m_runtimeA).empty());
+}
+
+TEST_F(RuntimePortIndex_test, AddedPortsAreVisitedForTheirRuntimeOnly)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6b9f2d4e-8a1c-4e7b-93f5-2c0d8e6a1b47");
+    ASSERT_TRUE(m_sut.add(&m_ports[0]));
+    ASSERT_TRUE(m_sut.add(&m_ports[1]));
+    ASSERT_TRUE(m_sut.add(&m_ports[2]));
+
+    EXPECT_THAT(m_sut.size(), Eq(3U));
+    EXPECT_THAT(portsOf(m_runtimeA), UnorderedElementsAre(&m_ports[0], &m_ports[2]));
+    EXPECT_THAT(portsOf(m_runtimeB), ElementsAre(&m_ports[1]));
+    EXPECT_TRUE(portsOf(RuntimeName_t("C")).empty());
+}
+
+TEST_F(RuntimePortIndex_test, AddingMoreThanCapacityPortsFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c8a3e5f1-2b7d-4c9a-b0e6-4f1d3a8c5e92");
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        ASSERT_TRUE(m_sut.add(&m_ports[i]));
+    }
+
+    EXPECT_FALSE(m_sut.add(&m_ports[CAPACITY]));
+    EXPECT_THAT(m_sut.size(), Eq(CAPACITY));
+}
+
+TEST_F(RuntimePortIndex_test, RemovedPortIsNotVisited)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f7b1c9e-6d2a-4e8f-a5b3-8c0e2d4f6a71");
+    for (uint64_t i = 0U; i < 5U; ++i)
+    {
+        ASSERT_TRUE(m_sut.add(&m_ports[i]));
+    }
+
+    m_sut.remove(&m_ports[2]);
+
+    EXPECT_THAT(m_sut.size(), Eq(4U));
+    EXPECT_THAT(portsOf(m_runtimeA), UnorderedElementsAre(&m_ports[0], &m_ports[4]));
+    EXPECT_THAT(portsOf(m_runtimeB), UnorderedElementsAre(&m_ports[1], &m_ports[3]));
+}
+
+TEST_F(RuntimePortIndex_test, RemovingAllPortsOfRuntimeKeepsOtherRuntimes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a2d6f8b4-9e1c-4a3f-8b7d-5e0c9f2a4d16");
+    ASSERT_TRUE(m_sut.add(&m_ports[0]));
+    ASSERT_TRUE(m_sut.add(&m_ports[1]));
+
+    m_sut.remove(&m_ports[0]);
+
+    EXPECT_TRUE(portsOf(m_runtimeA).empty());
+    EXPECT_THAT(portsOf(m_runtimeB), ElementsAre(&m_ports[1]));
+}
+
+TEST_F(RuntimePortIndex_test, RemovingPortWhichIsNotContainedDoesNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e9c1a4d7-3b8f-4d2e-a6c5-1f7b0e9d3a84");
+    ASSERT_TRUE(m_sut.add(&m_ports[0]));
+
+    m_sut.remove(&m_ports[2]);
+    m_sut.remove(&m_ports[1]);
+
+    EXPECT_THAT(m_sut.size(), Eq(1U));
+    EXPECT_THAT(portsOf(m_runtimeA), ElementsAre(&m_ports[0]));
+}
+
+TEST_F(RuntimePortIndex_test, RemovedNodesAreReused)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5d8e2a6c-1f4b-4c7d-9e3a-7b2f0d5c8e19");
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        ASSERT_TRUE(m_sut.add(&m_ports[i]));
+    }
+    m_sut.remove(&m_ports[3]);
+
+    EXPECT_TRUE(m_sut.add(&m_ports[CAPACITY]));
+    EXPECT_THAT(portsOf(m_runtimeA).size(), Eq(5U));
+}
+
+TEST_F(RuntimePortIndex_test, PortsCanBeRemovedWhileVisitingThem)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b4f0c7e3-8a2d-4b6f-a1e9-3d5c7f0b2e68");
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        ASSERT_TRUE(m_sut.add(&m_ports[i]));
+    }
+
+    uint64_t numberOfVisitedPorts{0U};
+    m_sut.forEachPortOf(m_runtimeA, [&](auto* port) {
+        ++numberOfVisitedPorts;
+        m_sut.remove(port);
+    });
+
+    EXPECT_THAT(numberOfVisitedPorts, Eq(CAPACITY / 2U));
+    EXPECT_TRUE(portsOf(m_runtimeA).empty());
+    EXPECT_THAT(portsOf(m_runtimeB).size(), Eq(CAPACITY / 2U));
+}
+
+} // namespace
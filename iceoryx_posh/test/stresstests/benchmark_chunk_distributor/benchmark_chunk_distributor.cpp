@@ -0,0 +1,123 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iox/bump_allocator.hpp"
+
+#include "../../../../iceoryx_hoofs/test/stresstests/benchmark_optional_and_expected/benchmark.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace iox::mepoo;
+using namespace iox::popo;
+
+constexpr uint32_t MAX_NUMBER_OF_QUEUES{100U};
+constexpr uint64_t USER_PAYLOAD_SIZE{64U};
+constexpr uint32_t NUMBER_OF_CHUNKS{4U};
+
+struct ChunkDistributorConfig
+{
+    static constexpr uint32_t MAX_QUEUES = MAX_NUMBER_OF_QUEUES;
+    static constexpr uint64_t MAX_HISTORY_CAPACITY = 1U;
+};
+
+struct ChunkQueueConfig
+{
+    static constexpr uint64_t MAX_QUEUE_CAPACITY = 4U;
+    static constexpr uint64_t INLINE_USER_PAYLOAD_CAPACITY = 0U;
+};
+
+using ChunkQueueData_t = ChunkQueueData<ChunkQueueConfig, ThreadSafePolicy>;
+using ChunkDistributorData_t =
+    ChunkDistributorData<ChunkDistributorConfig, ThreadSafePolicy, ChunkQueuePusher<ChunkQueueData_t>>;
+using ChunkDistributor_t = ChunkDistributor<ChunkDistributorData_t>;
+
+/// @brief a publisher with a history of one which delivers the same chunk over and over again to the subscriber
+/// queues; the queues are emptied after each delivery, which results in the reference counter updates of a sample
+/// that is received and released by each subscriber
+template <uint32_t NumberOfQueues>
+class FanOut
+{
+  public:
+    FanOut()
+    {
+        for (uint32_t i = 0U; i < NumberOfQueues; ++i)
+        {
+            m_queueData.emplace_back(std::make_unique<ChunkQueueData_t>(
+                QueueFullPolicy::DISCARD_OLDEST_DATA, VariantQueueTypes::SoFi_SingleProducerSingleConsumer));
+            IOX_DISCARD_RESULT(m_distributor.tryAddQueue(m_queueData.back().get()));
+        }
+
+        auto chunkSettings = ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT)
+                                 .expect("Valid chunk settings");
+        auto* chunkHeader = new (m_mempool.getChunk()) ChunkHeader(m_mempool.getChunkSize(), chunkSettings);
+        auto* chunkManagement =
+            new (m_chunkManagementPool.getChunk()) ChunkManagement{chunkHeader, &m_mempool, &m_chunkManagementPool};
+        m_chunk = SharedChunk(chunkManagement);
+    }
+
+    uint64_t deliverAndRelease()
+    {
+        auto numberOfDeliveries = m_distributor.deliverToAllStoredQueues(m_chunk);
+        for (auto& queueData : m_queueData)
+        {
+            IOX_DISCARD_RESULT(ChunkQueuePopper<ChunkQueueData_t>(queueData.get()).tryPop());
+        }
+        return numberOfDeliveries;
+    }
+
+  private:
+    static constexpr uint64_t MEMORY_SIZE{4096U};
+    std::unique_ptr<uint8_t[]> m_memory{new uint8_t[MEMORY_SIZE]};
+    iox::BumpAllocator m_allocator{m_memory.get(), MEMORY_SIZE};
+    MemPool m_mempool{sizeof(ChunkHeader) + USER_PAYLOAD_SIZE, NUMBER_OF_CHUNKS, m_allocator, m_allocator};
+    MemPool m_chunkManagementPool{sizeof(ChunkManagement), NUMBER_OF_CHUNKS, m_allocator, m_allocator};
+    std::vector<std::unique_ptr<ChunkQueueData_t>> m_queueData;
+    ChunkDistributorData_t m_distributorData{ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, 1U};
+    ChunkDistributor_t m_distributor{&m_distributorData};
+    SharedChunk m_chunk;
+};
+
+uint64_t globalCounter{0U};
+
+template <uint32_t NumberOfQueues>
+void deliverToQueues()
+{
+    static FanOut<NumberOfQueues> fanOut;
+    globalCounter += fanOut.deliverAndRelease();
+}
+
+int main()
+{
+    using namespace iox::units::duration_literals;
+    auto timeout = 1_s;
+
+    BENCHMARK(deliverToQueues<1U>, timeout);
+    BENCHMARK(deliverToQueues<10U>, timeout);
+    BENCHMARK(deliverToQueues<MAX_NUMBER_OF_QUEUES>, timeout);
+
+    return (globalCounter != 0U) ? 0 : 1;
+}
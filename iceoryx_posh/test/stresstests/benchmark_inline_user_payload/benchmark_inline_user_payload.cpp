@@ -0,0 +1,147 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_sender.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_sender_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/bump_allocator.hpp"
+
+#include "../../../../iceoryx_hoofs/test/stresstests/benchmark_optional_and_expected/benchmark.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace iox::mepoo;
+using namespace iox::popo;
+
+constexpr uint32_t MAX_NUMBER_OF_RECEIVERS{10U};
+constexpr uint32_t NUMBER_OF_CHUNKS{64U};
+constexpr uint32_t MAX_CHUNKS_ALLOCATED{8U};
+constexpr uint32_t MAX_CHUNKS_HELD{8U};
+
+struct ChunkDistributorConfig
+{
+    static constexpr uint32_t MAX_QUEUES = MAX_NUMBER_OF_RECEIVERS;
+    static constexpr uint64_t MAX_HISTORY_CAPACITY = 1U;
+};
+
+struct ChunkQueueConfig
+{
+    static constexpr uint64_t MAX_QUEUE_CAPACITY = 4U;
+    static constexpr uint64_t INLINE_USER_PAYLOAD_CAPACITY = 16U;
+};
+
+using ChunkQueueData_t = ChunkQueueData<ChunkQueueConfig, ThreadSafePolicy>;
+using ChunkDistributorData_t =
+    ChunkDistributorData<ChunkDistributorConfig, ThreadSafePolicy, ChunkQueuePusher<ChunkQueueData_t>>;
+using ChunkSenderData_t = ChunkSenderData<MAX_CHUNKS_ALLOCATED, ChunkDistributorData_t>;
+using ChunkReceiverData_t = ChunkReceiverData<MAX_CHUNKS_HELD, ChunkQueueData_t>;
+
+/// @brief a publisher which sends a small sample to the subscribers which receive and release it immediately, either
+/// with a chunk from a mempool or with the user-payload copied inline into the subscriber queues
+template <bool InlineUserPayload, uint32_t NumberOfReceivers>
+class PublishSubscribe
+{
+  public:
+    PublishSubscribe()
+    {
+        MePooConfig mempoolConfig;
+        mempoolConfig.addMemPool({sizeof(uint64_t), NUMBER_OF_CHUNKS});
+        m_memoryManager.configureMemoryManager(mempoolConfig, m_allocator, m_allocator);
+
+        m_senderData.m_inlineUserPayload = InlineUserPayload;
+        for (uint32_t i = 0U; i < NumberOfReceivers; ++i)
+        {
+            m_receiverData.emplace_back(std::make_unique<ChunkReceiverData_t>(
+                VariantQueueTypes::SoFi_SingleProducerSingleConsumer, QueueFullPolicy::DISCARD_OLDEST_DATA));
+            m_receivers.emplace_back(std::make_unique<ChunkReceiver<ChunkReceiverData_t>>(m_receiverData.back().get()));
+            IOX_DISCARD_RESULT(m_sender.tryAddQueue(m_receiverData.back().get()));
+        }
+    }
+
+    uint64_t sendAndReceive(const uint64_t value)
+    {
+        uint64_t sum{0U};
+        m_sender
+            .tryAllocate(m_originId,
+                         sizeof(uint64_t),
+                         alignof(uint64_t),
+                         iox::CHUNK_NO_USER_HEADER_SIZE,
+                         iox::CHUNK_NO_USER_HEADER_ALIGNMENT)
+            .and_then([&](auto chunkHeader) {
+                *static_cast<uint64_t*>(chunkHeader->userPayload()) = value;
+                m_sender.send(chunkHeader);
+            });
+
+        for (auto& receiver : m_receivers)
+        {
+            receiver->tryGet().and_then([&](auto chunkHeader) {
+                sum += *static_cast<const uint64_t*>(chunkHeader->userPayload());
+                receiver->release(chunkHeader);
+            });
+        }
+        return sum;
+    }
+
+  private:
+    static constexpr uint64_t MEMORY_SIZE{1024U * 1024U};
+    std::unique_ptr<uint8_t[]> m_memory{new uint8_t[MEMORY_SIZE]};
+    iox::BumpAllocator m_allocator{m_memory.get(), MEMORY_SIZE};
+    MemoryManager m_memoryManager;
+    const UniquePortId m_originId{iox::roudi::DEFAULT_UNIQUE_ROUDI_ID};
+    ChunkSenderData_t m_senderData{&m_memoryManager, ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
+    ChunkSender<ChunkSenderData_t> m_sender{&m_senderData};
+    std::vector<std::unique_ptr<ChunkReceiverData_t>> m_receiverData;
+    std::vector<std::unique_ptr<ChunkReceiver<ChunkReceiverData_t>>> m_receivers;
+};
+
+uint64_t globalCounter{0U};
+
+template <uint32_t NumberOfReceivers>
+void sendWithChunk()
+{
+    static PublishSubscribe<false, NumberOfReceivers> publishSubscribe;
+    globalCounter += publishSubscribe.sendAndReceive(globalCounter + 1U);
+}
+
+template <uint32_t NumberOfReceivers>
+void sendWithInlineUserPayload()
+{
+    static PublishSubscribe<true, NumberOfReceivers> publishSubscribe;
+    globalCounter += publishSubscribe.sendAndReceive(globalCounter + 1U);
+}
+
+int main()
+{
+    using namespace iox::units::duration_literals;
+    auto timeout = 1_s;
+
+    BENCHMARK(sendWithChunk<1U>, timeout);
+    BENCHMARK(sendWithInlineUserPayload<1U>, timeout);
+    BENCHMARK(sendWithChunk<MAX_NUMBER_OF_RECEIVERS>, timeout);
+    BENCHMARK(sendWithInlineUserPayload<MAX_NUMBER_OF_RECEIVERS>, timeout);
+
+    return (globalCounter != 0U) ? 0 : 1;
+}
@@ -132,14 +132,20 @@ class IntrospectionApp
     /// @brief prints table showing current mempool usage
     void printMemPoolInfo(const MemPoolIntrospectionInfo& introspectionInfo);
 
+    /// @brief creates a subscriber which requests as many samples from the history as fit into its queue
     template <typename Topic>
     iox::unique_ptr<iox::popo::Subscriber<Topic>>
-    createSubscriber(const iox::capro::ServiceDescription& serviceDescription) noexcept;
+    createSubscriber(const iox::capro::ServiceDescription& serviceDescription,
+                     const uint64_t queueCapacity = 1U) noexcept;
 
     /// @brief Waits till port is subscribed
     template <typename Subscriber>
     bool waitForSubscription(Subscriber& port);
 
+    /// @brief Applies the added and removed ports of a delta to the port data; deltas which do not continue the
+    /// generation of the port data are ignored, the next port data which is received replaces the outdated one
+    static void applyPortDelta(PortIntrospectionFieldTopic& portData, const PortIntrospectionDeltaTopic& delta) noexcept;
+
     /// @brief Prepares the publisher port data before printing
     std::vector<ComposedPublisherPortData>
     composePublisherPortData(const PortIntrospectionFieldTopic* portData,
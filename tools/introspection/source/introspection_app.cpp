@@ -31,6 +31,7 @@
 
 #include <chrono>
 #include <iomanip>
+#include <memory>
 #include <poll.h>
 #include <thread>
 
@@ -544,11 +545,12 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
 
 template <typename Topic>
 iox::unique_ptr<iox::popo::Subscriber<Topic>>
-IntrospectionApp::createSubscriber(const iox::capro::ServiceDescription& serviceDescription) noexcept
+IntrospectionApp::createSubscriber(const iox::capro::ServiceDescription& serviceDescription,
+                                   const uint64_t queueCapacity) noexcept
 {
     popo::SubscriberOptions subscriberOptions;
-    subscriberOptions.queueCapacity = 1U;
-    subscriberOptions.historyRequest = 1U;
+    subscriberOptions.queueCapacity = queueCapacity;
+    subscriberOptions.historyRequest = queueCapacity;
 
     return iox::unique_ptr<iox::popo::Subscriber<Topic>>{
         new iox::popo::Subscriber<Topic>{serviceDescription, subscriberOptions}, [&](auto* const pub) { delete pub; }};
@@ -569,6 +571,46 @@ bool IntrospectionApp::waitForSubscription(Subscriber& port)
     return subscribed;
 }
 
+void IntrospectionApp::applyPortDelta(PortIntrospectionFieldTopic& portData,
+                                      const PortIntrospectionDeltaTopic& delta) noexcept
+{
+    if (delta.m_baseGeneration != portData.m_generation)
+    {
+        return;
+    }
+
+    auto removePorts = [](auto& portList, const auto& removedPortIDs, auto portIdOf) {
+        for (const auto removedPortID : removedPortIDs)
+        {
+            for (auto port = portList.begin(); port != portList.end(); ++port)
+            {
+                if (portIdOf(*port) == removedPortID)
+                {
+                    portList.erase(port);
+                    break;
+                }
+            }
+        }
+    };
+    removePorts(portData.m_publisherList, delta.m_removedPublisherPortIDs, [](const PublisherPortData& port) {
+        return port.m_publisherPortID;
+    });
+    removePorts(portData.m_subscriberList, delta.m_removedSubscriberPortIDs, [](const SubscriberPortData& port) {
+        return port.m_subscriberPortID;
+    });
+
+    for (const auto& publisher : delta.m_addedPublishers)
+    {
+        portData.m_publisherList.push_back(publisher);
+    }
+    for (const auto& subscriber : delta.m_addedSubscribers)
+    {
+        portData.m_subscriberList.push_back(subscriber);
+    }
+
+    portData.m_generation = delta.m_generation;
+}
+
 std::vector<ComposedPublisherPortData>
 IntrospectionApp::composePublisherPortData(const PortIntrospectionFieldTopic* portData,
                                            const PortThroughputIntrospectionFieldTopic* throughputData)
@@ -625,13 +667,21 @@ std::vector<ComposedSubscriberPortData> IntrospectionApp::composeSubscriberPortD
     std::vector<ComposedSubscriberPortData> subscriberPortData;
     subscriberPortData.reserve(portData->m_subscriberList.size());
 
-    uint32_t i = 0U;
-    if (portData->m_subscriberList.size() == subscriberPortChangingData->subscriberPortChangingDataList.size())
-    { // should be the same, else it will be soon
-        for (const auto& port : portData->m_subscriberList)
+    // the port data is assembled from deltas and therefore the order of the subscribers can differ
+    const SubscriberPortChangingData dummySubscriberPortChangingData;
+    const auto& changingDataList = subscriberPortChangingData->subscriberPortChangingDataList;
+    for (const auto& port : portData->m_subscriberList)
+    {
+        const SubscriberPortChangingData* changingData = &dummySubscriberPortChangingData;
+        for (const auto& data : changingDataList)
         {
-            subscriberPortData.push_back({port, subscriberPortChangingData->subscriberPortChangingDataList[i++]});
+            if (data.subscriberPortID == port.m_subscriberPortID)
+            {
+                changingData = &data;
+                break;
+            }
         }
+        subscriberPortData.push_back({port, *changingData});
     }
 
     auto subscriberSortCriterion = [](const ComposedSubscriberPortData& subscriber1,
@@ -730,12 +780,19 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
                                                     .history_request(1)
                                                     .create<SubscriberPortChangingIntrospectionFieldTopic>()
                                                     .expect("Getting subscriber for mempool topic");
+    auto portDeltaSubscriber = node.subscriber(IntrospectionPortDeltaService)
+                                   .queue_capacity(PORT_INTROSPECTION_DELTAS_PER_SNAPSHOT)
+                                   .history_request(PORT_INTROSPECTION_DELTAS_PER_SNAPSHOT)
+                                   .create<PortIntrospectionDeltaTopic>()
+                                   .expect("Getting subscriber for port delta topic");
 #else
     auto portSubscriber = createSubscriber<PortIntrospectionFieldTopic>(IntrospectionPortService);
     auto portThroughputSubscriber =
         createSubscriber<PortThroughputIntrospectionFieldTopic>(IntrospectionPortThroughputService);
     auto subscriberPortChangingDataSubscriber =
         createSubscriber<SubscriberPortChangingIntrospectionFieldTopic>(IntrospectionSubscriberPortChangingDataService);
+    auto portDeltaSubscriber = createSubscriber<PortIntrospectionDeltaTopic>(IntrospectionPortDeltaService,
+                                                                             PORT_INTROSPECTION_DELTAS_PER_SNAPSHOT);
 #endif
 
     if (introspectionSelection.port == true)
@@ -743,6 +800,7 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
         portSubscriber->subscribe();
         portThroughputSubscriber->subscribe();
         subscriberPortChangingDataSubscriber->subscribe();
+        portDeltaSubscriber->subscribe();
 
         if (waitForSubscription(portSubscriber) == false)
         {
@@ -758,6 +816,11 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
             prettyPrint("Timeout while waiting for Subscription for Subscriber Port Introspection Changing Data!\n",
                         PrettyOptions::error);
         }
+        if (waitForSubscription(portDeltaSubscriber) == false)
+        {
+            prettyPrint("Timeout while waiting for subscription for port delta introspection data!\n",
+                        PrettyOptions::error);
+        }
     }
 
     // Refresh once in case of timeout messages
@@ -765,7 +828,8 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
 
     optional<popo::Sample<const MemPoolIntrospectionInfoContainer>> memPoolSample;
     optional<popo::Sample<const ProcessIntrospectionFieldTopic>> processSample;
-    optional<popo::Sample<const PortIntrospectionFieldTopic>> portSample;
+    // the port data is a local copy since it is updated with the deltas between two port topics
+    std::unique_ptr<PortIntrospectionFieldTopic> portData;
     optional<popo::Sample<const PortThroughputIntrospectionFieldTopic>> portThroughputSample;
     optional<popo::Sample<const SubscriberPortChangingIntrospectionFieldTopic>> subscriberPortChangingDataSamples;
 
@@ -827,20 +891,42 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
         // print port information
         if (introspectionSelection.port == true)
         {
-            portSubscriber->take().and_then([&](auto& sample) { portSample = std::move(sample); });
+            portSubscriber->take().and_then([&](auto& sample) {
+                if (!portData)
+                {
+                    portData = std::make_unique<PortIntrospectionFieldTopic>(*sample);
+                }
+                else if (sample->m_generation >= portData->m_generation)
+                {
+                    *portData = *sample;
+                }
+            });
+
+            bool hasReceivedDelta{true};
+            while (hasReceivedDelta)
+            {
+                hasReceivedDelta = false;
+                portDeltaSubscriber->take().and_then([&](auto& sample) {
+                    hasReceivedDelta = true;
+                    if (portData)
+                    {
+                        applyPortDelta(*portData, *sample);
+                    }
+                });
+            }
 
             portThroughputSubscriber->take().and_then([&](auto& sample) { portThroughputSample = std::move(sample); });
 
             subscriberPortChangingDataSubscriber->take().and_then(
                 [&](auto& sample) { subscriberPortChangingDataSamples = std::move(sample); });
 
-            if (portSample && portThroughputSample && subscriberPortChangingDataSamples)
+            if (portData && portThroughputSample && subscriberPortChangingDataSamples)
             {
                 prettyPrint("### Connections ###\n\n", PrettyOptions::highlight);
                 auto composedPublisherPortData =
-                    composePublisherPortData(portSample.value().get(), portThroughputSample.value().get());
-                auto composedSubscriberPortData = composeSubscriberPortData(
-                    portSample.value().get(), subscriberPortChangingDataSamples.value().get());
+                    composePublisherPortData(portData.get(), portThroughputSample.value().get());
+                auto composedSubscriberPortData =
+                    composeSubscriberPortData(portData.get(), subscriberPortChangingDataSamples.value().get());
 
                 printPortIntrospectionData(composedPublisherPortData, composedSubscriberPortData);
             }
@@ -0,0 +1,140 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORDING_FORMAT_HPP
+#define IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORDING_FORMAT_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iox/log/logstream.hpp"
+
+#include <cstdint>
+#include <ostream>
+
+namespace iox
+{
+namespace record_replay
+{
+/// @brief Layout of a recording file
+///
+///   +------------------------+ offset 0
+///   | RecordingFileHeader    |
+///   +------------------------+
+///   | RecordHeader           | \
+///   | TopicRecord / chunk    |  > one record per topic and per received chunk, each one padded to RECORD_ALIGNMENT
+///   | ...                    | /
+///   +------------------------+ RecordingFileHeader::indexOffset
+///   | IndexEntry[]           |   one entry per record, written when the recording is closed
+///   +------------------------+
+///
+/// The body of a chunk record is the chunk as it was in the shared memory, starting with the ChunkHeader and ending
+/// with the last byte of the user-payload. If the recording was not closed properly, e.g. since the recorder was
+/// killed, the index offset is zero and the records are found by a sequential scan which stops at the first record
+/// without a valid type.
+
+constexpr uint64_t RECORDING_FILE_MAGIC{0x314345522d584f49ULL}; // "IOX-REC1" in little endian
+constexpr uint32_t RECORDING_FORMAT_VERSION{1U};
+constexpr uint64_t RECORD_ALIGNMENT{8U};
+
+enum class RecordType : uint32_t
+{
+    INVALID = 0U,
+    TOPIC = 1U,
+    CHUNK = 2U,
+};
+
+struct RecordingFileHeader
+{
+    uint64_t magic{RECORDING_FILE_MAGIC};
+    uint32_t formatVersion{RECORDING_FORMAT_VERSION};
+    /// @brief the chunks are stored verbatim, therefore a recording can only be replayed with the same ChunkHeader
+    uint8_t chunkHeaderVersion{mepoo::ChunkHeader::CHUNK_HEADER_VERSION};
+    uint8_t reserved[3]{};
+    /// @brief wall-clock time in nanoseconds since epoch when the recording was started
+    uint64_t startTimestamp{0U};
+    /// @brief offset of the index; zero if the recording was not closed
+    uint64_t indexOffset{0U};
+    uint64_t numberOfIndexEntries{0U};
+};
+
+struct RecordHeader
+{
+    RecordType type{RecordType::INVALID};
+    uint32_t topicIndex{0U};
+    /// @brief nanoseconds since the start of the recording
+    uint64_t timestamp{0U};
+    /// @brief size of the record body without the padding
+    uint64_t size{0U};
+};
+
+struct TopicRecord
+{
+    char service[capro::IdString_t::capacity() + 1U]{};
+    char instance[capro::IdString_t::capacity() + 1U]{};
+    char event[capro::IdString_t::capacity() + 1U]{};
+};
+
+struct IndexEntry
+{
+    uint64_t offset{0U};
+    uint64_t timestamp{0U};
+    RecordType type{RecordType::INVALID};
+    uint32_t topicIndex{0U};
+};
+
+static_assert(sizeof(RecordingFileHeader) % RECORD_ALIGNMENT == 0U, "the first record must be aligned");
+static_assert(sizeof(RecordHeader) % RECORD_ALIGNMENT == 0U, "the record body must be aligned");
+static_assert(alignof(mepoo::ChunkHeader) <= RECORD_ALIGNMENT, "a recorded ChunkHeader must be aligned");
+
+enum class RecordingError
+{
+    UNABLE_TO_OPEN_FILE,
+    UNABLE_TO_WRITE_FILE,
+    UNABLE_TO_MAP_FILE,
+    INVALID_FILE_FORMAT,
+    INCOMPATIBLE_FORMAT_VERSION,
+    INCOMPATIBLE_CHUNK_HEADER_VERSION,
+    UNKNOWN_TOPIC,
+    RECORDING_ALREADY_CLOSED,
+};
+
+/// @brief Converts the RecordingError to a string literal
+/// @param[in] value to convert to a string literal
+/// @return pointer to a string literal
+const char* asStringLiteral(const RecordingError value) noexcept;
+
+/// @brief Convenience stream operator to easily use the 'asStringLiteral' function with std::ostream
+/// @param[in] stream sink to write the message to
+/// @param[in] value to convert to a string literal
+/// @return the reference to 'stream' which was provided as input parameter
+std::ostream& operator<<(std::ostream& stream, const RecordingError value) noexcept;
+
+/// @brief Convenience stream operator to easily use the 'asStringLiteral' function with iox::log::LogStream
+/// @param[in] stream sink to write the message to
+/// @param[in] value to convert to a string literal
+/// @return the reference to 'stream' which was provided as input parameter
+log::LogStream& operator<<(log::LogStream& stream, const RecordingError value) noexcept;
+
+/// @brief Rounds the size of a record body up to the next multiple of RECORD_ALIGNMENT
+constexpr uint64_t paddedRecordSize(const uint64_t size) noexcept
+{
+    return ((size + RECORD_ALIGNMENT - 1U) / RECORD_ALIGNMENT) * RECORD_ALIGNMENT;
+}
+
+} // namespace record_replay
+} // namespace iox
+
+#endif // IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORDING_FORMAT_HPP
@@ -0,0 +1,91 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORDING_READER_HPP
+#define IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORDING_READER_HPP
+
+#include "iceoryx_record_replay/recording_format.hpp"
+#include "iox/detail/posix_memory_map.hpp"
+#include "iox/expected.hpp"
+#include "iox/file_path.hpp"
+
+#include <vector>
+
+namespace iox
+{
+namespace record_replay
+{
+/// @brief Provides read access to a recording file. The whole file is memory mapped, the recorded chunks are
+/// therefore accessed in place without being copied.
+class RecordingReader
+{
+  public:
+    struct RecordedChunk
+    {
+        uint32_t topicIndex{0U};
+        /// @brief nanoseconds since the start of the recording
+        uint64_t timestamp{0U};
+        const mepoo::ChunkHeader* chunkHeader{nullptr};
+    };
+
+    /// @brief Opens a recording file and reads its index; if the recording was not closed, the records are found by
+    /// a sequential scan
+    /// @param[in] path of the recording file
+    /// @return the RecordingReader or a RecordingError if the file is not a compatible recording
+    static expected<RecordingReader, RecordingError> open(const FilePath& path) noexcept;
+
+    RecordingReader(const RecordingReader&) = delete;
+    RecordingReader(RecordingReader&&) noexcept = default;
+    RecordingReader& operator=(const RecordingReader&) = delete;
+    RecordingReader& operator=(RecordingReader&&) noexcept = default;
+    ~RecordingReader() noexcept = default;
+
+    /// @brief Returns the recorded topics, the position of a topic corresponds to RecordedChunk::topicIndex
+    const std::vector<capro::ServiceDescription>& topics() const noexcept;
+
+    /// @brief Returns the number of recorded chunks
+    uint64_t numberOfChunks() const noexcept;
+
+    /// @brief Returns a recorded chunk, the chunks are ordered by their timestamp
+    /// @param[in] index of the chunk, must be smaller than numberOfChunks()
+    RecordedChunk chunk(const uint64_t index) const noexcept;
+
+    /// @brief Returns the wall-clock time in nanoseconds since epoch when the recording was started
+    uint64_t startTimestamp() const noexcept;
+
+    /// @brief Returns true if the recording was closed and its index was used
+    bool isIndexed() const noexcept;
+
+  private:
+    RecordingReader(detail::PosixMemoryMap&& map, const uint64_t size) noexcept;
+
+    const uint8_t* data(const uint64_t offset) const noexcept;
+    const RecordingFileHeader& fileHeader() const noexcept;
+    expected<void, RecordingError> readRecords() noexcept;
+    expected<void, RecordingError> addRecord(const uint64_t offset) noexcept;
+
+  private:
+    detail::PosixMemoryMap m_map;
+    uint64_t m_size{0U};
+    std::vector<capro::ServiceDescription> m_topics;
+    std::vector<IndexEntry> m_chunks;
+    bool m_isIndexed{false};
+};
+
+} // namespace record_replay
+} // namespace iox
+
+#endif // IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORDING_READER_HPP
@@ -0,0 +1,103 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORDING_WRITER_HPP
+#define IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORDING_WRITER_HPP
+
+#include "iceoryx_record_replay/recording_format.hpp"
+#include "iox/detail/posix_memory_map.hpp"
+#include "iox/expected.hpp"
+#include "iox/file.hpp"
+#include "iox/file_path.hpp"
+#include "iox/optional.hpp"
+
+#include <vector>
+
+namespace iox
+{
+namespace record_replay
+{
+/// @brief Appends topics and chunks to a recording file. The file is grown in segments of a fixed size which are
+/// memory mapped, therefore a chunk is copied exactly once from the shared memory into the page cache and the number
+/// of system calls does not depend on the number of recorded chunks. The index is written on close().
+class RecordingWriter
+{
+  public:
+    static constexpr uint64_t DEFAULT_SEGMENT_SIZE{16U * 1024U * 1024U};
+
+    /// @brief Creates a new recording file; an existing file is overwritten
+    /// @param[in] path of the recording file
+    /// @param[in] segmentSize by which the file is grown, it is rounded up to the page size
+    /// @return the RecordingWriter or a RecordingError if the file could not be created
+    static expected<RecordingWriter, RecordingError> create(const FilePath& path,
+                                                            const uint64_t segmentSize = DEFAULT_SEGMENT_SIZE) noexcept;
+
+    RecordingWriter(const RecordingWriter&) = delete;
+    RecordingWriter(RecordingWriter&&) noexcept = default;
+    RecordingWriter& operator=(const RecordingWriter&) = delete;
+    RecordingWriter& operator=(RecordingWriter&&) noexcept = default;
+    ~RecordingWriter() noexcept = default;
+
+    /// @brief Adds a topic to the recording
+    /// @param[in] service the description of the recorded service
+    /// @return the index of the topic which is used for addChunk or a RecordingError
+    expected<uint32_t, RecordingError> addTopic(const capro::ServiceDescription& service) noexcept;
+
+    /// @brief Adds a chunk to the recording by copying it from the ChunkHeader up to the end of the user-payload
+    /// @param[in] topicIndex the index of the topic returned by addTopic
+    /// @param[in] timestamp in nanoseconds since the start of the recording
+    /// @param[in] chunkHeader of the chunk to record
+    /// @return a RecordingError if the chunk could not be written
+    expected<void, RecordingError>
+    addChunk(const uint32_t topicIndex, const uint64_t timestamp, const mepoo::ChunkHeader& chunkHeader) noexcept;
+
+    /// @brief Writes the index, truncates the file to its final size and releases the mapping
+    /// @note If close() is not called, the recording stays readable by a sequential scan
+    expected<void, RecordingError> close() noexcept;
+
+    /// @brief Returns the number of recorded chunks
+    uint64_t numberOfChunks() const noexcept;
+
+  private:
+    RecordingWriter(File&& file, const uint64_t segmentSize) noexcept;
+
+    expected<void, RecordingError> appendRecord(const RecordType type,
+                                                const uint32_t topicIndex,
+                                                const uint64_t timestamp,
+                                                const void* const body,
+                                                const uint64_t size) noexcept;
+    expected<void, RecordingError> mapSegment(const uint64_t requiredSize) noexcept;
+    expected<void, RecordingError> writeFileHeader() noexcept;
+    expected<void, RecordingError> truncate(const uint64_t size) noexcept;
+
+  private:
+    File m_file;
+    RecordingFileHeader m_fileHeader;
+    uint64_t m_segmentSize{0U};
+    optional<detail::PosixMemoryMap> m_segment;
+    uint64_t m_segmentBegin{0U};
+    uint64_t m_segmentEnd{0U};
+    uint64_t m_writePosition{sizeof(RecordingFileHeader)};
+    uint32_t m_numberOfTopics{0U};
+    uint64_t m_numberOfChunks{0U};
+    std::vector<IndexEntry> m_index;
+    bool m_isClosed{false};
+};
+
+} // namespace record_replay
+} // namespace iox
+
+#endif // IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORDING_WRITER_HPP
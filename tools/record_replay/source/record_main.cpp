@@ -0,0 +1,195 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
+#include "iceoryx_posh/roudi/introspection_types.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_posh/runtime/service_discovery.hpp"
+#include "iceoryx_record_replay/recording_writer.hpp"
+#include "iox/cli_definition.hpp"
+#include "iox/signal_watcher.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace
+{
+constexpr char APP_NAME[] = "iox-record";
+constexpr uint64_t DISCOVERY_NOTIFICATION_ID{std::numeric_limits<uint64_t>::max()};
+constexpr uint64_t MEBIBYTE{1024U * 1024U};
+
+struct CommandLine
+{
+    IOX_CLI_DEFINITION(CommandLine);
+
+    IOX_CLI_REQUIRED(iox::cli::Argument_t, output, 'o', "output", "Path of the recording file");
+    IOX_CLI_OPTIONAL(iox::cli::Argument_t, service, {"*"}, 's', "service", "Service to record, '*' records all");
+    IOX_CLI_OPTIONAL(iox::cli::Argument_t, instance, {"*"}, 'i', "instance", "Instance to record, '*' records all");
+    IOX_CLI_OPTIONAL(iox::cli::Argument_t, event, {"*"}, 'e', "event", "Event to record, '*' records all");
+    IOX_CLI_OPTIONAL(uint64_t, segmentSize, 16U, 'm', "segment-size", "Size in MiB by which the file is grown");
+};
+
+iox::optional<iox::capro::IdString_t> toSearchString(const iox::cli::Argument_t& value)
+{
+    if (value == "*")
+    {
+        return iox::capro::Wildcard;
+    }
+    return iox::capro::IdString_t(iox::TruncateToCapacity, value.c_str(), value.size());
+}
+
+bool isInternalService(const iox::capro::ServiceDescription& service)
+{
+    return service.getServiceIDString() == iox::SERVICE_DISCOVERY_SERVICE_NAME
+           || service.getServiceIDString() == iox::roudi::INTROSPECTION_SERVICE_ID;
+}
+
+struct RecordedTopic
+{
+    iox::capro::ServiceDescription service;
+    std::unique_ptr<iox::popo::UntypedSubscriber> subscriber;
+};
+} // namespace
+
+int main(int argc, char** argv)
+{
+    using iox::record_replay::RecordingWriter;
+
+    auto cmd = CommandLine::parse(argc, argv, "Records the samples of all services which match the service filter");
+
+    auto path = iox::FilePath::create(cmd.output());
+    if (path.has_error())
+    {
+        std::cerr << "Invalid recording file path '" << cmd.output() << "'" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    auto writer = RecordingWriter::create(path.value(), cmd.segmentSize() * MEBIBYTE);
+    if (writer.has_error())
+    {
+        return EXIT_FAILURE;
+    }
+
+    iox::runtime::PoshRuntime::initRuntime(APP_NAME);
+
+    iox::runtime::ServiceDiscovery serviceDiscovery;
+    iox::popo::WaitSet<> waitSet;
+    waitSet
+        .attachEvent(
+            serviceDiscovery, iox::runtime::ServiceDiscoveryEvent::SERVICE_REGISTRY_CHANGED, DISCOVERY_NOTIFICATION_ID)
+        .or_else([](auto) {
+            std::cerr << "Unable to attach the service discovery to the waitset" << std::endl;
+            std::exit(EXIT_FAILURE);
+        });
+
+    // the topic index in the recording corresponds to the position in this vector and is used as notification id
+    std::vector<RecordedTopic> topics;
+    bool keepRecording{true};
+
+    auto subscribeToNewServices = [&] {
+        std::vector<iox::capro::ServiceDescription> newServices;
+        serviceDiscovery.findService(
+            toSearchString(cmd.service()),
+            toSearchString(cmd.instance()),
+            toSearchString(cmd.event()),
+            [&](const iox::capro::ServiceDescription& service) {
+                if (!isInternalService(service)
+                    && std::none_of(topics.begin(), topics.end(), [&](const auto& topic) {
+                           return topic.service == service;
+                       }))
+                {
+                    newServices.push_back(service);
+                }
+            },
+            iox::popo::MessagingPattern::PUB_SUB);
+
+        for (const auto& service : newServices)
+        {
+            auto subscriber = std::make_unique<iox::popo::UntypedSubscriber>(service);
+            const auto topicIndex = topics.size();
+            if (waitSet.attachState(*subscriber, iox::popo::SubscriberState::HAS_DATA, topicIndex).has_error())
+            {
+                std::cerr << "Unable to record " << service << " since the waitset is full" << std::endl;
+                continue;
+            }
+            if (writer->addTopic(service).has_error())
+            {
+                keepRecording = false;
+                return;
+            }
+            std::cout << "Recording " << service << std::endl;
+            topics.push_back(RecordedTopic{service, std::move(subscriber)});
+        }
+    };
+
+    const auto startTime = std::chrono::steady_clock::now();
+    auto recordSamples = [&](const uint32_t topicIndex) {
+        auto& subscriber = *topics[topicIndex].subscriber;
+        while (keepRecording)
+        {
+            auto userPayload = subscriber.take();
+            if (userPayload.has_error())
+            {
+                break;
+            }
+
+            const auto timestamp = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime)
+                    .count());
+            // the chunk is copied directly from the shared memory into the mapped recording file
+            const auto* chunkHeader = iox::mepoo::ChunkHeader::fromUserPayload(userPayload.value());
+            if (writer->addChunk(topicIndex, timestamp, *chunkHeader).has_error())
+            {
+                keepRecording = false;
+            }
+            subscriber.release(userPayload.value());
+        }
+    };
+
+    subscribeToNewServices();
+
+    while (keepRecording && !iox::hasTerminationRequested())
+    {
+        auto notificationVector = waitSet.timedWait(iox::units::Duration::fromMilliseconds(100U));
+
+        for (auto& notification : notificationVector)
+        {
+            if (notification->getNotificationId() == DISCOVERY_NOTIFICATION_ID)
+            {
+                subscribeToNewServices();
+            }
+            else
+            {
+                recordSamples(static_cast<uint32_t>(notification->getNotificationId()));
+            }
+        }
+    }
+
+    if (writer->close().has_error())
+    {
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "Recorded " << writer->numberOfChunks() << " samples of " << topics.size() << " topics into '"
+              << cmd.output() << "'" << std::endl;
+
+    return keepRecording ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,61 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_record_replay/recording_format.hpp"
+
+namespace iox
+{
+namespace record_replay
+{
+const char* asStringLiteral(const RecordingError value) noexcept
+{
+    switch (value)
+    {
+    case RecordingError::UNABLE_TO_OPEN_FILE:
+        return "RecordingError::UNABLE_TO_OPEN_FILE";
+    case RecordingError::UNABLE_TO_WRITE_FILE:
+        return "RecordingError::UNABLE_TO_WRITE_FILE";
+    case RecordingError::UNABLE_TO_MAP_FILE:
+        return "RecordingError::UNABLE_TO_MAP_FILE";
+    case RecordingError::INVALID_FILE_FORMAT:
+        return "RecordingError::INVALID_FILE_FORMAT";
+    case RecordingError::INCOMPATIBLE_FORMAT_VERSION:
+        return "RecordingError::INCOMPATIBLE_FORMAT_VERSION";
+    case RecordingError::INCOMPATIBLE_CHUNK_HEADER_VERSION:
+        return "RecordingError::INCOMPATIBLE_CHUNK_HEADER_VERSION";
+    case RecordingError::UNKNOWN_TOPIC:
+        return "RecordingError::UNKNOWN_TOPIC";
+    case RecordingError::RECORDING_ALREADY_CLOSED:
+        return "RecordingError::RECORDING_ALREADY_CLOSED";
+    }
+
+    return "[Undefined RecordingError]";
+}
+
+std::ostream& operator<<(std::ostream& stream, const RecordingError value) noexcept
+{
+    stream << asStringLiteral(value);
+    return stream;
+}
+
+log::LogStream& operator<<(log::LogStream& stream, const RecordingError value) noexcept
+{
+    stream << asStringLiteral(value);
+    return stream;
+}
+
+} // namespace record_replay
+} // namespace iox
@@ -0,0 +1,217 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_record_replay/recording_reader.hpp"
+#include "iox/assertions.hpp"
+#include "iox/file.hpp"
+#include "iox/logging.hpp"
+
+namespace iox
+{
+namespace record_replay
+{
+RecordingReader::RecordingReader(detail::PosixMemoryMap&& map, const uint64_t size) noexcept
+    : m_map(std::move(map))
+    , m_size(size)
+{
+}
+
+expected<RecordingReader, RecordingError> RecordingReader::open(const FilePath& path) noexcept
+{
+    auto file = FileBuilder().open_mode(OpenMode::OPEN_EXISTING).access_mode(AccessMode::READ_ONLY).create(path);
+    if (file.has_error())
+    {
+        IOX_LOG(ERROR, "Unable to open the recording file '" << path.as_string() << "'");
+        return err(RecordingError::UNABLE_TO_OPEN_FILE);
+    }
+
+    auto size = file->get_size();
+    if (size.has_error() || size.value() < sizeof(RecordingFileHeader))
+    {
+        IOX_LOG(ERROR, "The file '" << path.as_string() << "' is too small to be a recording");
+        return err(RecordingError::INVALID_FILE_FORMAT);
+    }
+
+    // the mapping stays valid after the file is closed
+    auto map = detail::PosixMemoryMapBuilder()
+                   .fileDescriptor(file->get_file_handle())
+                   .length(size.value())
+                   .accessMode(AccessMode::READ_ONLY)
+                   .flags(detail::PosixMemoryMapFlags::SHARE_CHANGES)
+                   .create();
+    if (map.has_error())
+    {
+        IOX_LOG(ERROR, "Unable to map the recording file '" << path.as_string() << "'");
+        return err(RecordingError::UNABLE_TO_MAP_FILE);
+    }
+
+    RecordingReader reader{std::move(map.value()), size.value()};
+    auto result = reader.readRecords();
+    if (result.has_error())
+    {
+        IOX_LOG(ERROR, "Unable to read the recording file '" << path.as_string() << "': " << result.error());
+        return err(result.error());
+    }
+
+    return ok(std::move(reader));
+}
+
+const std::vector<capro::ServiceDescription>& RecordingReader::topics() const noexcept
+{
+    return m_topics;
+}
+
+uint64_t RecordingReader::numberOfChunks() const noexcept
+{
+    return m_chunks.size();
+}
+
+RecordingReader::RecordedChunk RecordingReader::chunk(const uint64_t index) const noexcept
+{
+    IOX_ENFORCE(index < m_chunks.size(), "Chunk index out of bounds");
+    const auto& entry = m_chunks[index];
+    return RecordedChunk{entry.topicIndex,
+                         entry.timestamp,
+                         reinterpret_cast<const mepoo::ChunkHeader*>(data(entry.offset + sizeof(RecordHeader)))};
+}
+
+uint64_t RecordingReader::startTimestamp() const noexcept
+{
+    return fileHeader().startTimestamp;
+}
+
+bool RecordingReader::isIndexed() const noexcept
+{
+    return m_isIndexed;
+}
+
+const uint8_t* RecordingReader::data(const uint64_t offset) const noexcept
+{
+    return static_cast<const uint8_t*>(m_map.getBaseAddress()) + offset;
+}
+
+const RecordingFileHeader& RecordingReader::fileHeader() const noexcept
+{
+    return *reinterpret_cast<const RecordingFileHeader*>(data(0U));
+}
+
+expected<void, RecordingError> RecordingReader::readRecords() noexcept
+{
+    const auto& header = fileHeader();
+    if (header.magic != RECORDING_FILE_MAGIC)
+    {
+        return err(RecordingError::INVALID_FILE_FORMAT);
+    }
+    if (header.formatVersion != RECORDING_FORMAT_VERSION)
+    {
+        return err(RecordingError::INCOMPATIBLE_FORMAT_VERSION);
+    }
+    if (header.chunkHeaderVersion != mepoo::ChunkHeader::CHUNK_HEADER_VERSION)
+    {
+        return err(RecordingError::INCOMPATIBLE_CHUNK_HEADER_VERSION);
+    }
+
+    const uint64_t indexSize = header.numberOfIndexEntries * sizeof(IndexEntry);
+    m_isIndexed = header.indexOffset >= sizeof(RecordingFileHeader) && header.indexOffset <= m_size
+                  && indexSize / sizeof(IndexEntry) == header.numberOfIndexEntries
+                  && indexSize <= m_size - header.indexOffset;
+
+    if (m_isIndexed)
+    {
+        const auto* const index = reinterpret_cast<const IndexEntry*>(data(header.indexOffset));
+        for (uint64_t i = 0U; i < header.numberOfIndexEntries; ++i)
+        {
+            auto result = addRecord(index[i].offset);
+            if (result.has_error())
+            {
+                return result;
+            }
+        }
+        return ok();
+    }
+
+    IOX_LOG(WARN, "The recording was not closed, the records are read by a sequential scan");
+    uint64_t offset = sizeof(RecordingFileHeader);
+    while (offset + sizeof(RecordHeader) <= m_size)
+    {
+        const auto* const recordHeader = reinterpret_cast<const RecordHeader*>(data(offset));
+        if (recordHeader->type == RecordType::INVALID || addRecord(offset).has_error())
+        {
+            // the end of the written records or an incomplete record of an aborted recording
+            break;
+        }
+        offset += sizeof(RecordHeader) + paddedRecordSize(recordHeader->size);
+    }
+
+    return ok();
+}
+
+expected<void, RecordingError> RecordingReader::addRecord(const uint64_t offset) noexcept
+{
+    if (offset % RECORD_ALIGNMENT != 0U || offset < sizeof(RecordingFileHeader)
+        || offset > m_size - sizeof(RecordHeader))
+    {
+        return err(RecordingError::INVALID_FILE_FORMAT);
+    }
+
+    const auto* const recordHeader = reinterpret_cast<const RecordHeader*>(data(offset));
+    const uint64_t bodyOffset = offset + sizeof(RecordHeader);
+    if (recordHeader->size > m_size - bodyOffset)
+    {
+        return err(RecordingError::INVALID_FILE_FORMAT);
+    }
+
+    switch (recordHeader->type)
+    {
+    case RecordType::TOPIC:
+    {
+        if (recordHeader->size != sizeof(TopicRecord) || recordHeader->topicIndex != m_topics.size())
+        {
+            return err(RecordingError::INVALID_FILE_FORMAT);
+        }
+        const auto* const topic = reinterpret_cast<const TopicRecord*>(data(bodyOffset));
+        m_topics.emplace_back(capro::IdString_t(TruncateToCapacity, &topic->service[0]),
+                              capro::IdString_t(TruncateToCapacity, &topic->instance[0]),
+                              capro::IdString_t(TruncateToCapacity, &topic->event[0]));
+        return ok();
+    }
+    case RecordType::CHUNK:
+    {
+        if (recordHeader->topicIndex >= m_topics.size() || recordHeader->size < sizeof(mepoo::ChunkHeader))
+        {
+            return err(RecordingError::INVALID_FILE_FORMAT);
+        }
+        const auto* const chunkHeader = reinterpret_cast<const mepoo::ChunkHeader*>(data(bodyOffset));
+        if (chunkHeader->chunkHeaderVersion() != mepoo::ChunkHeader::CHUNK_HEADER_VERSION)
+        {
+            return err(RecordingError::INCOMPATIBLE_CHUNK_HEADER_VERSION);
+        }
+        if (chunkHeader->usedSizeOfChunk() != recordHeader->size)
+        {
+            return err(RecordingError::INVALID_FILE_FORMAT);
+        }
+        m_chunks.push_back(IndexEntry{offset, recordHeader->timestamp, RecordType::CHUNK, recordHeader->topicIndex});
+        return ok();
+    }
+    case RecordType::INVALID:
+        break;
+    }
+
+    return err(RecordingError::INVALID_FILE_FORMAT);
+}
+
+} // namespace record_replay
+} // namespace iox
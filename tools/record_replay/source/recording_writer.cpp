@@ -0,0 +1,251 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_record_replay/recording_writer.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iox/detail/system_configuration.hpp"
+#include "iox/logging.hpp"
+#include "iox/posix_call.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace iox
+{
+namespace record_replay
+{
+namespace
+{
+uint64_t alignToPageSize(const uint64_t size) noexcept
+{
+    const auto pageSize = detail::pageSize();
+    return ((size + pageSize - 1U) / pageSize) * pageSize;
+}
+
+template <uint64_t Capacity>
+void copyIdString(char (&destination)[Capacity], const capro::IdString_t& source) noexcept
+{
+    static_assert(Capacity > capro::IdString_t::capacity(), "the destination must hold the null-terminator");
+    std::memcpy(&destination[0], source.c_str(), source.size());
+}
+} // namespace
+
+RecordingWriter::RecordingWriter(File&& file, const uint64_t segmentSize) noexcept
+    : m_file(std::move(file))
+    , m_segmentSize(segmentSize)
+{
+}
+
+expected<RecordingWriter, RecordingError> RecordingWriter::create(const FilePath& path,
+                                                                  const uint64_t segmentSize) noexcept
+{
+    auto file = FileBuilder()
+                    .open_mode(OpenMode::PURGE_AND_CREATE)
+                    .access_mode(AccessMode::READ_WRITE)
+                    .permissions(perms::owner_read | perms::owner_write | perms::group_read)
+                    .create(path);
+    if (file.has_error())
+    {
+        IOX_LOG(ERROR, "Unable to create the recording file '" << path.as_string() << "'");
+        return err(RecordingError::UNABLE_TO_OPEN_FILE);
+    }
+
+    RecordingWriter writer{std::move(file.value()), alignToPageSize(std::max(segmentSize, uint64_t{1U}))};
+
+    writer.m_fileHeader.startTimestamp = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch())
+            .count());
+    if (writer.writeFileHeader().has_error())
+    {
+        IOX_LOG(ERROR, "Unable to write the header of the recording file '" << path.as_string() << "'");
+        return err(RecordingError::UNABLE_TO_WRITE_FILE);
+    }
+
+    return ok(std::move(writer));
+}
+
+expected<uint32_t, RecordingError> RecordingWriter::addTopic(const capro::ServiceDescription& service) noexcept
+{
+    TopicRecord topic;
+    copyIdString(topic.service, service.getServiceIDString());
+    copyIdString(topic.instance, service.getInstanceIDString());
+    copyIdString(topic.event, service.getEventIDString());
+
+    auto result = appendRecord(RecordType::TOPIC, m_numberOfTopics, 0U, &topic, sizeof(topic));
+    if (result.has_error())
+    {
+        return err(result.error());
+    }
+
+    return ok(m_numberOfTopics++);
+}
+
+expected<void, RecordingError> RecordingWriter::addChunk(const uint32_t topicIndex,
+                                                         const uint64_t timestamp,
+                                                         const mepoo::ChunkHeader& chunkHeader) noexcept
+{
+    if (topicIndex >= m_numberOfTopics)
+    {
+        return err(RecordingError::UNKNOWN_TOPIC);
+    }
+
+    auto result = appendRecord(RecordType::CHUNK, topicIndex, timestamp, &chunkHeader, chunkHeader.usedSizeOfChunk());
+    if (!result.has_error())
+    {
+        ++m_numberOfChunks;
+    }
+
+    return result;
+}
+
+expected<void, RecordingError> RecordingWriter::close() noexcept
+{
+    if (m_isClosed)
+    {
+        return err(RecordingError::RECORDING_ALREADY_CLOSED);
+    }
+    m_isClosed = true;
+    m_segment.reset();
+
+    // the preallocated but unused part of the last segment is dropped before the index is appended
+    const uint64_t indexSize = m_index.size() * sizeof(IndexEntry);
+    if (truncate(m_writePosition + indexSize).has_error())
+    {
+        return err(RecordingError::UNABLE_TO_WRITE_FILE);
+    }
+
+    auto indexResult = m_file.write_at(m_writePosition, reinterpret_cast<const uint8_t*>(m_index.data()), indexSize);
+    if (indexResult.has_error() || indexResult.value() != indexSize)
+    {
+        IOX_LOG(ERROR, "Unable to write the index of the recording");
+        return err(RecordingError::UNABLE_TO_WRITE_FILE);
+    }
+
+    // the header is written last, a recording without a valid index offset is still readable by a sequential scan
+    m_fileHeader.indexOffset = m_writePosition;
+    m_fileHeader.numberOfIndexEntries = m_index.size();
+    if (writeFileHeader().has_error())
+    {
+        IOX_LOG(ERROR, "Unable to write the header of the recording");
+        return err(RecordingError::UNABLE_TO_WRITE_FILE);
+    }
+
+    return ok();
+}
+
+uint64_t RecordingWriter::numberOfChunks() const noexcept
+{
+    return m_numberOfChunks;
+}
+
+expected<void, RecordingError> RecordingWriter::appendRecord(const RecordType type,
+                                                             const uint32_t topicIndex,
+                                                             const uint64_t timestamp,
+                                                             const void* const body,
+                                                             const uint64_t size) noexcept
+{
+    if (m_isClosed)
+    {
+        return err(RecordingError::RECORDING_ALREADY_CLOSED);
+    }
+
+    const uint64_t recordSize = sizeof(RecordHeader) + paddedRecordSize(size);
+    if (!m_segment.has_value() || m_writePosition + recordSize > m_segmentEnd)
+    {
+        auto mapResult = mapSegment(recordSize);
+        if (mapResult.has_error())
+        {
+            return mapResult;
+        }
+    }
+
+    const uint64_t recordOffset = m_writePosition;
+    auto* const record = static_cast<uint8_t*>(m_segment->getBaseAddress()) + (recordOffset - m_segmentBegin);
+
+    // the body is written before the header, a sequential scan of an aborted recording therefore never finds a
+    // record header with an incomplete body; the padding is already zeroed by growing the file
+    std::memcpy(record + sizeof(RecordHeader), body, size);
+    const RecordHeader recordHeader{type, topicIndex, timestamp, size};
+    std::memcpy(record, &recordHeader, sizeof(recordHeader));
+
+    m_index.push_back(IndexEntry{recordOffset, timestamp, type, topicIndex});
+    m_writePosition += recordSize;
+
+    return ok();
+}
+
+expected<void, RecordingError> RecordingWriter::mapSegment(const uint64_t requiredSize) noexcept
+{
+    m_segment.reset();
+
+    // a mapping must start at a page boundary, therefore the segment begins with the tail of the previous one
+    const auto pageSize = detail::pageSize();
+    const uint64_t segmentBegin = (m_writePosition / pageSize) * pageSize;
+    const uint64_t segmentEnd = m_writePosition + std::max(m_segmentSize, alignToPageSize(requiredSize));
+
+    if (truncate(segmentEnd).has_error())
+    {
+        return err(RecordingError::UNABLE_TO_WRITE_FILE);
+    }
+
+    auto segment = detail::PosixMemoryMapBuilder()
+                       .fileDescriptor(m_file.get_file_handle())
+                       .length(segmentEnd - segmentBegin)
+                       .offset(static_cast<off_t>(segmentBegin))
+                       .accessMode(AccessMode::READ_WRITE)
+                       .flags(detail::PosixMemoryMapFlags::SHARE_CHANGES)
+                       .create();
+    if (segment.has_error())
+    {
+        IOX_LOG(ERROR, "Unable to map the recording file segment at offset " << segmentBegin);
+        return err(RecordingError::UNABLE_TO_MAP_FILE);
+    }
+
+    m_segment.emplace(std::move(segment.value()));
+    m_segmentBegin = segmentBegin;
+    m_segmentEnd = segmentEnd;
+
+    return ok();
+}
+
+expected<void, RecordingError> RecordingWriter::writeFileHeader() noexcept
+{
+    auto result = m_file.write_at(0U, reinterpret_cast<const uint8_t*>(&m_fileHeader), sizeof(m_fileHeader));
+    if (result.has_error() || result.value() != sizeof(m_fileHeader))
+    {
+        return err(RecordingError::UNABLE_TO_WRITE_FILE);
+    }
+
+    return ok();
+}
+
+expected<void, RecordingError> RecordingWriter::truncate(const uint64_t size) noexcept
+{
+    auto result = IOX_POSIX_CALL(ftruncate)(m_file.get_file_handle(), static_cast<off_t>(size))
+                      .failureReturnValue(-1)
+                      .evaluate();
+    if (result.has_error())
+    {
+        IOX_LOG(ERROR, "Unable to resize the recording file to " << size << " bytes");
+        return err(RecordingError::UNABLE_TO_WRITE_FILE);
+    }
+
+    return ok();
+}
+
+} // namespace record_replay
+} // namespace iox
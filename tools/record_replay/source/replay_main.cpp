@@ -0,0 +1,129 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_record_replay/recording_reader.hpp"
+#include "iox/cli_definition.hpp"
+#include "iox/signal_watcher.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+constexpr char APP_NAME[] = "iox-replay";
+
+struct CommandLine
+{
+    IOX_CLI_DEFINITION(CommandLine);
+
+    IOX_CLI_REQUIRED(iox::cli::Argument_t, input, 'i', "input", "Path of the recording file");
+    IOX_CLI_OPTIONAL(double, rate, 1.0, 'r', "rate", "Factor by which the replay is sped up, 0 replays without delay");
+    IOX_CLI_OPTIONAL(uint64_t, startDelay, 500U, 'd', "start-delay", "Time in ms for subscribers to connect");
+};
+
+/// @brief publishes a copy of a recorded chunk with the same user-header and user-payload layout
+bool publishRecordedChunk(iox::popo::UntypedPublisher& publisher, const iox::mepoo::ChunkHeader& recordedChunk)
+{
+    const auto userHeaderSize = recordedChunk.userHeaderSize();
+    const auto userHeaderAlignment = (userHeaderSize == iox::CHUNK_NO_USER_HEADER_SIZE)
+                                         ? iox::CHUNK_NO_USER_HEADER_ALIGNMENT
+                                         : static_cast<uint32_t>(alignof(iox::mepoo::ChunkHeader));
+
+    auto userPayload = publisher.loan(recordedChunk.userPayloadSize(),
+                                      recordedChunk.userPayloadAlignment(),
+                                      userHeaderSize,
+                                      userHeaderAlignment);
+    if (userPayload.has_error())
+    {
+        std::cerr << "Unable to loan a chunk: " << userPayload.error() << std::endl;
+        return false;
+    }
+
+    auto* chunkHeader = iox::mepoo::ChunkHeader::fromUserPayload(userPayload.value());
+    if (userHeaderSize != iox::CHUNK_NO_USER_HEADER_SIZE)
+    {
+        std::memcpy(chunkHeader->userHeader(), recordedChunk.userHeader(), userHeaderSize);
+    }
+    std::memcpy(chunkHeader->userPayload(), recordedChunk.userPayload(), recordedChunk.userPayloadSize());
+    publisher.publish(userPayload.value());
+
+    return true;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    using iox::record_replay::RecordingReader;
+
+    auto cmd = CommandLine::parse(argc, argv, "Replays a recording created by iox-record");
+    if (cmd.rate() < 0.0)
+    {
+        std::cerr << "The rate must not be negative" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    auto path = iox::FilePath::create(cmd.input());
+    if (path.has_error())
+    {
+        std::cerr << "Invalid recording file path '" << cmd.input() << "'" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    auto reader = RecordingReader::open(path.value());
+    if (reader.has_error())
+    {
+        return EXIT_FAILURE;
+    }
+
+    iox::runtime::PoshRuntime::initRuntime(APP_NAME);
+
+    std::vector<std::unique_ptr<iox::popo::UntypedPublisher>> publishers;
+    for (const auto& service : reader->topics())
+    {
+        std::cout << "Replaying " << service << std::endl;
+        publishers.emplace_back(std::make_unique<iox::popo::UntypedPublisher>(service));
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(cmd.startDelay()));
+
+    const auto replayStart = std::chrono::steady_clock::now();
+    uint64_t numberOfPublishedChunks{0U};
+    for (uint64_t i = 0U; i < reader->numberOfChunks() && !iox::hasTerminationRequested(); ++i)
+    {
+        const auto chunk = reader->chunk(i);
+        if (cmd.rate() > 0.0)
+        {
+            const auto scaledTimestamp = static_cast<double>(chunk.timestamp) / cmd.rate();
+            std::this_thread::sleep_until(
+                replayStart + std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(scaledTimestamp)));
+        }
+
+        if (publishRecordedChunk(*publishers[chunk.topicIndex], *chunk.chunkHeader))
+        {
+            ++numberOfPublishedChunks;
+        }
+    }
+
+    std::cout << "Replayed " << numberOfPublishedChunks << " of " << reader->numberOfChunks() << " samples" << std::endl;
+
+    return EXIT_SUCCESS;
+}